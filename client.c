@@ -0,0 +1,737 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  client.c
+
+  Asynchronous client for the pimount control protocol, see client.h.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "timespec.h"
+#include "client.h"
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Private
+  ==============================================================================
+  ==============================================================================
+*/
+
+/* Reconnect delays, in ms. */
+#define CLIENT_BACKOFF_MIN 250
+#define CLIENT_BACKOFF_MAX 5000
+
+enum client_state {
+	CLIENT_STATE_DOWN,
+	CLIENT_STATE_CONNECTING,
+	CLIENT_STATE_UP
+};
+
+struct pending {
+	unsigned int sequence;
+	client_callback_t callback;
+	void *data;
+};
+
+struct connection {
+	int fd;
+	enum client_state state;
+	struct timespec retry;	/* When to try again, if DOWN. */
+	long backoff;		/* in ms */
+
+	/* Requests sent (or queued), oldest first. */
+	struct pending pending[CLIENT_PIPELINE_DEPTH];
+	int npending;
+
+	/* Bytes not written yet. */
+	char out[CLIENT_PIPELINE_DEPTH * sizeof(struct server_message)];
+	size_t out_have;
+
+	/* Part of a message read so far. */
+	struct server_message in;
+	size_t in_have;
+};
+
+struct client {
+	struct sockaddr_in address;
+	struct client_hooks hooks;
+	unsigned int sequence;
+	unsigned nconnections;
+	struct connection connections[CLIENT_MAX_CONNECTIONS];
+};
+
+/*
+  ------------------------------------------------------------------------------
+  now
+*/
+
+static struct timespec
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  connection_close
+
+  Fail everything in flight, and schedule a reconnect.
+*/
+
+static void
+connection_close(struct client *client, struct connection *c, int error)
+{
+	struct pending pending[CLIENT_PIPELINE_DEPTH];
+	int npending;
+	int i;
+
+	if (-1 != c->fd) {
+		if (CLIENT_STATE_UP == c->state) {
+			if (ECANCELED != error)
+				fprintf(stderr, "%s:%d - Connection Lost: %s\n",
+					__FILE__, __LINE__, strerror(error));
+
+			if (NULL != client->hooks.removed)
+				client->hooks.removed(client, c->fd,
+						      client->hooks.data);
+		} else if (CLIENT_BACKOFF_MIN == c->backoff) {
+			fprintf(stderr, "%s:%d - connect() failed: %s\n",
+				__FILE__, __LINE__, strerror(error));
+		}
+
+		close(c->fd);
+		c->fd = -1;
+	}
+
+	c->retry = timespec_add(now(), timespec_from_ms(c->backoff));
+	c->backoff *= 2;
+
+	if (CLIENT_BACKOFF_MAX < c->backoff)
+		c->backoff = CLIENT_BACKOFF_MAX;
+
+	c->state = CLIENT_STATE_DOWN;
+	c->out_have = 0;
+	c->in_have = 0;
+
+	/* The callbacks may queue new requests, so copy first. */
+	npending = c->npending;
+	memcpy(pending, c->pending, sizeof(pending));
+	c->npending = 0;
+
+	for (i = 0; i < npending; ++i)
+		pending[i].callback(client, NULL, -error, pending[i].data);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  connection_up
+*/
+
+static void
+connection_up(struct client *client, struct connection *c)
+{
+	c->state = CLIENT_STATE_UP;
+	c->backoff = CLIENT_BACKOFF_MIN;
+
+	if (NULL != client->hooks.added)
+		client->hooks.added(client, c->fd, client->hooks.data);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  connection_open
+*/
+
+static void
+connection_open(struct client *client, struct connection *c)
+{
+	int rc;
+
+	c->fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+	if (-1 == c->fd) {
+		connection_close(client, c, errno);
+
+		return;
+	}
+
+	rc = connect(c->fd, (struct sockaddr *)&client->address,
+		     sizeof(client->address));
+
+	if (0 == rc) {
+		connection_up(client, c);
+	} else if (EINPROGRESS == errno) {
+		c->state = CLIENT_STATE_CONNECTING;
+	} else {
+		connection_close(client, c, errno);
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  connection_flush
+*/
+
+static void
+connection_flush(struct client *client, struct connection *c)
+{
+	ssize_t bytes;
+
+	while (0 < c->out_have) {
+		bytes = send(c->fd, c->out, c->out_have,
+			     MSG_DONTWAIT | MSG_NOSIGNAL);
+
+		if (-1 == bytes) {
+			if (EINTR == errno)
+				continue;
+
+			if (EAGAIN != errno && EWOULDBLOCK != errno)
+				connection_close(client, c, errno);
+
+			return;
+		}
+
+		c->out_have -= bytes;
+		memmove(c->out, c->out + bytes, c->out_have);
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  connection_reply
+*/
+
+static void
+connection_reply(struct client *client, struct connection *c,
+		 struct server_message *reply)
+{
+	struct pending pending;
+	int i;
+
+	if (0 == reply->sequence) {
+		if (NULL != client->hooks.pushed)
+			client->hooks.pushed(client, reply, client->hooks.data);
+
+		return;
+	}
+
+	/* Replies come in order, so this is almost always the first. */
+	for (i = 0; i < c->npending; ++i)
+		if (c->pending[i].sequence == reply->sequence)
+			break;
+
+	if (i == c->npending) {
+		fprintf(stderr, "%s:%d - Unexpected Reply: %u\n",
+			__FILE__, __LINE__, reply->sequence);
+
+		return;
+	}
+
+	pending = c->pending[i];
+	--c->npending;
+	memmove(&c->pending[i], &c->pending[i + 1],
+		(c->npending - i) * sizeof(struct pending));
+
+	pending.callback(client, reply, reply->result, pending.data);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  connection_read
+*/
+
+static void
+connection_read(struct client *client, struct connection *c)
+{
+	ssize_t bytes;
+
+	while (CLIENT_STATE_UP == c->state) {
+		bytes = recv(c->fd, (char *)&c->in + c->in_have,
+			     sizeof(c->in) - c->in_have, MSG_DONTWAIT);
+
+		if (0 == bytes) {
+			connection_close(client, c, ECONNRESET);
+
+			return;
+		}
+
+		if (-1 == bytes) {
+			if (EINTR == errno)
+				continue;
+
+			if (EAGAIN != errno && EWOULDBLOCK != errno)
+				connection_close(client, c, errno);
+
+			return;
+		}
+
+		c->in_have += bytes;
+
+		if (sizeof(c->in) == c->in_have) {
+			struct server_message reply;
+
+			reply = c->in;
+			c->in_have = 0;
+			connection_reply(client, c, &reply);
+		}
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  connection_connected
+
+  A non-blocking connect() finished, one way or the other.
+*/
+
+static void
+connection_connected(struct client *client, struct connection *c)
+{
+	int error = 0;
+	socklen_t length = sizeof(error);
+
+	if (-1 == getsockopt(c->fd, SOL_SOCKET, SO_ERROR, &error, &length))
+		error = errno;
+
+	if (0 != error) {
+		connection_close(client, c, error);
+
+		return;
+	}
+
+	connection_up(client, c);
+	connection_flush(client, c);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  call_done
+*/
+
+struct call {
+	bool done;
+	int result;
+	struct server_message *message;
+};
+
+static void
+call_done(__attribute__((unused)) struct client *client,
+	  struct server_message *reply, int result, void *data)
+{
+	struct call *call;
+
+	call = (struct call *)data;
+	call->done = true;
+	call->result = result;
+
+	if (NULL != reply)
+		*call->message = *reply;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  call_ignore
+*/
+
+static void
+call_ignore(__attribute__((unused)) struct client *client,
+	    __attribute__((unused)) struct server_message *reply,
+	    __attribute__((unused)) int result,
+	    __attribute__((unused)) void *data)
+{
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  call_abandon
+
+  client_call() gave up on 'sequence', and its struct call is going
+  away with the stack frame.  The request stays pending (the reply
+  still has to be read), but nothing is done when it comes.
+*/
+
+static void
+call_abandon(struct client *client, unsigned int sequence)
+{
+	unsigned i;
+	int j;
+
+	for (i = 0; i < client->nconnections; ++i) {
+		struct connection *c = &client->connections[i];
+
+		for (j = 0; j < c->npending; ++j) {
+			if (sequence != c->pending[j].sequence)
+				continue;
+
+			c->pending[j].callback = call_ignore;
+			c->pending[j].data = NULL;
+
+			return;
+		}
+	}
+
+	return;
+}
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Public
+  ==============================================================================
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  client_create
+*/
+
+struct client *
+client_create(const char *host, unsigned short port, unsigned connections,
+	      const struct client_hooks *hooks)
+{
+	struct client *client;
+	unsigned i;
+
+	if (0 == connections || CLIENT_MAX_CONNECTIONS < connections) {
+		errno = EINVAL;
+
+		return NULL;
+	}
+
+	client = calloc(1, sizeof(struct client));
+
+	if (NULL == client)
+		return NULL;
+
+	client->address.sin_family = AF_INET;
+	client->address.sin_port =
+		htons((0 == port) ? SERVER_DEFAULT_PORT : port);
+
+	if (1 != inet_pton(AF_INET, host, &client->address.sin_addr)) {
+		struct addrinfo hints;
+		struct addrinfo *result;
+		int rc;
+
+		memset(&hints, 0, sizeof(hints));
+		hints.ai_family = AF_INET;
+		hints.ai_socktype = SOCK_STREAM;
+
+		rc = getaddrinfo(host, NULL, &hints, &result);
+
+		if (rc) {
+			fprintf(stderr, "%s:%d - getaddrinfo(%s) failed: %s\n",
+				__FILE__, __LINE__, host, gai_strerror(rc));
+			free(client);
+			errno = EHOSTUNREACH;
+
+			return NULL;
+		}
+
+		client->address.sin_addr =
+			((struct sockaddr_in *)result->ai_addr)->sin_addr;
+		freeaddrinfo(result);
+	}
+
+	if (NULL != hooks)
+		client->hooks = *hooks;
+
+	client->nconnections = connections;
+
+	for (i = 0; i < connections; ++i) {
+		client->connections[i].fd = -1;
+		client->connections[i].backoff = CLIENT_BACKOFF_MIN;
+		connection_open(client, &client->connections[i]);
+	}
+
+	return client;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  client_destroy
+*/
+
+void
+client_destroy(struct client *client)
+{
+	unsigned i;
+
+	if (NULL == client)
+		return;
+
+	for (i = 0; i < client->nconnections; ++i)
+		connection_close(client, &client->connections[i], ECANCELED);
+
+	free(client);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  client_request
+*/
+
+int
+client_request(struct client *client, struct server_message *request,
+	       client_callback_t callback, void *data)
+{
+	struct connection *best = NULL;
+	struct pending *pending;
+	bool any = false;
+	unsigned i;
+
+	/*
+	  Pick the connection with the fewest requests in flight,
+	  preferring connections that are already up.
+	*/
+
+	for (i = 0; i < client->nconnections; ++i) {
+		struct connection *c = &client->connections[i];
+
+		if (CLIENT_STATE_DOWN == c->state)
+			continue;
+
+		any = true;
+
+		if (CLIENT_PIPELINE_DEPTH == c->npending)
+			continue;
+
+		if (NULL == best ||
+		    (CLIENT_STATE_UP == c->state &&
+		     CLIENT_STATE_UP != best->state) ||
+		    (c->state == best->state && c->npending < best->npending))
+			best = c;
+	}
+
+	if (NULL == best) {
+		errno = any ? EAGAIN : ENOTCONN;
+
+		return -1;
+	}
+
+	if (0 == ++client->sequence)
+		++client->sequence;
+
+	request->sequence = client->sequence;
+	request->result = 0;
+
+	pending = &best->pending[best->npending++];
+	pending->sequence = request->sequence;
+	pending->callback = callback;
+	pending->data = data;
+
+	memcpy(best->out + best->out_have, request, sizeof(*request));
+	best->out_have += sizeof(*request);
+
+	if (CLIENT_STATE_UP == best->state)
+		connection_flush(client, best);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  client_call
+*/
+
+int
+client_call(struct client *client, struct server_message *message,
+	    int timeout)
+{
+	struct call call;
+	struct timespec stop;
+
+	call.done = false;
+	call.result = -ETIMEDOUT;
+	call.message = message;
+	stop = timespec_add(now(), timespec_from_ms(timeout));
+
+	/* Give the first connect a chance. */
+	while (0 != client_request(client, message, call_done, &call)) {
+		if (timespec_ge(now(), stop))
+			return -errno;
+
+		if (client_service(client, 10))
+			return -EIO;
+	}
+
+	while (!call.done) {
+		long left;
+
+		left = timespec_to_ms(timespec_sub(stop, now()));
+
+		if (0 >= left) {
+			call_abandon(client, message->sequence);
+
+			return -ETIMEDOUT;
+		}
+
+		if (client_service(client, left)) {
+			if (!call.done)
+				call_abandon(client, message->sequence);
+
+			return -EIO;
+		}
+	}
+
+	return call.result;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  client_input
+*/
+
+int
+client_input(struct client *client, int fd)
+{
+	unsigned i;
+
+	for (i = 0; i < client->nconnections; ++i) {
+		struct connection *c = &client->connections[i];
+
+		if (fd == c->fd && CLIENT_STATE_UP == c->state) {
+			connection_read(client, c);
+
+			return 0;
+		}
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  client_service
+*/
+
+int
+client_service(struct client *client, int timeout)
+{
+	struct pollfd fds[CLIENT_MAX_CONNECTIONS];
+	struct connection *map[CLIENT_MAX_CONNECTIONS];
+	struct timespec current;
+	int nfds = 0;
+	unsigned i;
+	int rc;
+
+	current = now();
+
+	for (i = 0; i < client->nconnections; ++i) {
+		struct connection *c = &client->connections[i];
+
+		if (CLIENT_STATE_DOWN == c->state) {
+			long wait;
+
+			if (timespec_ge(current, c->retry))
+				connection_open(client, c);
+
+			/* Don't sleep past the next retry. */
+			wait = timespec_to_ms(timespec_sub(c->retry, current));
+
+			if (CLIENT_STATE_DOWN == c->state &&
+			    0 != timeout && (0 > timeout || wait < timeout))
+				timeout = (0 < wait) ? wait : 1;
+		}
+
+		if (CLIENT_STATE_DOWN == c->state)
+			continue;
+
+		fds[nfds].fd = c->fd;
+
+		if (CLIENT_STATE_CONNECTING == c->state)
+			fds[nfds].events = POLLOUT;
+		else
+			fds[nfds].events =
+				POLLIN | ((0 < c->out_have) ? POLLOUT : 0);
+
+		map[nfds++] = c;
+	}
+
+	rc = poll(fds, nfds, timeout);
+
+	if (-1 == rc) {
+		if (EINTR == errno)
+			return 0;
+
+		fprintf(stderr, "%s:%d - poll() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return -1;
+	}
+
+	for (i = 0; i < (unsigned)nfds; ++i) {
+		struct connection *c = map[i];
+
+		if (0 == fds[i].revents || fds[i].fd != c->fd)
+			continue;
+
+		if (CLIENT_STATE_CONNECTING == c->state) {
+			connection_connected(client, c);
+
+			continue;
+		}
+
+		if (fds[i].revents & POLLOUT)
+			connection_flush(client, c);
+
+		if (fds[i].revents & (POLLIN | POLLERR | POLLHUP))
+			connection_read(client, c);
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  client_connected
+*/
+
+bool
+client_connected(struct client *client)
+{
+	unsigned i;
+
+	for (i = 0; i < client->nconnections; ++i)
+		if (CLIENT_STATE_UP == client->connections[i].state)
+			return true;
+
+	return false;
+}
@@ -0,0 +1,120 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  client.h
+
+  Asynchronous client for the pimount control protocol (see server.h).
+
+  A client keeps a small pool of connections to the server.  Requests
+  go out on the least busy connection and several can be in flight on
+  each connection at once (pipelining).  When a reply arrives, the
+  callback given with the request is called.  Connections that fail
+  are re-established in the background with an increasing delay.
+
+  Nothing here blocks (except client_call(), which is for simple test
+  programs).  To use it from an event loop...
+
+    - Register the fds reported by the 'added' hook for input, and
+      unregister those reported by 'removed'.
+    - Call client_input() when one of those fds is readable.
+    - Call client_service(client, 0) periodically (every 100 ms or
+      so); it finishes connects, flushes output and reconnects.
+
+  Or, with no event loop at all, call client_service() with a timeout
+  and it will poll() itself.
+
+  A client is not thread safe, use it from one thread only.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _CLIENT_H_
+#define _CLIENT_H_
+
+#include <stdbool.h>
+
+#include "server.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+  Maximum connections in the pool, and requests in flight on each.
+*/
+
+#define CLIENT_MAX_CONNECTIONS 4
+#define CLIENT_PIPELINE_DEPTH 16
+
+struct client;
+
+/*
+  'result' is 0 and 'reply' is valid if the request completed.  If
+  the connection failed first, 'result' is a negative errno value and
+  'reply' is NULL.  Note that a failed request may or may not have
+  been acted on by the server.
+*/
+
+typedef void (*client_callback_t)(struct client *client,
+				  struct server_message *reply, int result,
+				  void *data);
+
+struct client_hooks {
+	/* A connection was made (or lost), watch (or stop watching) fd. */
+	void (*added)(struct client *client, int fd, void *data);
+	void (*removed)(struct client *client, int fd, void *data);
+
+	/* A message the server sent on its own (sequence 0). */
+	void (*pushed)(struct client *client,
+		       struct server_message *message, void *data);
+
+	void *data;
+};
+
+/*
+  host is a name or dotted quad, port 0 means SERVER_DEFAULT_PORT.
+  hooks can be NULL.  Connecting starts right away, but finishes in
+  client_service().
+*/
+
+struct client *client_create(const char *host, unsigned short port,
+			     unsigned connections,
+			     const struct client_hooks *hooks);
+void client_destroy(struct client *client);
+
+/*
+  Queue a request.  'request' is copied (the sequence number is filled
+  in).  Returns 0 if queued, or -1 (with errno set) if no connection
+  can take it right now.
+*/
+
+int client_request(struct client *client, struct server_message *request,
+		   client_callback_t callback, void *data);
+
+/*
+  Send a request and wait for the reply, at most timeout ms.  The
+  reply overwrites 'message'.  Returns the result (see above), or
+  -ETIMEDOUT.
+*/
+
+int client_call(struct client *client, struct server_message *message,
+		int timeout);
+
+/*
+  Event loop glue, see above.  Both return -1 only on fatal errors.
+*/
+
+int client_input(struct client *client, int fd);
+int client_service(struct client *client, int timeout);
+
+/*
+  True if at least one connection is up.
+*/
+
+bool client_connected(struct client *client);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _CLIENT_H_ */
@@ -0,0 +1,344 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  export.c
+
+  pimount-export: get the records out of a recording (see recorder.h).
+
+  By default, CSV on stdout, one line per record, oldest first, with
+  the fields as recorded (times in nano seconds, temperatures in tenths
+  of a degree) and unknown values left empty.
+
+  With --columns <directory>, a file per column instead, each the raw
+  values in the recording's byte order, and schema.txt listing the
+  columns with numpy style types, so
+
+    numpy.fromfile("dir/ra_late", dtype="<i4")
+
+  reads one.  This is quicker to load and much smaller than CSV for a
+  few nights of records.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <inttypes.h>
+#include <getopt.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#include "recorder.h"
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Private Stuff
+  ==============================================================================
+  ==============================================================================
+*/
+
+enum type {
+	TYPE_U64,
+	TYPE_I64,
+	TYPE_I32,
+	TYPE_I16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_F32
+};
+
+static const char *type_names[] = {
+	"<u8", "<i8", "<i4", "<i2", "|u1", "<u4", "<f4"
+};
+
+static const struct column {
+	const char *name;
+	enum type type;
+	size_t offset;
+	bool has_unknown;
+	long long unknown;
+} columns[] = {
+#define COLUMN(field, type) \
+	{ #field, type, offsetof(struct recorder_record, field), false, 0 }
+#define COLUMN_UNKNOWN(field, type, unknown) \
+	{ #field, type, offsetof(struct recorder_record, field), true, unknown }
+	COLUMN(sequence, TYPE_U64),
+	COLUMN(time, TYPE_I64),
+	COLUMN(control, TYPE_U8),
+	COLUMN(ra_rate, TYPE_F32),
+	COLUMN(dec_rate, TYPE_F32),
+	COLUMN(ra_position, TYPE_I64),
+	COLUMN(dec_position, TYPE_I64),
+	COLUMN(ra_guide, TYPE_F32),
+	COLUMN(dec_guide, TYPE_F32),
+	COLUMN_UNKNOWN(ra_late, TYPE_I32, RECORDER_UNKNOWN_LATE),
+	COLUMN_UNKNOWN(dec_late, TYPE_I32, RECORDER_UNKNOWN_LATE),
+	COLUMN_UNKNOWN(temp, TYPE_I16, RECORDER_UNKNOWN_TEMP),
+	COLUMN_UNKNOWN(load, TYPE_U8, RECORDER_UNKNOWN_LOAD),
+	COLUMN_UNKNOWN(fan, TYPE_U32, RECORDER_UNKNOWN_FAN)
+#undef COLUMN
+#undef COLUMN_UNKNOWN
+};
+
+#define COLUMNS (sizeof(columns) / sizeof(columns[0]))
+
+/*
+  ------------------------------------------------------------------------------
+  usage
+*/
+
+static void
+usage(int exit_code)
+{
+	printf("Usage: pimount-export [options] <recording>\n"
+	       "\t--help|-h  Display this wonderful help text...\n"
+	       "\t--columns|-c <directory>  A file per column, not CSV\n");
+
+	exit(exit_code);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  size
+*/
+
+static size_t
+size(enum type type)
+{
+	switch (type) {
+	case TYPE_U64:
+	case TYPE_I64:
+		return 8;
+	case TYPE_I32:
+	case TYPE_U32:
+	case TYPE_F32:
+		return 4;
+	case TYPE_I16:
+		return 2;
+	case TYPE_U8:
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  print_value
+*/
+
+static void
+print_value(FILE *file, const struct column *column,
+	    const struct recorder_record *record)
+{
+	const char *p = (const char *)record + column->offset;
+	long long integer = 0;
+	uint64_t u64;
+	int64_t i64;
+	int32_t i32;
+	int16_t i16;
+	uint32_t u32;
+	float f32;
+
+	switch (column->type) {
+	case TYPE_U64:
+		memcpy(&u64, p, sizeof(u64));
+		fprintf(file, "%" PRIu64, u64);
+		return;
+	case TYPE_F32:
+		memcpy(&f32, p, sizeof(f32));
+		fprintf(file, "%.3f", f32);
+		return;
+	case TYPE_I64:
+		memcpy(&i64, p, sizeof(i64));
+		integer = i64;
+		break;
+	case TYPE_I32:
+		memcpy(&i32, p, sizeof(i32));
+		integer = i32;
+		break;
+	case TYPE_I16:
+		memcpy(&i16, p, sizeof(i16));
+		integer = i16;
+		break;
+	case TYPE_U8:
+		integer = *(const uint8_t *)p;
+		break;
+	case TYPE_U32:
+		memcpy(&u32, p, sizeof(u32));
+		integer = u32;
+		break;
+	}
+
+	if (column->has_unknown && column->unknown == integer)
+		return;
+
+	fprintf(file, "%lld", integer);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  export_csv
+*/
+
+static int
+export_csv(const struct recorder_record *records, size_t count)
+{
+	size_t i;
+	size_t c;
+
+	for (c = 0; c < COLUMNS; ++c)
+		printf("%s%s", c ? "," : "", columns[c].name);
+
+	printf("\n");
+
+	for (i = 0; i < count; ++i) {
+		for (c = 0; c < COLUMNS; ++c) {
+			if (c)
+				putchar(',');
+
+			print_value(stdout, &columns[c], &records[i]);
+		}
+
+		putchar('\n');
+	}
+
+	return ferror(stdout) ? -1 : 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  export_columns
+*/
+
+static int
+export_columns(const char *directory,
+	       const struct recorder_record *records, size_t count)
+{
+	char path[4096];
+	FILE *schema;
+	FILE *file;
+	size_t i;
+	size_t c;
+	int rc = 0;
+
+	if (-1 == mkdir(directory, 0755) && EEXIST != errno) {
+		fprintf(stderr, "%s:%d - mkdir(%s) failed: %s\n",
+			__FILE__, __LINE__, directory, strerror(errno));
+
+		return -1;
+	}
+
+	snprintf(path, sizeof(path), "%s/schema.txt", directory);
+	schema = fopen(path, "w");
+
+	if (NULL == schema) {
+		fprintf(stderr, "%s:%d - fopen(%s) failed: %s\n",
+			__FILE__, __LINE__, path, strerror(errno));
+
+		return -1;
+	}
+
+	fprintf(schema, "# %zu rows, unknown values are:\n", count);
+	fprintf(schema, "#   late %d, temp %d, load %d, fan %u\n",
+		RECORDER_UNKNOWN_LATE, RECORDER_UNKNOWN_TEMP,
+		RECORDER_UNKNOWN_LOAD, RECORDER_UNKNOWN_FAN);
+
+	for (c = 0; c < COLUMNS; ++c) {
+		const struct column *column = &columns[c];
+
+		fprintf(schema, "%s %s\n", column->name,
+			type_names[column->type]);
+
+		snprintf(path, sizeof(path), "%s/%s", directory, column->name);
+		file = fopen(path, "wb");
+
+		if (NULL == file) {
+			fprintf(stderr, "%s:%d - fopen(%s) failed: %s\n",
+				__FILE__, __LINE__, path, strerror(errno));
+			rc = -1;
+
+			break;
+		}
+
+		for (i = 0; i < count; ++i)
+			fwrite((const char *)&records[i] + column->offset,
+			       size(column->type), 1, file);
+
+		if (ferror(file))
+			rc = -1;
+
+		if (fclose(file))
+			rc = -1;
+	}
+
+	if (fclose(schema))
+		rc = -1;
+
+	return rc;
+}
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Public Stuff
+  ==============================================================================
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  main
+*/
+
+int
+main(int argc, char *argv[])
+{
+	int rc;
+	int opt = 0;
+	int long_index = 0;
+	const char *directory = NULL;
+	struct recorder_record *records;
+	size_t count;
+
+	static struct option long_options[] = {
+		{"help",      no_argument,       0,  'h' },
+		{"columns",   required_argument, 0,  'c' },
+		{0, 0, 0, 0}
+	};
+
+	while ((opt = getopt_long(argc, argv, "hc:",
+				  long_options, &long_index )) != -1) {
+		switch (opt) {
+		case 'h':
+			usage(EXIT_SUCCESS);
+			break;
+		case 'c':
+			directory = optarg;
+			break;
+		default:
+			fprintf(stderr, "Invalid Option\n");
+			usage(EXIT_FAILURE);
+			break;
+		}
+	}
+
+	if (optind + 1 != argc)
+		usage(EXIT_FAILURE);
+
+	if (recorder_load(argv[optind], &records, &count))
+		return EXIT_FAILURE;
+
+	if (NULL == directory)
+		rc = export_csv(records, count);
+	else
+		rc = export_columns(directory, records, count);
+
+	free(records);
+
+	return rc ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -1,96 +1,308 @@
 /*
   fan.c
 
-  The fan thread.
+  Fan control, run from the housekeeping loop (see loop.h).
 */
 
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <getopt.h>
-#include <signal.h>
 #include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+#include <time.h>
 #include <pthread.h>
 #include <pigpiod_if2.h>
 
 #include "pimount.h"
 #include "stats.h"
+#include "stepper.h"
+#include "telemetry.h"
+#include "timespec.h"
 #include "fan.h"
 
 char *cmdErrStr(int);
 
+/*
+  ==============================================================================
+  Private
+  ==============================================================================
+*/
+
+/*
+  The controller.  The output, 0...1, is spread over bias...1,000,000
+  (see fan.h), so the gains are in "share of the fan's range".
+
+  The derivative is of the (smoothed) temperature, not of the error, so
+  changing the setpoint doesn't kick the fan.  The integral only moves
+  while the output isn't pinned at 0 or 1, and is clamped to 0...1, so
+  it doesn't wind up through a long slew or a cold night.
+
+  Slews heat the board (the drivers and the supply) well before the
+  sensor sees it, so the motors' activity, the rates as a share of the
+  maximums, is fed forward.
+*/
+
+#define FAN_KP 0.10		/* per degree */
+#define FAN_KI 0.004		/* per degree second */
+#define FAN_KD 1.0		/* per degree per second */
+#define FAN_FF 0.25		/* with both axes at the maximum rate */
+#define FAN_SMOOTH 0.3		/* weight of the newest slope */
+#define FAN_MINIMUM 0.05	/* less than this, turn the fan off */
+
+/* Seconds between runs, fast while the temperature is moving. */
+
+#define FAN_PERIOD_FAST 1.0
+#define FAN_PERIOD_SLOW 5.0
+#define FAN_MOVING_SLOPE 0.02	/* degrees per second */
+#define FAN_MOVING_ERROR 2.0	/* degrees */
+
+static struct {
+	pthread_mutex_t mutex;
+	int duty;		/* last set, -1 if none yet */
+	struct fan_sample history[FAN_HISTORY];
+	unsigned next;
+	unsigned count;
+
+	/* Only used by fan_control(). */
+	struct timespec last;
+	double previous;	/* temperature */
+	double slope;		/* smoothed, degrees per second */
+	double integral;
+	bool first;
+} global = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.duty = -1,
+	.next = 0,
+	.count = 0,
+	.previous = 0.0,
+	.slope = 0.0,
+	.integral = 0.0,
+	.first = true
+};
+
 /*
   ------------------------------------------------------------------------------
-  fan_cleanup
+  get_celsius
+
+  The temperature, in degrees, or false if it isn't known.
+*/
+
+static bool
+get_celsius(double *temp)
+{
+	struct telemetry_sample sample;
+
+	if (!telemetry_latest(&sample) || TELEMETRY_UNKNOWN == sample.temp)
+		return false;
+
+	*temp = (double)sample.temp / 1000.0;
+
+	return true;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  get_activity
+
+  How hard the motors are working, 0...1.
+*/
+
+static double
+get_activity(void)
+{
+	bool running;
+	double rate;
+	double activity = 0.0;
+
+	if (0 == stepper_get_status(STEPPER_AXIS_RA, &running, &rate, NULL) &&
+	    running)
+		activity += fmin(fabs(rate) / MAX_RA_RATE, 1.0);
+
+	if (0 == stepper_get_status(STEPPER_AXIS_DEC, &running, &rate, NULL) &&
+	    running)
+		activity += fmin(fabs(rate) / MAX_DEC_RATE, 1.0);
+
+	return activity / 2.0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  add_sample
 */
 
 static void
-fan_cleanup(__attribute__((unused)) void *input)
-{	
-	int rc;
+add_sample(const struct fan_sample *sample)
+{
+	lock(&global.mutex);
+	global.history[global.next] = *sample;
+	global.next = (global.next + 1) % FAN_HISTORY;
 
-	rc = gpioHardwarePWM(FAN_PIN, 100, 0);
+	if (FAN_HISTORY > global.count)
+		++global.count;
 
-	if (0 > rc)
-		fprintf(stderr, "gpioHardwarePWM() failed: %s\n",
-			cmdErrStr(rc));
+	if (0 <= sample->duty)
+		global.duty = sample->duty;
+
+	unlock(&global.mutex);
 
 	return;
 }
 
+/*
+  ==============================================================================
+  Public
+  ==============================================================================
+*/
+
 /*
   ------------------------------------------------------------------------------
-  fan
+  fan_control
 */
 
-void *
-fan(void *input)
+double
+fan_control(void *input, struct timespec now)
 {
-	struct timespec sleep;
 	struct fan_params *params;
-	int temp;
+	struct fan_sample sample;
+	double period = FAN_PERIOD_FAST;
+	double dt;
 	int rc;
 
 	params = (struct fan_params *)input;
 
-	sleep.tv_sec = 5;
-	sleep.tv_nsec = 0;
+	memset(&sample, 0, sizeof(sample));
+	sample.when = now;
+	dt = timespec_to_double(timespec_sub(now, global.last));
+	global.last = now;
 
-	pthread_cleanup_push(fan_cleanup, input);
+	if (!get_celsius(&sample.temp)) {
+		/* Not knowing is the same as too hot. */
+		sample.temp = NAN;
+		sample.error = NAN;
+		sample.output = 1.0;
+		sample.duty = PI_HW_PWM_RANGE;
+		global.first = true;
+	} else {
+		double proportional;
+		double output;
 
-	for (;;) {
-		int duty;
+		if (global.first || 0.0 >= dt) {
+			dt = 0.0;
+			global.slope = 0.0;
+			global.first = false;
+		} else {
+			global.slope += FAN_SMOOTH *
+				(((sample.temp - global.previous) / dt) -
+				 global.slope);
+		}
 
-		nanosleep(&sleep, NULL);
-		temp = get_temp();
+		global.previous = sample.temp;
+		sample.error = sample.temp - params->setpoint;
+		sample.feed_forward = FAN_FF * get_activity();
+		proportional = FAN_KP * sample.error;
+		output = proportional + global.integral +
+			(FAN_KD * global.slope) + sample.feed_forward;
 
-		if (params->high < temp) {
-			/* Above 'high', run at full speed. */
-			duty = PI_HW_PWM_RANGE;
-		} else if (params->low > temp) {
-			/* Below 'low', don't run. */
-			duty = 0;
-		} else {
-			/*
-			  Between 'low' and 'high', range from 'bias'
-			  to 1,000,000.
-			*/
-
-			duty = ((((temp - params->low) * 5) *
-				 (PI_HW_PWM_RANGE - params->bias)) / 100) +
-				params->bias;
+		/* Don't integrate further into saturation. */
+		if ((1.0 > output || 0.0 > sample.error) &&
+		    (0.0 < output || 0.0 < sample.error)) {
+			global.integral += FAN_KI * sample.error * dt;
+			global.integral =
+				fmax(0.0, fmin(global.integral, 1.0));
+			output = proportional + global.integral +
+				(FAN_KD * global.slope) + sample.feed_forward;
 		}
 
-		rc = gpioHardwarePWM(FAN_PIN, 100, duty);
+		sample.integral = global.integral;
+		sample.output = fmax(0.0, fmin(output, 1.0));
+
+		if (params->high < sample.temp)
+			sample.duty = PI_HW_PWM_RANGE;
+		else if (params->low > sample.temp ||
+			 FAN_MINIMUM > sample.output)
+			sample.duty = 0;
+		else
+			sample.duty = params->bias +
+				(int)(sample.output *
+				      (PI_HW_PWM_RANGE - params->bias));
+
+		if (FAN_MOVING_SLOPE >= fabs(global.slope) &&
+		    FAN_MOVING_ERROR >= fabs(sample.error))
+			period = FAN_PERIOD_SLOW;
+	}
 
-		if (0 > rc)
-			fprintf(stderr, "hardware_PWM() failed: %s\n",
-				cmdErrStr(rc));
+	rc = gpioHardwarePWM(FAN_PIN, 100, sample.duty);
 
-		pthread_testcancel();
+	if (0 > rc) {
+		fprintf(stderr, "hardware_PWM() failed: %s\n", cmdErrStr(rc));
+		sample.duty = -1;
 	}
 
-	pthread_cleanup_pop(1);
-	pthread_exit(NULL);
+	add_sample(&sample);
+
+	return period;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  fan_off
+*/
+
+void
+fan_off(void)
+{
+	int rc;
+
+	rc = gpioHardwarePWM(FAN_PIN, 100, 0);
+
+	if (0 > rc)
+		fprintf(stderr, "gpioHardwarePWM() failed: %s\n",
+			cmdErrStr(rc));
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  fan_get_duty
+*/
+
+int
+fan_get_duty(void)
+{
+	int duty;
+
+	lock(&global.mutex);
+	duty = global.duty;
+	unlock(&global.mutex);
+
+	return duty;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  fan_get_history
+*/
+
+unsigned
+fan_get_history(struct fan_sample *samples, unsigned count)
+{
+	unsigned first;
+	unsigned i;
+
+	lock(&global.mutex);
+
+	if (count > global.count)
+		count = global.count;
+
+	first = (global.next + FAN_HISTORY - count) % FAN_HISTORY;
+
+	for (i = 0; i < count; ++i)
+		samples[i] = global.history[(first + i) % FAN_HISTORY];
+
+	unlock(&global.mutex);
+
+	return count;
 }
@@ -5,11 +5,13 @@
 #ifndef _FAN_H_
 #define _FAN_H_
 
+#include <time.h>
+
 /*
-  Temperatures are in degrees centigrade.  Below low, the fan will
-  stay off.  Above high, the fan will run at full speed.  Between, the
-  fan speed will vary -- hopefully somewhat linearly -- between off
-  and full speed.
+  Temperatures are in degrees centigrade.  The fan is run to hold the
+  temperature at 'setpoint' (a PID controller, see fan.c), but below
+  low, the fan will stay off, and above high, the fan will run at full
+  speed, whatever the controller says.
 
   'bias' sets the minimum duty cycle that spins the fan.  For the
   cheap fans I tried, this was around 200,000.  So, instead of the
@@ -17,12 +19,49 @@
   instead.
 */
 
+#define FAN_SETPOINT 55.0
+
 struct fan_params {
 	int bias;
 	int high;
 	int low;
+	double setpoint;
 };
 
-void *fan(void *);
+/*
+  Run by the housekeeping loop, with a struct fan_params.  Returns the
+  seconds until it should run again (see loop.h).
+*/
+
+double fan_control(void *input, struct timespec now);
+
+/* Turn the fan off, when stopping. */
+
+void fan_off(void);
+
+/* The duty cycle (0...1,000,000) last set, -1 before the first. */
+
+int fan_get_duty(void);
+
+/*
+  The controller's recent history, a sample each time it runs (every
+  five seconds, or every second while the temperature is changing).
+*/
+
+#define FAN_HISTORY 120
+
+struct fan_sample {
+	struct timespec when;	/* CLOCK_MONOTONIC */
+	double temp;		/* degrees C */
+	double error;		/* temp - setpoint */
+	double integral;	/* the I term's share of output */
+	double feed_forward;	/* the motors' share of output */
+	double output;		/* 0...1, before the limits */
+	int duty;
+};
+
+/* Up to 'count' of the latest samples, oldest first. */
+
+unsigned fan_get_history(struct fan_sample *samples, unsigned count);
 
 #endif	/* _FAN_H_ */
@@ -7,4 +7,4 @@ else
 CFLAGS += -Og -ggdb3
 endif
 
-LIBS = -lpigpio -lrt -lpthread
+LIBS = -lpigpio -lrt -lpthread -lm
@@ -0,0 +1,3509 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  fontgen.c
+
+  Writes fonts.h, the OLED fonts packed for oled.c (see the GNUmakefile).
+
+  The tables below are in the panel's page layout: for each glyph,
+  each page row of the cell is 'width' bytes, one per column, bit 0 at
+  the top.  fonts.h has each glyph column by column instead, with all
+  the bytes of a column together, so oled.c can build a column of any
+  font as one word and shift it to any pixel row.  Padding and glyphs
+  that can't be reached with a char are dropped.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+  ==============================================================================
+  Private
+  ==============================================================================
+*/
+
+/* 5x7 font (in 6x8 cell) */
+static const unsigned char small[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
+	0x45, 0x51, 0x45, 0x3e, 0x00, 0x3e, 0x6b, 0x6f,
+	0x6b, 0x3e, 0x00, 0x1c, 0x3e, 0x7c, 0x3e, 0x1c,
+	0x00, 0x18, 0x3c, 0x7e, 0x3c, 0x18, 0x00, 0x30,
+	0x36, 0x7f, 0x36, 0x30, 0x00, 0x18, 0x5c, 0x7e,
+	0x5c, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0x00, 0x3c,
+	0x24, 0x24, 0x3c, 0x00, 0x00, 0xc3, 0xdb, 0xdb,
+	0xc3, 0xff, 0x00, 0x30, 0x48, 0x4a, 0x36, 0x0e,
+	0x00, 0x06, 0x29, 0x79, 0x29, 0x06, 0x00, 0x60,
+	0x70, 0x3f, 0x02, 0x04, 0x00, 0x60, 0x7e, 0x0a,
+	0x35, 0x3f, 0x00, 0x2a, 0x1c, 0x36, 0x1c, 0x2a,
+	0x00, 0x00, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x08,
+	0x1c, 0x3e, 0x7f, 0x00, 0x00, 0x14, 0x36, 0x7f,
+	0x36, 0x14, 0x00, 0x00, 0x5f, 0x00, 0x5f, 0x00,
+	0x00, 0x06, 0x09, 0x7f, 0x01, 0x7f, 0x00, 0x22,
+	0x4d, 0x55, 0x59, 0x22, 0x00, 0x60, 0x60, 0x60,
+	0x60, 0x00, 0x00, 0x14, 0xb6, 0xff, 0xb6, 0x14,
+	0x00, 0x04, 0x06, 0x7f, 0x06, 0x04, 0x00, 0x10,
+	0x30, 0x7f, 0x30, 0x10, 0x00, 0x08, 0x08, 0x3e,
+	0x1c, 0x08, 0x00, 0x08, 0x1c, 0x3e, 0x08, 0x08,
+	0x00, 0x78, 0x40, 0x40, 0x40, 0x40, 0x00, 0x08,
+	0x3e, 0x08, 0x3e, 0x08, 0x00, 0x30, 0x3c, 0x3f,
+	0x3c, 0x30, 0x00, 0x03, 0x0f, 0x3f, 0x0f, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x5f, 0x06, 0x00, 0x00, 0x07, 0x03, 0x00,
+	0x07, 0x03, 0x00, 0x24, 0x7e, 0x24, 0x7e, 0x24,
+	0x00, 0x24, 0x2b, 0x6a, 0x12, 0x00, 0x00, 0x63,
+	0x13, 0x08, 0x64, 0x63, 0x00, 0x36, 0x49, 0x56,
+	0x20, 0x50, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x3e, 0x41, 0x00, 0x00, 0x00, 0x00,
+	0x41, 0x3e, 0x00, 0x00, 0x00, 0x08, 0x3e, 0x1c,
+	0x3e, 0x08, 0x00, 0x08, 0x08, 0x3e, 0x08, 0x08,
+	0x00, 0x00, 0xe0, 0x60, 0x00, 0x00, 0x00, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x60, 0x60,
+	0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02,
+	0x00, 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00, 0x00,
+	0x42, 0x7f, 0x40, 0x00, 0x00, 0x62, 0x51, 0x49,
+	0x49, 0x46, 0x00, 0x22, 0x49, 0x49, 0x49, 0x36,
+	0x00, 0x18, 0x14, 0x12, 0x7f, 0x10, 0x00, 0x2f,
+	0x49, 0x49, 0x49, 0x31, 0x00, 0x3c, 0x4a, 0x49,
+	0x49, 0x30, 0x00, 0x01, 0x71, 0x09, 0x05, 0x03,
+	0x00, 0x36, 0x49, 0x49, 0x49, 0x36, 0x00, 0x06,
+	0x49, 0x49, 0x29, 0x1e, 0x00, 0x00, 0x6c, 0x6c,
+	0x00, 0x00, 0x00, 0x00, 0xec, 0x6c, 0x00, 0x00,
+	0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x24,
+	0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x41, 0x22,
+	0x14, 0x08, 0x00, 0x02, 0x01, 0x59, 0x09, 0x06,
+	0x00, 0x3e, 0x41, 0x5d, 0x55, 0x1e, 0x00, 0x7e,
+	0x11, 0x11, 0x11, 0x7e, 0x00, 0x7f, 0x49, 0x49,
+	0x49, 0x36, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x22,
+	0x00, 0x7f, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x7f,
+	0x49, 0x49, 0x49, 0x41, 0x00, 0x7f, 0x09, 0x09,
+	0x09, 0x01, 0x00, 0x3e, 0x41, 0x49, 0x49, 0x7a,
+	0x00, 0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00, 0x00,
+	0x41, 0x7f, 0x41, 0x00, 0x00, 0x30, 0x40, 0x40,
+	0x40, 0x3f, 0x00, 0x7f, 0x08, 0x14, 0x22, 0x41,
+	0x00, 0x7f, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7f,
+	0x02, 0x04, 0x02, 0x7f, 0x00, 0x7f, 0x02, 0x04,
+	0x08, 0x7f, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x3e,
+	0x00, 0x7f, 0x09, 0x09, 0x09, 0x06, 0x00, 0x3e,
+	0x41, 0x51, 0x21, 0x5e, 0x00, 0x7f, 0x09, 0x09,
+	0x19, 0x66, 0x00, 0x26, 0x49, 0x49, 0x49, 0x32,
+	0x00, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x00, 0x3f,
+	0x40, 0x40, 0x40, 0x3f, 0x00, 0x1f, 0x20, 0x40,
+	0x20, 0x1f, 0x00, 0x3f, 0x40, 0x3c, 0x40, 0x3f,
+	0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x07,
+	0x08, 0x70, 0x08, 0x07, 0x00, 0x71, 0x49, 0x45,
+	0x43, 0x00, 0x00, 0x00, 0x7f, 0x41, 0x41, 0x00,
+	0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
+	0x41, 0x41, 0x7f, 0x00, 0x00, 0x04, 0x02, 0x01,
+	0x02, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x20,
+	0x54, 0x54, 0x54, 0x78, 0x00, 0x7f, 0x44, 0x44,
+	0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28,
+	0x00, 0x38, 0x44, 0x44, 0x44, 0x7f, 0x00, 0x38,
+	0x54, 0x54, 0x54, 0x08, 0x00, 0x08, 0x7e, 0x09,
+	0x09, 0x00, 0x00, 0x18, 0xa4, 0xa4, 0xa4, 0x7c,
+	0x00, 0x7f, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00,
+	0x00, 0x7d, 0x40, 0x00, 0x00, 0x40, 0x80, 0x84,
+	0x7d, 0x00, 0x00, 0x7f, 0x10, 0x28, 0x44, 0x00,
+	0x00, 0x00, 0x00, 0x7f, 0x40, 0x00, 0x00, 0x7c,
+	0x04, 0x18, 0x04, 0x78, 0x00, 0x7c, 0x04, 0x04,
+	0x78, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38,
+	0x00, 0xfc, 0x44, 0x44, 0x44, 0x38, 0x00, 0x38,
+	0x44, 0x44, 0x44, 0xfc, 0x00, 0x44, 0x78, 0x44,
+	0x04, 0x08, 0x00, 0x08, 0x54, 0x54, 0x54, 0x20,
+	0x00, 0x04, 0x3e, 0x44, 0x24, 0x00, 0x00, 0x3c,
+	0x40, 0x20, 0x7c, 0x00, 0x00, 0x1c, 0x20, 0x40,
+	0x20, 0x1c, 0x00, 0x3c, 0x60, 0x30, 0x60, 0x3c,
+	0x00, 0x6c, 0x10, 0x10, 0x6c, 0x00, 0x00, 0x9c,
+	0xa0, 0x60, 0x3c, 0x00, 0x00, 0x64, 0x54, 0x54,
+	0x4c, 0x00, 0x00, 0x08, 0x3e, 0x41, 0x41, 0x00,
+	0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00,
+	0x41, 0x41, 0x3e, 0x08, 0x00, 0x02, 0x01, 0x02,
+	0x01, 0x00, 0x00, 0x3c, 0x26, 0x23, 0x26, 0x3c
+};
+
+/* 8x8 */
+static const unsigned char medium[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7e, 0x81, 0x95, 0xb1, 0xb1, 0x95, 0x81, 0x7e,
+	0x7e, 0xff, 0xeb, 0xcf, 0xcf, 0xeb, 0xff, 0x7e,
+	0x0e, 0x1f, 0x3f, 0x7e, 0x3f, 0x1f, 0x0e, 0x00,
+	0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x08, 0x00,
+	0x38, 0x9a, 0x9f, 0xff, 0x9f, 0x9a, 0x38, 0x00,
+	0x10, 0xb8, 0xfc, 0xfe, 0xfc, 0xb8, 0x10, 0x00,
+	0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00,
+	0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff,
+	0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00,
+	0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff,
+	0x70, 0xf8, 0x88, 0x88, 0xfd, 0x7f, 0x07, 0x0f,
+	0x00, 0x4e, 0x5f, 0xf1, 0xf1, 0x5f, 0x4e, 0x00,
+	0xc0, 0xe0, 0xff, 0x7f, 0x05, 0x05, 0x07, 0x07,
+	0xc0, 0xff, 0x7f, 0x05, 0x05, 0x65, 0x7f, 0x3f,
+	0x99, 0x5a, 0x3c, 0xe7, 0xe7, 0x3c, 0x5a, 0x99,
+	0x7f, 0x3e, 0x3e, 0x1c, 0x1c, 0x08, 0x08, 0x00,
+	0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x7f, 0x00,
+	0x00, 0x24, 0x66, 0xff, 0xff, 0x66, 0x24, 0x00,
+	0x00, 0x5f, 0x5f, 0x00, 0x00, 0x5f, 0x5f, 0x00,
+	0x06, 0x0f, 0x09, 0x7f, 0x7f, 0x01, 0x7f, 0x7f,
+	0xc0, 0x9a, 0xbf, 0xa5, 0xbd, 0xd9, 0x43, 0x02,
+	0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00,
+	0x80, 0x94, 0xb6, 0xff, 0xff, 0xb6, 0x94, 0x80,
+	0x00, 0x04, 0x06, 0x7f, 0x7f, 0x06, 0x04, 0x00,
+	0x00, 0x10, 0x30, 0x7f, 0x7f, 0x30, 0x10, 0x00,
+	0x08, 0x08, 0x08, 0x2a, 0x3e, 0x1c, 0x08, 0x00,
+	0x08, 0x1c, 0x3e, 0x2a, 0x08, 0x08, 0x08, 0x00,
+	0x3c, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+	0x08, 0x1c, 0x3e, 0x08, 0x08, 0x3e, 0x1c, 0x08,
+	0x30, 0x38, 0x3c, 0x3e, 0x3e, 0x3c, 0x38, 0x30,
+	0x06, 0x0e, 0x1e, 0x3e, 0x3e, 0x1e, 0x0e, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x5f, 0x5f, 0x06, 0x00, 0x00,
+	0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00,
+	0x14, 0x7f, 0x7f, 0x14, 0x7f, 0x7f, 0x14, 0x00,
+	0x24, 0x2e, 0x2a, 0x6b, 0x6b, 0x3a, 0x12, 0x00,
+	0x46, 0x66, 0x30, 0x18, 0x0c, 0x66, 0x62, 0x00,
+	0x30, 0x7a, 0x4f, 0x5d, 0x37, 0x7a, 0x48, 0x00,
+	0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1c, 0x3e, 0x63, 0x41, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x63, 0x3e, 0x1c, 0x00, 0x00, 0x00,
+	0x08, 0x2a, 0x3e, 0x1c, 0x1c, 0x3e, 0x2a, 0x08,
+	0x00, 0x08, 0x08, 0x3e, 0x3e, 0x08, 0x08, 0x00,
+	0x00, 0x00, 0x80, 0xe0, 0x60, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+	0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x00,
+	0x3e, 0x7f, 0x59, 0x4d, 0x47, 0x7f, 0x3e, 0x00,
+	0x40, 0x42, 0x7f, 0x7f, 0x40, 0x40, 0x00, 0x00,
+	0x62, 0x73, 0x59, 0x49, 0x6f, 0x66, 0x00, 0x00,
+	0x22, 0x63, 0x49, 0x49, 0x7f, 0x36, 0x00, 0x00,
+	0x18, 0x1c, 0x16, 0x53, 0x7f, 0x7f, 0x50, 0x00,
+	0x27, 0x67, 0x45, 0x45, 0x7d, 0x39, 0x00, 0x00,
+	0x3c, 0x7e, 0x4b, 0x49, 0x79, 0x30, 0x00, 0x00,
+	0x03, 0x03, 0x71, 0x79, 0x0f, 0x07, 0x00, 0x00,
+	0x36, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x00, 0x00,
+	0x06, 0x4f, 0x49, 0x69, 0x3f, 0x1e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xe6, 0x66, 0x00, 0x00, 0x00,
+	0x08, 0x1c, 0x36, 0x63, 0x41, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
+	0x00, 0x41, 0x63, 0x36, 0x1c, 0x08, 0x00, 0x00,
+	0x00, 0x02, 0x03, 0x59, 0x5d, 0x07, 0x02, 0x00,
+	0x3e, 0x7f, 0x41, 0x5d, 0x5d, 0x5f, 0x0e, 0x00,
+	0x7c, 0x7e, 0x13, 0x13, 0x7e, 0x7c, 0x00, 0x00,
+	0x41, 0x7f, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x00,
+	0x1c, 0x3e, 0x63, 0x41, 0x41, 0x63, 0x22, 0x00,
+	0x41, 0x7f, 0x7f, 0x41, 0x63, 0x3e, 0x1c, 0x00,
+	0x41, 0x7f, 0x7f, 0x49, 0x5d, 0x41, 0x63, 0x00,
+	0x41, 0x7f, 0x7f, 0x49, 0x1d, 0x01, 0x03, 0x00,
+	0x1c, 0x3e, 0x63, 0x41, 0x51, 0x33, 0x72, 0x00,
+	0x7f, 0x7f, 0x08, 0x08, 0x7f, 0x7f, 0x00, 0x00,
+	0x00, 0x41, 0x7f, 0x7f, 0x41, 0x00, 0x00, 0x00,
+	0x30, 0x70, 0x40, 0x41, 0x7f, 0x3f, 0x01, 0x00,
+	0x41, 0x7f, 0x7f, 0x08, 0x1c, 0x77, 0x63, 0x00,
+	0x41, 0x7f, 0x7f, 0x41, 0x40, 0x60, 0x70, 0x00,
+	0x7f, 0x7f, 0x0e, 0x1c, 0x0e, 0x7f, 0x7f, 0x00,
+	0x7f, 0x7f, 0x06, 0x0c, 0x18, 0x7f, 0x7f, 0x00,
+	0x1c, 0x3e, 0x63, 0x41, 0x63, 0x3e, 0x1c, 0x00,
+	0x41, 0x7f, 0x7f, 0x49, 0x09, 0x0f, 0x06, 0x00,
+	0x1e, 0x3f, 0x21, 0x31, 0x61, 0x7f, 0x5e, 0x00,
+	0x41, 0x7f, 0x7f, 0x09, 0x19, 0x7f, 0x66, 0x00,
+	0x26, 0x6f, 0x4d, 0x49, 0x59, 0x73, 0x32, 0x00,
+	0x03, 0x41, 0x7f, 0x7f, 0x41, 0x03, 0x00, 0x00,
+	0x7f, 0x7f, 0x40, 0x40, 0x7f, 0x7f, 0x00, 0x00,
+	0x1f, 0x3f, 0x60, 0x60, 0x3f, 0x1f, 0x00, 0x00,
+	0x3f, 0x7f, 0x60, 0x30, 0x60, 0x7f, 0x3f, 0x00,
+	0x63, 0x77, 0x1c, 0x08, 0x1c, 0x77, 0x63, 0x00,
+	0x07, 0x4f, 0x78, 0x78, 0x4f, 0x07, 0x00, 0x00,
+	0x47, 0x63, 0x71, 0x59, 0x4d, 0x67, 0x73, 0x00,
+	0x00, 0x7f, 0x7f, 0x41, 0x41, 0x00, 0x00, 0x00,
+	0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x00,
+	0x00, 0x41, 0x41, 0x7f, 0x7f, 0x00, 0x00, 0x00,
+	0x08, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x08, 0x00,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x00, 0x03, 0x07, 0x04, 0x00, 0x00, 0x00,
+	0x20, 0x74, 0x54, 0x54, 0x3c, 0x78, 0x40, 0x00,
+	0x41, 0x7f, 0x3f, 0x48, 0x48, 0x78, 0x30, 0x00,
+	0x38, 0x7c, 0x44, 0x44, 0x6c, 0x28, 0x00, 0x00,
+	0x30, 0x78, 0x48, 0x49, 0x3f, 0x7f, 0x40, 0x00,
+	0x38, 0x7c, 0x54, 0x54, 0x5c, 0x18, 0x00, 0x00,
+	0x48, 0x7e, 0x7f, 0x49, 0x03, 0x06, 0x00, 0x00,
+	0x98, 0xbc, 0xa4, 0xa4, 0xf8, 0x7c, 0x04, 0x00,
+	0x41, 0x7f, 0x7f, 0x08, 0x04, 0x7c, 0x78, 0x00,
+	0x00, 0x44, 0x7d, 0x7d, 0x40, 0x00, 0x00, 0x00,
+	0x60, 0xe0, 0x80, 0x84, 0xfd, 0x7d, 0x00, 0x00,
+	0x41, 0x7f, 0x7f, 0x10, 0x38, 0x6c, 0x44, 0x00,
+	0x00, 0x41, 0x7f, 0x7f, 0x40, 0x00, 0x00, 0x00,
+	0x7c, 0x7c, 0x18, 0x78, 0x1c, 0x7c, 0x78, 0x00,
+	0x7c, 0x78, 0x04, 0x04, 0x7c, 0x78, 0x00, 0x00,
+	0x38, 0x7c, 0x44, 0x44, 0x7c, 0x38, 0x00, 0x00,
+	0x84, 0xfc, 0xf8, 0xa4, 0x24, 0x3c, 0x18, 0x00,
+	0x18, 0x3c, 0x24, 0xa4, 0xf8, 0xfc, 0x84, 0x00,
+	0x44, 0x7c, 0x78, 0x4c, 0x04, 0x0c, 0x18, 0x00,
+	0x48, 0x5c, 0x54, 0x74, 0x64, 0x24, 0x00, 0x00,
+	0x04, 0x04, 0x3e, 0x7f, 0x44, 0x24, 0x00, 0x00,
+	0x3c, 0x7c, 0x40, 0x40, 0x3c, 0x7c, 0x40, 0x00,
+	0x1c, 0x3c, 0x60, 0x60, 0x3c, 0x1c, 0x00, 0x00,
+	0x3c, 0x7c, 0x60, 0x30, 0x60, 0x7c, 0x3c, 0x00,
+	0x44, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0x44, 0x00,
+	0x9c, 0xbc, 0xa0, 0xa0, 0xfc, 0x7c, 0x00, 0x00,
+	0x4c, 0x64, 0x74, 0x5c, 0x4c, 0x64, 0x00, 0x00,
+	0x08, 0x08, 0x3e, 0x77, 0x41, 0x41, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00,
+	0x41, 0x41, 0x77, 0x3e, 0x08, 0x08, 0x00, 0x00,
+	0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x01, 0x00,
+	0x70, 0x78, 0x4c, 0x46, 0x4c, 0x78, 0x70, 0x00,
+	0x0e, 0x9f, 0x91, 0x91, 0xb1, 0xfb, 0x4a, 0x00,
+	0x3a, 0x7a, 0x40, 0x40, 0x3a, 0x7a, 0x40, 0x00,
+	0x38, 0x7c, 0x54, 0x55, 0x5d, 0x19, 0x00, 0x00,
+	0x02, 0x21, 0x75, 0x55, 0x55, 0x3d, 0x79, 0x42,
+	0x21, 0x75, 0x54, 0x54, 0x3d, 0x79, 0x40, 0x00,
+	0x21, 0x75, 0x55, 0x54, 0x3c, 0x78, 0x40, 0x00,
+	0x20, 0x74, 0x57, 0x57, 0x3c, 0x78, 0x40, 0x00,
+	0x18, 0x3c, 0xa4, 0xa4, 0xe4, 0x4c, 0x08, 0x00,
+	0x02, 0x39, 0x7d, 0x55, 0x55, 0x5d, 0x19, 0x02,
+	0x39, 0x7d, 0x54, 0x54, 0x5d, 0x19, 0x00, 0x00,
+	0x39, 0x7d, 0x55, 0x54, 0x5c, 0x18, 0x00, 0x00,
+	0x01, 0x45, 0x7c, 0x7c, 0x41, 0x01, 0x00, 0x00,
+	0x02, 0x01, 0x45, 0x7d, 0x7d, 0x41, 0x02, 0x00,
+	0x01, 0x45, 0x7d, 0x7c, 0x40, 0x00, 0x00, 0x00,
+	0x79, 0x7d, 0x14, 0x16, 0x14, 0x7d, 0x79, 0x00,
+	0x70, 0x78, 0x2b, 0x2b, 0x78, 0x70, 0x00, 0x00,
+	0x44, 0x7c, 0x7c, 0x55, 0x55, 0x45, 0x00, 0x00,
+	0x20, 0x74, 0x54, 0x54, 0x7c, 0x7c, 0x54, 0x54,
+	0x7c, 0x7e, 0x0b, 0x09, 0x7f, 0x7f, 0x49, 0x00,
+	0x32, 0x79, 0x49, 0x49, 0x79, 0x32, 0x00, 0x00,
+	0x32, 0x7a, 0x48, 0x48, 0x7a, 0x32, 0x00, 0x00,
+	0x32, 0x7a, 0x4a, 0x48, 0x78, 0x30, 0x00, 0x00,
+	0x3a, 0x79, 0x41, 0x41, 0x39, 0x7a, 0x40, 0x00,
+	0x3a, 0x7a, 0x42, 0x40, 0x38, 0x78, 0x40, 0x00,
+	0x9a, 0xba, 0xa0, 0xa0, 0xfa, 0x7a, 0x00, 0x00,
+	0x01, 0x19, 0x3c, 0x66, 0x66, 0x3c, 0x19, 0x01,
+	0x3d, 0x7d, 0x40, 0x40, 0x7d, 0x3d, 0x00, 0x00,
+	0x18, 0x3c, 0x24, 0xe7, 0xe7, 0x24, 0x24, 0x00,
+	0x68, 0x7e, 0x7f, 0x49, 0x43, 0x66, 0x20, 0x00,
+	0x53, 0x57, 0xfc, 0xfc, 0x57, 0x53, 0x00, 0x00,
+	0xff, 0xff, 0x09, 0x09, 0x2f, 0x76, 0xf8, 0xa0,
+	0x40, 0xc0, 0x88, 0xfe, 0x7f, 0x09, 0x03, 0x02,
+	0x20, 0x74, 0x54, 0x55, 0x3d, 0x79, 0x40, 0x00,
+	0x00, 0x44, 0x7d, 0x7d, 0x41, 0x00, 0x00, 0x00,
+	0x30, 0x78, 0x48, 0x4a, 0x7a, 0x32, 0x00, 0x00,
+	0x38, 0x78, 0x40, 0x42, 0x3a, 0x7a, 0x40, 0x00,
+	0x7a, 0x72, 0x0a, 0x0a, 0x7a, 0x70, 0x00, 0x00,
+	0x7d, 0x7d, 0x19, 0x31, 0x7d, 0x7d, 0x00, 0x00,
+	0x00, 0x26, 0x2f, 0x29, 0x2f, 0x2f, 0x28, 0x00,
+	0x00, 0x26, 0x2f, 0x29, 0x2f, 0x26, 0x00, 0x00,
+	0x00, 0x20, 0x70, 0x5d, 0x4d, 0x60, 0x20, 0x00,
+	0x38, 0x38, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+	0x08, 0x08, 0x08, 0x08, 0x38, 0x38, 0x00, 0x00,
+	0x67, 0x37, 0x18, 0x0c, 0x96, 0xcb, 0xb9, 0x90,
+	0x4f, 0x6f, 0x30, 0x18, 0x6c, 0x76, 0xdb, 0xf9,
+	0x00, 0x00, 0x30, 0x7d, 0x7d, 0x30, 0x00, 0x00,
+	0x08, 0x1c, 0x36, 0x22, 0x08, 0x1c, 0x36, 0x22,
+	0x22, 0x36, 0x1c, 0x08, 0x22, 0x36, 0x1c, 0x08,
+	0xaa, 0x00, 0x55, 0x00, 0xaa, 0x00, 0x55, 0x00,
+	0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+	0xd7, 0xff, 0xaa, 0x77, 0xbd, 0xea, 0x7f, 0xdd,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x10, 0x10, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x14, 0x14, 0x14, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x10, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
+	0x10, 0x10, 0xf0, 0xf0, 0x10, 0xf0, 0xf0, 0x00,
+	0x14, 0x14, 0x14, 0xfc, 0xfc, 0x00, 0x00, 0x00,
+	0x14, 0x14, 0xf7, 0xf7, 0x00, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
+	0x14, 0x14, 0xf4, 0xf4, 0x04, 0xfc, 0xfc, 0x00,
+	0x14, 0x14, 0x17, 0x17, 0x10, 0x1f, 0x1f, 0x00,
+	0x10, 0x10, 0x1f, 0x1f, 0x10, 0x1f, 0x1f, 0x00,
+	0x14, 0x14, 0x14, 0x1f, 0x1f, 0x00, 0x00, 0x00,
+	0x10, 0x10, 0x10, 0xf0, 0xf0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0x1f, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x1f, 0x1f, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0xf0, 0xf0, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0xff, 0xff, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0x14, 0x14, 0x14,
+	0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10,
+	0x00, 0x00, 0x1f, 0x1f, 0x10, 0x17, 0x17, 0x14,
+	0x00, 0x00, 0xfc, 0xfc, 0x04, 0xf4, 0xf4, 0x14,
+	0x14, 0x14, 0x17, 0x17, 0x10, 0x17, 0x17, 0x14,
+	0x14, 0x14, 0xf4, 0xf4, 0x04, 0xf4, 0xf4, 0x14,
+	0x00, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xf7, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x14, 0x14, 0xf7, 0xf7, 0x00, 0xf7, 0xf7, 0x14,
+	0x14, 0x14, 0x14, 0x17, 0x17, 0x14, 0x14, 0x14,
+	0x10, 0x10, 0x1f, 0x1f, 0x10, 0x1f, 0x1f, 0x10,
+	0x14, 0x14, 0x14, 0xf4, 0xf4, 0x14, 0x14, 0x14,
+	0x10, 0x10, 0xf0, 0xf0, 0x10, 0xf0, 0xf0, 0x10,
+	0x00, 0x00, 0x1f, 0x1f, 0x10, 0x1f, 0x1f, 0x10,
+	0x00, 0x00, 0x00, 0x1f, 0x1f, 0x14, 0x14, 0x14,
+	0x00, 0x00, 0x00, 0xfc, 0xfc, 0x14, 0x14, 0x14,
+	0x00, 0x00, 0xf0, 0xf0, 0x10, 0xf0, 0xf0, 0x10,
+	0x10, 0x10, 0xff, 0xff, 0x10, 0xff, 0xff, 0x10,
+	0x14, 0x14, 0x14, 0xff, 0xff, 0x14, 0x14, 0x14,
+	0x10, 0x10, 0x10, 0x1f, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xf0, 0xf0, 0x10, 0x10, 0x10,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x38, 0x7c, 0x44, 0x6c, 0x38, 0x6c, 0x44, 0x00,
+	0xfc, 0xfe, 0x2a, 0x2a, 0x3e, 0x14, 0x00, 0x00,
+	0x7e, 0x7e, 0x02, 0x02, 0x06, 0x06, 0x00, 0x00,
+	0x04, 0x7c, 0x7c, 0x04, 0x7c, 0x7c, 0x04, 0x00,
+	0x63, 0x77, 0x5d, 0x49, 0x63, 0x63, 0x00, 0x00,
+	0x38, 0x7c, 0x44, 0x7c, 0x3c, 0x04, 0x04, 0x00,
+	0x80, 0xfe, 0x7e, 0x20, 0x20, 0x3e, 0x1e, 0x00,
+	0x04, 0x06, 0x02, 0x7e, 0x7c, 0x06, 0x02, 0x00,
+	0x99, 0xbd, 0xe7, 0xe7, 0xbd, 0x99, 0x00, 0x00,
+	0x1c, 0x3e, 0x6b, 0x49, 0x6b, 0x3e, 0x1c, 0x00,
+	0x4c, 0x7e, 0x73, 0x01, 0x73, 0x7e, 0x4c, 0x00,
+	0x30, 0x78, 0x4a, 0x4f, 0x7d, 0x39, 0x00, 0x00,
+	0x18, 0x3c, 0x24, 0x3c, 0x3c, 0x24, 0x3c, 0x18,
+	0x98, 0xfc, 0x64, 0x3c, 0x3e, 0x27, 0x3d, 0x18,
+	0x1c, 0x3e, 0x6b, 0x49, 0x49, 0x00, 0x00, 0x00,
+	0x7e, 0x7f, 0x01, 0x01, 0x7f, 0x7e, 0x00, 0x00,
+	0x00, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x00,
+	0x00, 0x44, 0x44, 0x5f, 0x5f, 0x44, 0x44, 0x00,
+	0x40, 0x51, 0x5b, 0x4e, 0x44, 0x40, 0x00, 0x00,
+	0x40, 0x44, 0x4e, 0x5b, 0x51, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x07, 0x06,
+	0x60, 0xe0, 0x80, 0xff, 0x7f, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x08, 0x6b, 0x6b, 0x08, 0x08, 0x00,
+	0x24, 0x36, 0x12, 0x36, 0x24, 0x36, 0x12, 0x00,
+	0x00, 0x06, 0x0f, 0x09, 0x0f, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00,
+	0x10, 0x30, 0x70, 0xc0, 0xff, 0xff, 0x01, 0x01,
+	0x00, 0x1f, 0x1e, 0x01, 0x1f, 0x1e, 0x00, 0x00,
+	0x12, 0x19, 0x1d, 0x17, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7e, 0x81, 0xa5, 0x81, 0x81, 0xbd, 0x99, 0x81,
+	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff,
+	0xdb, 0xff, 0xff, 0xc3, 0xe7, 0xff, 0x7e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xfe, 0xfe,
+	0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x7c,
+	0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x3c, 0x3c, 0xe7, 0xe7, 0xe7, 0x99, 0x18,
+	0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c,
+	0x7e, 0xff, 0xff, 0x7e, 0x18, 0x18, 0x3c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0xc3,
+	0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x1e, 0x0e, 0x1a, 0x32,
+	0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x18,
+	0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0x33, 0x3f, 0x30, 0x30, 0x30, 0x70, 0xf0,
+	0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x63,
+	0x7f, 0x63, 0x63, 0x63, 0x67, 0xe7, 0xe6, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0xdb, 0x3c,
+	0xe7, 0x3c, 0xdb, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf8, 0xfe, 0xf8,
+	0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x06, 0x0e, 0x3e, 0xfe, 0x3e, 0x0e, 0x06,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c,
+	0x7e, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b,
+	0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x7c,
+	0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38,
+	0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18,
+	0x18, 0x18, 0x7e, 0x3c, 0x18, 0x7e, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x0c, 0xfe, 0x0c, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60,
+	0xfe, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0,
+	0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x28, 0x6c, 0xfe, 0x6c, 0x28, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x38, 0x38, 0x7c, 0x7c, 0xfe, 0xfe, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x7c,
+	0x7c, 0x38, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 0x00, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66,
+	0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0xfe, 0x6c,
+	0x6c, 0x6c, 0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x7c, 0xc6, 0xc2, 0xc0, 0x7c, 0x06,
+	0x86, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc2, 0xc6, 0x0c, 0x18, 0x30, 0x66,
+	0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c,
+	0x6c, 0x38, 0x76, 0xdc, 0xcc, 0xcc, 0x76, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x18,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0c, 0x18,
+	0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x38, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6,
+	0x06, 0x0c, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06,
+	0x3c, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x1c, 0x3c, 0x6c, 0xcc, 0xfe,
+	0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xc0, 0xc0, 0xfc, 0x0e, 0x06, 0x06, 0xc6,
+	0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x60,
+	0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0x06, 0x0c,
+	0x18, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7c, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x0c,
+	0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x30,
+	0x18, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30,
+	0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x0c,
+	0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xde, 0xde, 0xde,
+	0xdc, 0xc0, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6,
+	0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66,
+	0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0xfc, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0,
+	0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66,
+	0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x66,
+	0x62, 0x68, 0x78, 0x68, 0x60, 0x60, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0,
+	0xc0, 0xde, 0xc6, 0x66, 0x3a, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x6c, 0x6c,
+	0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6,
+	0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe6,
+	0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6,
+	0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60,
+	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xde, 0x7c,
+	0x0c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66,
+	0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0xe6, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60,
+	0x38, 0x0c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6,
+	0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6,
+	0xd6, 0xd6, 0xfe, 0x7c, 0x6c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x38, 0x38, 0x38,
+	0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18,
+	0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6,
+	0x8c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x3c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
+	0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x3c, 0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc,
+	0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x60,
+	0x60, 0x78, 0x6c, 0x66, 0x66, 0x66, 0xdc, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
+	0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc6,
+	0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c,
+	0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76,
+	0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00,
+	0x00, 0x00, 0xe0, 0x60, 0x60, 0x6c, 0x76, 0x66,
+	0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18,
+	0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,
+	0x00, 0x0e, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66,
+	0x3c, 0x00, 0x00, 0x00, 0xe0, 0x60, 0x60, 0x66,
+	0x6c, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6, 0xd6, 0xd6,
+	0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
+	0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66,
+	0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0x7c,
+	0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xdc, 0x76, 0x62, 0x60, 0x60, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
+	0xc6, 0x70, 0x1c, 0xc6, 0x7c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30,
+	0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+	0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6,
+	0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38,
+	0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e,
+	0x06, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0xcc, 0x18, 0x30, 0x66, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x18, 0x18,
+	0x70, 0x18, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x18, 0x18, 0x18, 0x0e, 0x18, 0x18, 0x18,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38,
+	0x6c, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc2,
+	0x66, 0x3c, 0x0c, 0x06, 0x7c, 0x00, 0x00, 0x00,
+	0xcc, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+	0x76, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30,
+	0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0x00, 0x78,
+	0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xcc, 0xcc, 0x00, 0x78, 0x0c, 0x7c,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x60,
+	0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc,
+	0x76, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c, 0x38,
+	0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66,
+	0x60, 0x66, 0x3c, 0x0c, 0x06, 0x3c, 0x00, 0x00,
+	0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe,
+	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xcc, 0xcc, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc6,
+	0x7c, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x18,
+	0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x38,
+	0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x60,
+	0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18,
+	0x3c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x10,
+	0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00,
+	0x00, 0x00, 0x38, 0x6c, 0x38, 0x00, 0x38, 0x6c,
+	0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00, 0x00, 0x00,
+	0x18, 0x30, 0x60, 0x00, 0xfe, 0x66, 0x60, 0x7c,
+	0x60, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xcc, 0x76, 0x36, 0x7e, 0xd8, 0xd8,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x6c,
+	0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xce, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c,
+	0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc6, 0xc6, 0x00, 0x7c, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x60,
+	0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6,
+	0x7c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0xcc,
+	0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00,
+	0x00, 0x00, 0x00, 0x60, 0x30, 0x18, 0x00, 0xcc,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc6, 0xc6, 0x00, 0xc6, 0xc6, 0xc6,
+	0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00, 0x00, 0xc6,
+	0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x00,
+	0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0,
+	0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60,
+	0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xcc, 0xcc,
+	0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xc6, 0x00,
+	0x00, 0x00, 0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18,
+	0x7e, 0x18, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00,
+	0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x0c,
+	0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18,
+	0x3c, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x60,
+	0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x30, 0x60, 0x00, 0xcc,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x76, 0xdc,
+	0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6,
+	0xc6, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x6c, 0x6c,
+	0x3e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc6, 0xcc, 0xd8,
+	0x30, 0x60, 0xce, 0x93, 0x06, 0x0c, 0x1f, 0x00,
+	0x00, 0xc0, 0xc0, 0xc6, 0xcc, 0xd8, 0x30, 0x66,
+	0xce, 0x9a, 0x3f, 0x06, 0x0f, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x3c,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66,
+	0x33, 0x66, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
+	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x55, 0xaa,
+	0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
+	0x55, 0xaa, 0x55, 0xaa, 0xdd, 0x77, 0xdd, 0x77,
+	0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77,
+	0xdd, 0x77, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,
+	0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8,
+	0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7c, 0xc6, 0xfc, 0xc6, 0xc6, 0xfc,
+	0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xfe, 0xc6,
+	0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x30,
+	0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66,
+	0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x6c,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c,
+	0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0xee, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c,
+	0x3e, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb,
+	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x06, 0x7e, 0xcf, 0xdb, 0xf3, 0x7e, 0x60,
+	0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x30,
+	0x60, 0x60, 0x7c, 0x60, 0x60, 0x30, 0x1c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6,
+	0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+	0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00,
+	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18,
+	0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60,
+	0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc,
+	0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0xec, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00,
+	0x00, 0xd8, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x98, 0x30, 0x60, 0xc8, 0xf8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7e, 0x81, 0xa5, 0x81, 0x81, 0xbd, 0x99,
+	0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7e, 0xff, 0xdb, 0xff, 0xff, 0xc3, 0xe7,
+	0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x6c, 0xfe, 0xfe, 0xfe, 0xfe,
+	0x7c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x7c,
+	0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x3c, 0x3c, 0xe7, 0xe7, 0xe7,
+	0x99, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x7e,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0xc3,
+	0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x42, 0x42,
+	0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xc3, 0x99, 0xbd, 0xbd,
+	0x99, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x1e, 0x0e, 0x1a, 0x32, 0x78, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18,
+	0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3f, 0x33, 0x3f, 0x30, 0x30, 0x30, 0x30,
+	0x70, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7f, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63,
+	0x67, 0xe7, 0xe6, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0xdb, 0x3c, 0xe7, 0x3c,
+	0xdb, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfe, 0xf8, 0xf0,
+	0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x06, 0x0e, 0x1e, 0x3e, 0xfe, 0x3e, 0x1e,
+	0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18,
+	0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b,
+	0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c,
+	0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18,
+	0x7e, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0xfe, 0x0c,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0xfe, 0x60,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x6c, 0xfe, 0x6c,
+	0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x7c, 0x7c,
+	0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xfe, 0xfe, 0x7c, 0x7c, 0x38,
+	0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 0x18,
+	0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x66, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x6c, 0x6c, 0xfe, 0x6c, 0x6c, 0x6c,
+	0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x7c, 0xc6, 0xc2, 0xc0, 0x7c, 0x06, 0x86,
+	0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xc2, 0xc6, 0x0c, 0x18, 0x30,
+	0x60, 0xc6, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x6c, 0x6c, 0x38, 0x76, 0xdc, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x30, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x66, 0x3c, 0xff, 0x3c,
+	0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x06, 0x0c, 0x18, 0x30,
+	0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7c, 0xc6, 0xc6, 0xce, 0xd6, 0xd6, 0xe6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x38, 0x78, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7c, 0xc6, 0x06, 0x0c, 0x18, 0x30, 0x60,
+	0xc0, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3c, 0x06, 0x06,
+	0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x1c, 0x3c, 0x6c, 0xcc, 0xfe, 0x0c,
+	0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xfc, 0x0e, 0x06,
+	0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x60, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0xc6, 0x06, 0x06, 0x0c, 0x18, 0x30,
+	0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06,
+	0x06, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x30,
+	0x18, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+	0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x0c,
+	0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7c, 0xc6, 0xc6, 0x0c, 0x18, 0x18, 0x18,
+	0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xde, 0xde, 0xde,
+	0xdc, 0xc0, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66,
+	0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60,
+	0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60,
+	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde, 0xc6,
+	0xc6, 0x66, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc,
+	0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xe6, 0x66, 0x6c, 0x6c, 0x78, 0x78, 0x6c,
+	0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60,
+	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	0xd6, 0xde, 0x7c, 0x0c, 0x0e, 0x00, 0x00, 0x00,
+	0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66,
+	0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	0x6c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6,
+	0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xc6, 0x6c, 0x6c, 0x38, 0x38, 0x6c,
+	0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60,
+	0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
+	0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x30,
+	0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xe0, 0x60, 0x60, 0x78, 0x6c, 0x66, 0x66,
+	0x66, 0x66, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0,
+	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
+	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60,
+	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00, 0x00,
+	0x00, 0xe0, 0x60, 0x60, 0x6c, 0x76, 0x66, 0x66,
+	0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x06, 0x00, 0x0e, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x66, 0x66, 0x3c, 0x00, 0x00,
+	0x00, 0xe0, 0x60, 0x60, 0x66, 0x6c, 0x78, 0x78,
+	0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6, 0xd6,
+	0xd6, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x7c, 0x0c, 0x0c, 0x1e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x62, 0x60,
+	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60, 0x38,
+	0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30,
+	0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xd6,
+	0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38,
+	0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xcc, 0x18, 0x30,
+	0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x18, 0x18, 0x18, 0x70, 0x18, 0x18,
+	0x18, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x18, 0x18, 0x18, 0x0e, 0x18, 0x18,
+	0x18, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6,
+	0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc2,
+	0x66, 0x3c, 0x0c, 0x06, 0x7c, 0x00, 0x00, 0x00,
+	0x00, 0xcc, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
+	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xcc, 0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x3c, 0x66, 0x60, 0x60, 0x66,
+	0x3c, 0x0c, 0x06, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
+	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xc6, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
+	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
+	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x66, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc6, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x38,
+	0x6c, 0x38, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x30, 0x60, 0x00, 0xfe, 0x66, 0x60, 0x7c, 0x60,
+	0x60, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x76, 0x36, 0x7e,
+	0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc,
+	0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc6, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00, 0x00,
+	0xc6, 0xc6, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6,
+	0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc6, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x3c, 0x66, 0x60, 0x60, 0x60, 0x66,
+	0x3c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60,
+	0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc,
+	0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00,
+	0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
+	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x76,
+	0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0,
+	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06,
+	0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc2, 0xc6, 0xcc, 0x18, 0x30, 0x60,
+	0xce, 0x93, 0x06, 0x0c, 0x1f, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc2, 0xc6, 0xcc, 0x18, 0x30, 0x66,
+	0xce, 0x9a, 0x3f, 0x06, 0x0f, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c,
+	0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x33, 0x66, 0xcc, 0x66,
+	0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x33, 0x66,
+	0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11,
+	0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x55,
+	0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+	0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0xdd,
+	0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd,
+	0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8,
+	0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0xc6, 0xfc, 0xc6,
+	0xc6, 0xfc, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xfe, 0x6c, 0x6c, 0x6c,
+	0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x30,
+	0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8,
+	0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x7c, 0x60, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66,
+	0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6,
+	0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c,
+	0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66,
+	0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb,
+	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x06, 0x7e, 0xcf, 0xdb, 0xf3,
+	0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60,
+	0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+	0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18,
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18,
+	0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18,
+	0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8,
+	0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7e, 0x00,
+	0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76,
+	0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c,
+	0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xd8, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x98, 0x30, 0x60, 0xc8, 0xf8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+	0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/* 16x24 */
+static const unsigned char large[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0x03, 0x03, 0x33, 0x33, 0x03, 0x03,
+	0x03, 0x03, 0x33, 0x33, 0x03, 0x03, 0xfc, 0xfc,
+	0xff, 0xff, 0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00, 0xff, 0xff,
+	0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0xcf, 0xcf, 0xff, 0xff,
+	0xff, 0xff, 0xcf, 0xcf, 0xff, 0xff, 0xfc, 0xfc,
+	0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xc3, 0xc3,
+	0xc3, 0xc3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff,
+	0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
+	0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc,
+	0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0x3f, 0x3f, 0x3f, 0x3f, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x3f, 0x3f, 0x3f, 0x3f, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc,
+	0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
+	0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f, 0xff, 0xff,
+	0xff, 0xff, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xff, 0xff,
+	0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0x00, 0x00,
+	0x00, 0x00, 0xc3, 0xc3, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xc3, 0xc3, 0x00, 0x00,
+	0x00, 0x00, 0xc3, 0xc3, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x3f, 0x3f,
+	0x3f, 0x3f, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x3c, 0x3c, 0xff, 0xff,
+	0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc,
+	0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0xc3, 0xc3, 0xcf, 0xcf, 0xfc, 0xfc,
+	0xfc, 0xfc, 0xcf, 0xcf, 0xc3, 0xc3, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f,
+	0x00, 0x00, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff,
+	0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xfc, 0xfc,
+	0xfc, 0xfc, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x3f, 0x3f, 0xf3, 0xf3,
+	0xf3, 0xf3, 0x3f, 0x3f, 0xcc, 0xcc, 0xcc, 0xcc,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xf0, 0xf0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f,
+	0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
+	0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0xff, 0xff,
+	0xff, 0xff, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff,
+	0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0xff, 0xff,
+	0xff, 0xff, 0x03, 0x03, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xcf, 0xcf, 0xfc, 0xfc, 0x30, 0x30,
+	0xf0, 0xf0, 0xc3, 0xc3, 0x03, 0x03, 0x00, 0x00,
+	0x0f, 0x0f, 0x3f, 0x3f, 0xf0, 0xf0, 0xc0, 0xc0,
+	0xf0, 0xf0, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00,
+	0x0c, 0x0c, 0x3c, 0x3c, 0x30, 0x30, 0x30, 0x30,
+	0x33, 0x33, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0xff, 0xff,
+	0xff, 0xff, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff,
+	0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x30, 0x33, 0x33, 0x3f, 0x3f,
+	0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0xff, 0xff,
+	0xff, 0xff, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff,
+	0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc,
+	0xff, 0xff, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x3f, 0x3f, 0xff, 0xff, 0xcc, 0xcc,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x3f, 0x3f, 0xff, 0xff, 0x0c, 0x0c,
+	0xff, 0xff, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xff, 0xff,
+	0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
+	0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0,
+	0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00,
+	0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0,
+	0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0,
+	0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00,
+	0xf0, 0xf0, 0xc3, 0xc3, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f,
+	0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3c, 0x3c, 0xff, 0xff, 0xc3, 0xc3,
+	0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x0f, 0x0f,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
+	0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x0c, 0x0c, 0xcc, 0xcc, 0xff, 0xff, 0x3f, 0x3f,
+	0x3f, 0x3f, 0xff, 0xff, 0xcc, 0xcc, 0x0c, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0xff,
+	0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0xc3, 0xc3, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x30, 0x30, 0x0f, 0x0f,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03,
+	0xc3, 0xc3, 0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00,
+	0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0x0f, 0x0f,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x0f, 0x0f, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xfc, 0xfc, 0x0f, 0x0f, 0x03, 0x03,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0,
+	0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0,
+	0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	0xf0, 0xf0, 0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x3f, 0xf3, 0xf3,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+	0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xf0, 0xf0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	0xf3, 0xf3, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x3c, 0x3f, 0x3f, 0x03, 0x03, 0x03, 0x03,
+	0xc3, 0xc3, 0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
+	0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0x0f, 0x0f,
+	0x3c, 0x3c, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xfc, 0xfc, 0x0f, 0x0f, 0x03, 0x03,
+	0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x0f, 0x0f, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0xc3, 0xc3, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x0f, 0x0f, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0xc3, 0xc3, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xfc, 0xfc, 0x0f, 0x0f, 0x03, 0x03,
+	0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x0c,
+	0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x03, 0x03, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xff, 0xff,
+	0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f,
+	0x3f, 0x3f, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xf0, 0xf0,
+	0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0x03,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xf0, 0xf0,
+	0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0x03,
+	0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xfc, 0xfc, 0x0f, 0x0f, 0x03, 0x03,
+	0x0f, 0x0f, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xc0, 0xc0,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0f, 0x0f,
+	0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x3c, 0xff, 0xff, 0xc3, 0xc3, 0x03, 0x03,
+	0x03, 0x03, 0x3f, 0x3f, 0x3c, 0x3c, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0x03, 0x03, 0x03,
+	0x0f, 0x0f, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0xff, 0xff,
+	0xff, 0xff, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x3f, 0x3f, 0xff, 0xff, 0xc0, 0xc0, 0x00, 0x00,
+	0xc0, 0xc0, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xfc, 0xfc,
+	0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00,
+	0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f,
+	0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xff, 0xff,
+	0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03,
+	0xc3, 0xc3, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
+	0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0x0f, 0x0f,
+	0x03, 0x03, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f,
+	0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc3, 0xc3,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03,
+	0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xc3, 0xc3, 0xcf, 0xcf, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xcf, 0xcf,
+	0xcf, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xcf, 0xcf, 0xcf, 0xcf, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c,
+	0xff, 0xff, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0xff, 0xff,
+	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
+	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30,
+	0xf0, 0xf0, 0xc3, 0xc3, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0xff, 0xff,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc,
+	0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0xcc, 0xcc, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+	0x03, 0x03, 0xc3, 0xc3, 0xf0, 0xf0, 0x3c, 0x3c,
+	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+	0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff,
+	0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+	0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff,
+	0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+	0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f,
+	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
+	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x3c, 0x3c, 0x3c, 0x3c, 0xf0, 0x0c, 0xf0, 0x0c,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x0c, 0xf0, 0x0c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x00, 0xf0, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+	0x00, 0x3c, 0x00, 0x3c, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xfc, 0xff, 0xfc,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xfc, 0xff, 0xfc,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x3c, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x3f, 0x3c, 0x3f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x3f, 0xfc, 0x3f, 0xfc,
+	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
+	0x3c, 0xfc, 0x3c, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0xfc, 0x0f, 0xfc,
+	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xfc, 0xff, 0xfc,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xfc, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x0f, 0x00, 0x3f, 0xc0, 0x3f, 0xc0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x3c, 0x00, 0x3c,
+	0x00, 0xf0, 0x00, 0xf0, 0x3f, 0xc0, 0x3f, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0x30, 0x3c, 0x30, 0x3c, 0x00, 0x3c, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x3c, 0xfc, 0x3c,
+	0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
+	0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xc0, 0xff, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xc0, 0xff, 0xc0,
+	0xf0, 0x30, 0xf0, 0x30, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf3, 0xfc, 0xf3, 0xfc, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfc, 0x00, 0xfc, 0x03, 0xcf, 0x03, 0xcf,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
+	0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
+	0xf3, 0xf0, 0xf3, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0xf3, 0xf0, 0xf3, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
+	0xf3, 0xf0, 0xf3, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xfc, 0x3c, 0xfc, 0x3c,
+	0xff, 0x3c, 0xff, 0x3c, 0xff, 0xfc, 0xff, 0xfc,
+	0xf3, 0xfc, 0xf3, 0xfc, 0xf0, 0xfc, 0xf0, 0xfc,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xfc, 0x0f, 0xfc,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x3f, 0xfc,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+	0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+	0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x0c, 0xf0, 0x0c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0xf0, 0xfc, 0xf0, 0xfc, 0xc3, 0x0f, 0xc3, 0x0f,
+	0x00, 0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0,
+	0x03, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x0c, 0xf0, 0x0c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+	0xf0, 0xfc, 0xf0, 0xfc, 0xc3, 0xcc, 0xc3, 0xcc,
+	0x0f, 0xff, 0x0f, 0xff, 0x00, 0x3c, 0x00, 0x3c,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x3c, 0x3c, 0x3c, 0x3c,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x3c, 0x3c, 0x3c, 0x3c,
+	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
+	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
+	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
+	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
+	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
+	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
+	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
+	0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
+	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
+	0xcc, 0xcc, 0xcc, 0xcc, 0xf3, 0xf3, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
+	0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0xff, 0x3c, 0xff, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfc, 0xff, 0xfc, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0xff, 0x3c, 0xff, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+	0xff, 0x3c, 0xff, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x3c, 0x00, 0x3c,
+	0xff, 0x3c, 0xff, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0xff, 0x3c, 0xff, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x00, 0x0f, 0x00,
+	0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x00, 0x0f, 0x00,
+	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0xff, 0x3f, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x3f, 0xff, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x00, 0x0f, 0x00,
+	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0xff, 0x3f, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x3f, 0xff, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0xff, 0xff, 0xff, 0xff, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
+	0x0f, 0x3c, 0x0f, 0x3c, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0x3c, 0x3f, 0x3c, 0xf3, 0xf0, 0xf3, 0xf0,
+	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
+	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xf0, 0xf3, 0xf0,
+	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf0, 0xff, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xff, 0xf0, 0xff, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xf0, 0xff, 0xf0,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+	0xff, 0xfc, 0xff, 0xfc, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xfc, 0x3f, 0xfc, 0xf3, 0xc0, 0xf3, 0xc0,
+	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
+	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
+	0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x3c, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
+	0xf3, 0xf0, 0xf3, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xfc, 0x3f, 0xfc, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x03, 0xfc,
+	0x0f, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x00, 0xf0, 0x00, 0xf0, 0x0f, 0xfc, 0x0f, 0xfc,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xfc, 0x3f, 0xfc, 0xf3, 0xcf, 0xf3, 0xcf,
+	0xf3, 0xcf, 0xf3, 0xcf, 0xf3, 0xcf, 0xf3, 0xcf,
+	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c,
+	0x3f, 0xfc, 0x3f, 0xfc, 0xf0, 0xff, 0xf0, 0xff,
+	0xf3, 0xcf, 0xf3, 0xcf, 0xff, 0x0f, 0xff, 0x0f,
+	0x3f, 0xfc, 0x3f, 0xfc, 0x3c, 0x00, 0x3c, 0x00,
+	0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x03, 0xf0,
+	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x03, 0xf0, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x00, 0xf0, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0x3c,
+	0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0x0f, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc,
+	0x03, 0xcf, 0x03, 0xcf, 0x03, 0xcf, 0x03, 0xcf,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
+	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
+	0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0x3c, 0x3f, 0x3c, 0xf3, 0xf0, 0xf3, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
+	0xf3, 0xf0, 0xf3, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xf0, 0x00, 0xf0,
+	0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+	0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+	0xfc, 0xf0, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0,
+	0x03, 0xf0, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf3, 0xc0, 0xf3, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x3f, 0x00, 0xc3, 0xc0, 0xc3, 0xc0,
+	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+	0xf0, 0xc0, 0xf0, 0xc0, 0xff, 0xc0, 0xff, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+	0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00
+};
+
+struct source {
+	const char *name;
+	const char *upper;
+	const unsigned char *table;
+	unsigned size;
+	unsigned width;		/* columns */
+	unsigned pages;		/* page rows used */
+	unsigned stride;	/* bytes per glyph in the table */
+	unsigned glyphs;
+};
+
+static const struct source sources[] = {
+	{ "small", "SMALL", small, sizeof(small), 6, 1, 6, sizeof(small) / 6 },
+	{ "medium", "MEDIUM", medium, sizeof(medium), 8, 1, 8, 256 },
+	/* A fourth page row is there, but only three are used. */
+	{ "large", "LARGE", large, sizeof(large), 16, 3, 64, 256 }
+};
+
+/*
+  ------------------------------------------------------------------------------
+  generate
+*/
+
+static void
+generate(const struct source *source)
+{
+	unsigned glyph;
+	unsigned column;
+	unsigned page;
+	unsigned n = 0;
+
+	printf("\n#define OLED_FONT_%s_GLYPHS %u\n\n",
+	       source->upper, source->glyphs);
+	printf("static const unsigned char oled_font_%s[%u] = {",
+	       source->name, source->glyphs * source->width * source->pages);
+
+	for (glyph = 0; glyph < source->glyphs; ++glyph) {
+		const unsigned char *in = &source->table[glyph * source->stride];
+
+		for (column = 0; column < source->width; ++column) {
+			for (page = 0; page < source->pages; ++page) {
+				printf("%s0x%02x", (0 == n) ? "\n\t" :
+				       (0 == n % 8) ? ",\n\t" : ", ",
+				       in[(page * source->width) + column]);
+				++n;
+			}
+		}
+	}
+
+	printf("\n};\n");
+}
+
+/*
+  ==============================================================================
+  Public
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  main
+*/
+
+int
+main(void)
+{
+	unsigned i;
+
+	printf("/*\n"
+	       "  fonts.h\n"
+	       "\n"
+	       "  Generated by fontgen, don't edit.\n"
+	       "*/\n");
+
+	for (i = 0; i < sizeof(sources) / sizeof(sources[0]); ++i) {
+		if (sources[i].glyphs * sources[i].stride > sources[i].size) {
+			fprintf(stderr, "%s:%d - %s table is short\n",
+				__FILE__, __LINE__, sources[i].name);
+
+			return EXIT_FAILURE;
+		}
+
+		generate(&sources[i]);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,783 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  http.c
+
+  The web user interface, see http.h.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <time.h>
+#include <math.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "pimount.h"
+#include "stats.h"
+#include "timespec.h"
+#include "telemetry.h"
+#include "fan.h"
+#include "http.h"
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Private
+  ==============================================================================
+  ==============================================================================
+*/
+
+/* Send a comment this often (in ms) if nothing changes. */
+#define HTTP_KEEPALIVE 15000
+
+/*
+  The telemetry fields.  Values are compared as formatted, so changes
+  smaller than the displayed resolution are never sent.
+*/
+
+enum http_field {
+	HTTP_FIELD_CONTROL,
+	HTTP_FIELD_RA,
+	HTTP_FIELD_DEC,
+	HTTP_FIELD_TEMP,
+	HTTP_FIELD_LOAD,
+	HTTP_FIELD_CORES,	/* busy percent, for each core */
+	HTTP_FIELD_IRQS,	/* interrupts per second, for each core */
+	HTTP_FIELD_FAN,		/* duty, percent */
+	HTTP_FIELD_FAN_ERROR,	/* degrees over the setpoint */
+	HTTP_FIELD_FAN_INTEGRAL, /* the controller's terms, see fan.h */
+	HTTP_FIELD_FAN_OUTPUT,
+	HTTP_FIELDS
+};
+
+static const char *http_field_names[HTTP_FIELDS] = {
+	"control", "ra", "dec", "temp", "load", "cores", "irqs",
+	"fan", "fan_error", "fan_integral", "fan_output"
+};
+
+#define HTTP_VALUE_SIZE 96
+
+enum http_state {
+	HTTP_STATE_FREE,
+	HTTP_STATE_REQUEST,	/* Reading a request. */
+	HTTP_STATE_EVENTS	/* Streaming telemetry. */
+};
+
+struct http_connection {
+	int fd;
+	enum http_state state;
+	char in[1024];
+	size_t have;
+	bool primed;		/* Has had all fields at least once. */
+	char last[HTTP_FIELDS][HTTP_VALUE_SIZE];
+	struct timespec quiet;	/* When something was last sent. */
+};
+
+static int listenfd = -1;
+static struct http_connection connections[HTTP_MAX_CLIENTS];
+static struct timespec next;
+
+static const char page[] =
+	"<!DOCTYPE html>\n"
+	"<html><head><title>PiMount</title>\n"
+	"<meta name=\"viewport\" content=\"width=device-width\">\n"
+	"<style>\n"
+	"body{background:#000;color:#c00;font-family:monospace;"
+	"font-size:1.4em}\n"
+	"td{padding:.2em .6em}td+td{text-align:right}\n"
+	"button{background:#200;color:#c00;border:1px solid #600;"
+	"font:inherit;margin:.2em;padding:.4em .8em}\n"
+	"</style></head><body>\n"
+	"<h3>PiMount</h3>\n"
+	"<table>\n"
+	"<tr><td>Mode</td><td id=\"control\">-</td></tr>\n"
+	"<tr><td>R/A</td><td id=\"ra\">-</td></tr>\n"
+	"<tr><td>DEC</td><td id=\"dec\">-</td></tr>\n"
+	"<tr><td>Temp</td><td id=\"temp\">-</td></tr>\n"
+	"<tr><td>Load</td><td id=\"load\">-</td></tr>\n"
+	"<tr><td>Cores</td><td id=\"cores\">-</td></tr>\n"
+	"<tr><td>IRQ/s</td><td id=\"irqs\">-</td></tr>\n"
+	"<tr><td>Fan %</td><td id=\"fan\">-</td></tr>\n"
+	"<tr><td>Fan Error</td><td id=\"fan_error\">-</td></tr>\n"
+	"</table>\n"
+	"<p><button>park</button><button>local</button>"
+	"<button>remote</button><button>track</button></p>\n"
+	"<p><button>east</button><button>west</button>"
+	"<button>north</button><button>south</button></p>\n"
+	"<script>\n"
+	"var es=new EventSource('/events');\n"
+	"es.onmessage=function(e){var d=JSON.parse(e.data);"
+	"for(var k in d){var n=document.getElementById(k);"
+	"if(n)n.textContent=d[k];}};\n"
+	"document.querySelectorAll('button').forEach(function(b){"
+	"b.onclick=function(){fetch('/control',"
+	"{method:'POST',body:b.textContent});};});\n"
+	"</script>\n"
+	"</body></html>\n";
+
+/*
+  ------------------------------------------------------------------------------
+  now
+*/
+
+static struct timespec
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_close
+*/
+
+static void
+http_close(struct http_connection *connection)
+{
+	if (-1 != connection->fd)
+		close(connection->fd);
+
+	connection->fd = -1;
+	connection->state = HTTP_STATE_FREE;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_send
+
+  Everything sent is small, so a write that doesn't fit in the socket
+  buffer means the client isn't keeping up.  Drop it.
+*/
+
+static int
+http_send(struct http_connection *connection, const char *data, size_t length)
+{
+	ssize_t bytes;
+
+	bytes = send(connection->fd, data, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+	if ((ssize_t)length != bytes) {
+		http_close(connection);
+
+		return -1;
+	}
+
+	connection->quiet = now();
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_reply
+*/
+
+static void
+http_reply(struct http_connection *connection, const char *status,
+	   const char *type, const char *body)
+{
+	char header[256];
+	int length;
+
+	length = snprintf(header, sizeof(header),
+			  "HTTP/1.1 %s\r\n"
+			  "Content-Type: %s\r\n"
+			  "Content-Length: %zu\r\n"
+			  "Connection: close\r\n"
+			  "\r\n",
+			  status, type, strlen(body));
+
+	if (0 == http_send(connection, header, length) && 0 < strlen(body))
+		http_send(connection, body, strlen(body));
+
+	http_close(connection);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_cores
+
+  The latest per core figures, as JSON arrays.
+*/
+
+static void
+http_cores(char *cores, char *irqs)
+{
+	struct telemetry_sample sample;
+	int cores_length;
+	int irqs_length;
+	unsigned i;
+
+	if (!telemetry_latest(&sample))
+		sample.cpus = 0;
+
+	cores_length = snprintf(cores, HTTP_VALUE_SIZE, "[");
+	irqs_length = snprintf(irqs, HTTP_VALUE_SIZE, "[");
+
+	for (i = 0; i < sample.cpus; ++i) {
+		cores_length += snprintf(cores + cores_length,
+					 HTTP_VALUE_SIZE - cores_length,
+					 "%s%ld", i ? "," : "",
+					 (TELEMETRY_UNKNOWN ==
+					  sample.cpu[i].busy) ?
+					 -1 : sample.cpu[i].busy);
+		irqs_length += snprintf(irqs + irqs_length,
+					HTTP_VALUE_SIZE - irqs_length,
+					"%s%ld", i ? "," : "",
+					(TELEMETRY_UNKNOWN ==
+					 sample.cpu[i].interrupts) ?
+					-1 : sample.cpu[i].interrupts);
+	}
+
+	snprintf(cores + cores_length, HTTP_VALUE_SIZE - cores_length, "]");
+	snprintf(irqs + irqs_length, HTTP_VALUE_SIZE - irqs_length, "]");
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_fan
+
+  The fan controller's latest run (see fan_get_history()), null for
+  anything not known.
+*/
+
+static void
+http_fan(char values[HTTP_FIELDS][HTTP_VALUE_SIZE])
+{
+	struct fan_sample sample;
+
+	if (1 != fan_get_history(&sample, 1) || 0 > sample.duty) {
+		strcpy(values[HTTP_FIELD_FAN], "null");
+		strcpy(values[HTTP_FIELD_FAN_ERROR], "null");
+		strcpy(values[HTTP_FIELD_FAN_INTEGRAL], "null");
+		strcpy(values[HTTP_FIELD_FAN_OUTPUT], "null");
+
+		return;
+	}
+
+	/* Duty is 0...1,000,000. */
+	snprintf(values[HTTP_FIELD_FAN], HTTP_VALUE_SIZE, "%d",
+		 sample.duty / 10000);
+
+	/* No temperature, so no error (the fan runs at full speed). */
+	if (isnan(sample.error))
+		strcpy(values[HTTP_FIELD_FAN_ERROR], "null");
+	else
+		snprintf(values[HTTP_FIELD_FAN_ERROR], HTTP_VALUE_SIZE,
+			 "%.1f", sample.error);
+
+	snprintf(values[HTTP_FIELD_FAN_INTEGRAL], HTTP_VALUE_SIZE,
+		 "%.2f", sample.integral);
+	snprintf(values[HTTP_FIELD_FAN_OUTPUT], HTTP_VALUE_SIZE,
+		 "%.2f", sample.output);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_sample
+
+  Format the current value of every field.
+*/
+
+static void
+http_sample(char values[HTTP_FIELDS][HTTP_VALUE_SIZE])
+{
+	struct pimount_state state_copy;
+
+	lock(&state.mutex);
+	state_copy.control = state.control;
+	state_copy.ra_rate = state.ra_rate;
+	state_copy.dec_rate = state.dec_rate;
+	unlock(&state.mutex);
+
+	switch (state_copy.control) {
+	case PIMOUNT_CONTROL_OFF:
+		strcpy(values[HTTP_FIELD_CONTROL], "Parked");
+		break;
+	case PIMOUNT_CONTROL_LOCAL:
+		strcpy(values[HTTP_FIELD_CONTROL], "Local");
+		break;
+	case PIMOUNT_CONTROL_REMOTE:
+		strcpy(values[HTTP_FIELD_CONTROL], "Remote");
+		break;
+	default:
+		strcpy(values[HTTP_FIELD_CONTROL], "?");
+		break;
+	}
+
+	snprintf(values[HTTP_FIELD_RA], HTTP_VALUE_SIZE,
+		 "%.2f", state_copy.ra_rate);
+	snprintf(values[HTTP_FIELD_DEC], HTTP_VALUE_SIZE,
+		 "%.2f", state_copy.dec_rate);
+	snprintf(values[HTTP_FIELD_TEMP], HTTP_VALUE_SIZE, "%d", get_temp());
+	snprintf(values[HTTP_FIELD_LOAD], HTTP_VALUE_SIZE, "%ld", get_load());
+	http_cores(values[HTTP_FIELD_CORES], values[HTTP_FIELD_IRQS]);
+	http_fan(values);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_event
+
+  Send the fields that changed since the last event as one JSON
+  object.  If nothing changed, send nothing (except the occasional
+  keep alive).
+*/
+
+static void
+http_event(struct http_connection *connection,
+	   char values[HTTP_FIELDS][HTTP_VALUE_SIZE])
+{
+	char buffer[512];
+	int length;
+	int i;
+	bool first = true;
+
+	length = snprintf(buffer, sizeof(buffer), "data: {");
+
+	for (i = 0; i < HTTP_FIELDS; ++i) {
+		if (connection->primed &&
+		    0 == strcmp(connection->last[i], values[i]))
+			continue;
+
+		strcpy(connection->last[i], values[i]);
+
+		/* Control is the only string, the rest are numbers. */
+		length += snprintf(buffer + length, sizeof(buffer) - length,
+				   (HTTP_FIELD_CONTROL == i) ?
+				   "%s\"%s\":\"%s\"" : "%s\"%s\":%s",
+				   first ? "" : ",",
+				   http_field_names[i], values[i]);
+		first = false;
+	}
+
+	connection->primed = true;
+
+	if (first) {
+		if (HTTP_KEEPALIVE <
+		    timespec_to_ms(timespec_sub(now(), connection->quiet)))
+			http_send(connection, ":\n\n", 3);
+
+		return;
+	}
+
+	length += snprintf(buffer + length, sizeof(buffer) - length, "}\n\n");
+	http_send(connection, buffer, length);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_control
+*/
+
+static const char *
+http_control(const char *command)
+{
+	if (0 == strcmp(command, "park")) {
+		c_stop();
+	} else if (0 == strcmp(command, "local")) {
+		c_local();
+	} else if (0 == strcmp(command, "remote")) {
+		c_remote();
+	} else if (0 == strcmp(command, "track")) {
+		c_local();
+		c_track();
+	} else if (0 == strcmp(command, "west")) {
+		c_ra(true);
+	} else if (0 == strcmp(command, "east")) {
+		c_ra(false);
+	} else if (0 == strcmp(command, "north")) {
+		c_dec(true);
+	} else if (0 == strcmp(command, "south")) {
+		c_dec(false);
+	} else {
+		return "400 Bad Request";
+	}
+
+	return "204 No Content";
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_request
+
+  Handle a request once all of it has been read.
+*/
+
+static void
+http_request(struct http_connection *connection)
+{
+	char method[8];
+	char path[64];
+	char *end;
+	char *body;
+	char *field;
+	size_t length = 0;
+
+	connection->in[connection->have] = 0;
+	end = strstr(connection->in, "\r\n\r\n");
+
+	if (NULL == end) {
+		if (sizeof(connection->in) - 1 == connection->have)
+			http_reply(connection, "413 Request Entity Too Large",
+				   "text/plain", "");
+
+		return;		/* Wait for the rest. */
+	}
+
+	body = end + 4;
+
+	if (2 != sscanf(connection->in, "%7s %63s", method, path)) {
+		http_reply(connection, "400 Bad Request", "text/plain", "");
+
+		return;
+	}
+
+	field = strcasestr(connection->in, "\r\nContent-Length:");
+
+	if (NULL != field && field < end)
+		length = strtoul(field + 17, NULL, 10);
+
+	if (strlen(body) < length) {
+		if (sizeof(connection->in) - 1 == connection->have)
+			http_reply(connection, "413 Request Entity Too Large",
+				   "text/plain", "");
+
+		return;		/* Wait for the rest. */
+	}
+
+	body[length] = 0;
+
+	if (0 == strcmp(method, "GET") && 0 == strcmp(path, "/")) {
+		http_reply(connection, "200 OK", "text/html", page);
+	} else if (0 == strcmp(method, "GET") && 0 == strcmp(path, "/events")) {
+		const char header[] =
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/event-stream\r\n"
+			"Cache-Control: no-cache\r\n"
+			"\r\n";
+		char values[HTTP_FIELDS][HTTP_VALUE_SIZE];
+
+		if (http_send(connection, header, strlen(header)))
+			return;
+
+		connection->state = HTTP_STATE_EVENTS;
+		connection->primed = false;
+		http_sample(values);
+		http_event(connection, values);
+	} else if (0 == strcmp(method, "POST") &&
+		   0 == strcmp(path, "/control")) {
+		http_reply(connection, http_control(body), "text/plain", "");
+	} else {
+		http_reply(connection, "404 Not Found", "text/plain", "");
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_read
+*/
+
+static void
+http_read(struct http_connection *connection)
+{
+	ssize_t bytes;
+
+	bytes = recv(connection->fd, connection->in + connection->have,
+		     sizeof(connection->in) - 1 - connection->have,
+		     MSG_DONTWAIT);
+
+	if (0 == bytes) {
+		http_close(connection);
+
+		return;
+	}
+
+	if (-1 == bytes) {
+		if (EINTR != errno && EAGAIN != errno)
+			http_close(connection);
+
+		return;
+	}
+
+	/* Anything sent on an event stream is ignored. */
+	if (HTTP_STATE_EVENTS == connection->state)
+		return;
+
+	connection->have += bytes;
+	http_request(connection);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_accept
+*/
+
+static void
+http_accept(void)
+{
+	int fd;
+	int i;
+
+	fd = accept4(listenfd, NULL, NULL, SOCK_CLOEXEC);
+
+	if (-1 == fd) {
+		fprintf(stderr, "%s:%d - accept() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return;
+	}
+
+	for (i = 0; i < HTTP_MAX_CLIENTS; ++i) {
+		if (HTTP_STATE_FREE == connections[i].state) {
+			connections[i].fd = fd;
+			connections[i].state = HTTP_STATE_REQUEST;
+			connections[i].have = 0;
+			connections[i].quiet = now();
+
+			return;
+		}
+	}
+
+	close(fd);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_tick
+*/
+
+static void
+http_tick(void)
+{
+	char values[HTTP_FIELDS][HTTP_VALUE_SIZE];
+	int i;
+
+	http_sample(values);
+
+	for (i = 0; i < HTTP_MAX_CLIENTS; ++i)
+		if (HTTP_STATE_EVENTS == connections[i].state)
+			http_event(&connections[i], values);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_streaming
+*/
+
+static bool
+http_streaming(void)
+{
+	int i;
+
+	for (i = 0; i < HTTP_MAX_CLIENTS; ++i)
+		if (HTTP_STATE_EVENTS == connections[i].state)
+			return true;
+
+	return false;
+}
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Public
+  ==============================================================================
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  http_initialize
+*/
+
+int
+http_initialize(unsigned short port)
+{
+	struct sockaddr_in address;
+	int on = 1;
+	int i;
+
+	for (i = 0; i < HTTP_MAX_CLIENTS; ++i) {
+		connections[i].fd = -1;
+		connections[i].state = HTTP_STATE_FREE;
+	}
+
+	if (0 == port)
+		return 0;
+
+	listenfd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+	if (-1 == listenfd) {
+		fprintf(stderr, "%s:%d - socket() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return -1;
+	}
+
+	setsockopt(listenfd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = INADDR_ANY;
+	address.sin_port = htons(port);
+
+	if (-1 == bind(listenfd, (struct sockaddr *)&address,
+		       sizeof(address)) ||
+	    -1 == listen(listenfd, 4)) {
+		fprintf(stderr, "%s:%d - bind()/listen() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+		close(listenfd);
+		listenfd = -1;
+
+		return -1;
+	}
+
+	printf("Serving HTTP on port %d\n", port);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_finalize
+*/
+
+void
+http_finalize(void)
+{
+	int i;
+
+	for (i = 0; i < HTTP_MAX_CLIENTS; ++i)
+		if (HTTP_STATE_FREE != connections[i].state)
+			http_close(&connections[i]);
+
+	if (-1 != listenfd) {
+		close(listenfd);
+		listenfd = -1;
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_fds
+*/
+
+int
+http_fds(struct pollfd *fds, int max)
+{
+	int nfds = 0;
+	int i;
+
+	if (-1 == listenfd || 0 == max)
+		return 0;
+
+	fds[nfds].fd = listenfd;
+	fds[nfds++].events = POLLIN;
+
+	for (i = 0; i < HTTP_MAX_CLIENTS && nfds < max; ++i) {
+		if (HTTP_STATE_FREE == connections[i].state)
+			continue;
+
+		fds[nfds].fd = connections[i].fd;
+		fds[nfds++].events = POLLIN;
+	}
+
+	return nfds;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_process
+*/
+
+void
+http_process(struct pollfd *fds, int nfds)
+{
+	int i;
+	int j;
+
+	if (-1 == listenfd)
+		return;
+
+	for (i = 1; i < nfds; ++i) {
+		if (0 == fds[i].revents)
+			continue;
+
+		for (j = 0; j < HTTP_MAX_CLIENTS; ++j) {
+			if (fds[i].fd == connections[j].fd) {
+				http_read(&connections[j]);
+				break;
+			}
+		}
+	}
+
+	if (0 < nfds && (fds[0].revents & POLLIN))
+		http_accept();
+
+	if (http_streaming() && 0 == http_timeout()) {
+		http_tick();
+		next = timespec_add(next, timespec_from_ms(HTTP_PERIOD));
+
+		/* Don't try to catch up after a stall. */
+		if (timespec_lt(next, now()))
+			next = timespec_add(now(), timespec_from_ms(HTTP_PERIOD));
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  http_timeout
+*/
+
+int
+http_timeout(void)
+{
+	long wait;
+
+	if (!http_streaming()) {
+		next = now();
+
+		return -1;
+	}
+
+	wait = timespec_to_ms(timespec_sub(next, now()));
+
+	return (0 < wait) ? wait : 0;
+}
@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  http.h
+
+  A small HTTP server for the web user interface, run from the server
+  thread's poll() loop (see server.c).
+
+    GET  /         The status page (built in, no files needed).
+    GET  /events   Telemetry as server-sent events, HTTP_PERIOD ms
+                   apart.  The first event has every field, after
+                   that only fields that changed are sent.
+    POST /control  The body is one of "park", "local", "remote",
+                   "track", "west", "east", "north" or "south" -- the
+                   same things the buttons and stick on the game
+                   controller do.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _HTTP_H_
+#define _HTTP_H_
+
+#include <poll.h>
+
+#define HTTP_DEFAULT_PORT 80
+#define HTTP_MAX_CLIENTS 8
+#define HTTP_PERIOD 100		/* in ms, 10 Hz */
+
+/*
+  port 0 means don't serve http at all (and the rest does nothing).
+*/
+
+int http_initialize(unsigned short port);
+void http_finalize(void);
+
+/*
+  Add the http fds to 'fds' (at most 'max' of them), and return how
+  many were added.  After poll(), pass the same entries to
+  http_process().
+*/
+
+int http_fds(struct pollfd *fds, int max);
+void http_process(struct pollfd *fds, int nfds);
+
+/*
+  How long poll() can wait before the next telemetry event is due, in
+  ms, or -1 if nobody is listening.
+*/
+
+int http_timeout(void);
+
+#endif	/* _HTTP_H_ */
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+  periodic.cpp
+
+  See periodic.h.
+*/
+
+#include "periodic.h"
+
+#include <algorithm>
+#include <cmath>
+
+void PeriodicError::start(double period)
+{
+    worm = period;
+    clear();
+}
+
+void PeriodicError::clear()
+{
+    turns = 0;
+    haveLast = false;
+    std::fill(time, time + BINS, 0.0);
+    std::fill(sum, sum + BINS, 0.0);
+}
+
+int PeriodicError::bin(long long position) const
+{
+    double phase = fmod(static_cast<double>(position), worm);
+
+    if (phase < 0)
+        phase += worm;
+
+    return std::min(BINS - 1, static_cast<int>(phase / worm * BINS));
+}
+
+void PeriodicError::track(long long position, double seconds)
+{
+    if (worm <= 0)
+        return;
+
+    if (haveLast)
+    {
+        time[bin(position)] += seconds;
+        turns += fabs(static_cast<double>(position - last)) / worm;
+    }
+
+    last = position;
+    haveLast = true;
+}
+
+void PeriodicError::correct(long long position, double arcsec)
+{
+    if (worm > 0)
+        sum[bin(position)] += arcsec;
+}
+
+/*
+  The bins are evenly spaced, so the least squares fit of each
+  harmonic is just the discrete Fourier coefficient.
+*/
+
+bool PeriodicError::fit(float a[PEC_HARMONICS], float b[PEC_HARMONICS]) const
+{
+    double rate[BINS];
+
+    for (int i = 0; i < BINS; ++i)
+    {
+        if (time[i] <= 0)
+            return false;
+
+        rate[i] = sum[i] / time[i];
+    }
+
+    for (int k = 0; k < PEC_HARMONICS; ++k)
+    {
+        double c = 0, s = 0;
+
+        for (int i = 0; i < BINS; ++i)
+        {
+            double phase = 2 * M_PI * (k + 1) * (i + 0.5) / BINS;
+
+            c += rate[i] * cos(phase);
+            s += rate[i] * sin(phase);
+        }
+
+        a[k] = 2 * c / BINS;
+        b[k] = 2 * s / BINS;
+    }
+
+    return true;
+}
+
+/*
+  The error is the integral of the correction rate: over a turn of the
+  worm, a cos(k p) integrates to a sin(k p) / (k w), w being the
+  worm's angular rate.
+*/
+
+double PeriodicError::peakToPeak(const float a[PEC_HARMONICS],
+                                 const float b[PEC_HARMONICS], double seconds)
+{
+    double w = 2 * M_PI / seconds, low = 0, high = 0;
+
+    for (int i = 0; i < PEC_TABLE_SIZE; ++i)
+    {
+        double phase = 2 * M_PI * i / PEC_TABLE_SIZE, error = 0;
+
+        for (int k = 0; k < PEC_HARMONICS; ++k)
+            error += (a[k] * sin((k + 1) * phase) -
+                      b[k] * cos((k + 1) * phase)) / ((k + 1) * w);
+
+        low = (i == 0) ? error : std::min(low, error);
+        high = (i == 0) ? error : std::max(high, error);
+    }
+
+    return high - low;
+}
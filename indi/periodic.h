@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+  periodic.h
+
+  Records the RA guide corrections against the phase of the worm, to
+  find the periodic error (see ../pec.h for playing it back).
+
+  The phase comes from the RA step count, so time spent at each phase
+  is accumulated along with the corrections, and the correction rate
+  at a phase is the ratio.  Several turns of the worm are averaged
+  that way, then the first few harmonics are fit, which smooths out
+  the seeing.
+*/
+
+#pragma once
+
+#include "pec.h"
+
+class PeriodicError
+{
+  public:
+    static const int BINS = 128;
+
+    /* 'period' is in 1/8 steps, one turn of the worm. */
+    void start(double period);
+    void clear();
+
+    double period() const { return worm; }
+
+    /* Tracked to 'position' (1/8 steps), 'seconds' after the last call. */
+    void track(long long position, double seconds);
+
+    /* Not tracking, the next track() starts over from its position. */
+    void pause() { haveLast = false; }
+
+    /* A guide correction of 'arcsec' (West is positive) at 'position'. */
+    void correct(long long position, double arcsec);
+
+    /* How many turns of the worm have been recorded. */
+    double cycles() const { return turns; }
+
+    /*
+      Fit PEC_HARMONICS harmonics to the correction rate (arcsec/s),
+      see struct pec.  Fails until every phase has been seen.
+    */
+    bool fit(float a[PEC_HARMONICS], float b[PEC_HARMONICS]) const;
+
+    /*
+      Peak to peak periodic error (arcsec) corrected by a[] and b[],
+      with the worm turning once every 'seconds'.
+    */
+    static double peakToPeak(const float a[PEC_HARMONICS],
+                             const float b[PEC_HARMONICS], double seconds);
+
+  private:
+    int bin(long long position) const;
+
+    double worm { 0 };
+    double turns { 0 };
+    long long last { 0 };
+    bool haveLast { false };
+    double time[BINS];
+    double sum[BINS];
+};
@@ -13,29 +13,143 @@
 
 #include <cmath>
 #include <cstring>
+#include <algorithm>
 #include <memory>
 
+#include "indidevapi.h"
+
+#include "pimount.h"
+
 // We declare an auto pointer to PiMount.
 static std::unique_ptr<PiMount> pimount(new PiMount());
 
-#define GOTO_RATE      6.5      /* slew rate, degrees/s */
-#define SLEW_RATE      2.5      /* slew rate, degrees/s */
-#define FINE_SLEW_RATE 0.5      /* slew rate, degrees/s */
+/*
+  Rates are in arcseconds per second, to RATE_RESOLUTION (see
+  ../pimount.h).
+*/
+
+#define MAX_RATE       std::min(MAX_RA_RATE, MAX_DEC_RATE)
+#define FIND_RATE      60.0
+#define CENTERING_RATE 30.0
+
+/*
+  Goto follows the planned slew, correcting any error at (error /
+  GOTO_TIME) arcseconds per second, and is done once the plan has run
+  out and both axes are within GOTO_LIMIT arcseconds.
+*/
 
-/* Move at GOTO_RATE until distance from target is GOTO_LIMIT degrees */
-#define GOTO_LIMIT      5
-/* Move at SLEW_LIMIT until distance from target is SLEW_LIMIT degrees */
-#define SLEW_LIMIT      1
+#define GOTO_TIME  1.0
+#define GOTO_LIMIT 10.0
+
+/* Defaults for MOUNT_LIMITS. */
+#define ACCELERATION 30.0       /* arcsec/s^2 */
+#define MERIDIAN     10.0       /* degrees past the meridian */
+
+/*
+  Coordinates are sent when they move by 0.1 seconds (RA) or arcseconds
+  (DEC), at most every EQ_INTERVAL seconds.  PEC status at most every
+  PEC_INTERVAL.
+*/
+
+#define EQ_RESOLUTION (1.0 / 36000)
+#define EQ_INTERVAL   0.5
+#define PEC_INTERVAL  5.0
+
+/* How often the daemon sends the position, in ms. */
+#define DAEMON_PERIOD 100
 
 #define RA_AXIS     0
 #define DEC_AXIS    1
-#define GUIDE_NORTH 0
-#define GUIDE_SOUTH 1
-#define GUIDE_WEST  0
-#define GUIDE_EAST  1
 
-#define MIN_AZ_FLIP 180
-#define MAX_AZ_FLIP 200
+/*
+  Track modes, beyond the INDI ones (TRACK_SIDEREAL...TRACK_CUSTOM).
+  The King rate is the usual compromise for refraction at moderate
+  altitudes; TRACK_REFRACTION works refraction out for where the
+  mount points, every TRACK_PERIOD seconds.
+*/
+
+#define TRACK_KING       4
+#define TRACK_REFRACTION 5
+
+#define TRACKRATE_KING   15.0369
+#define TRACK_PERIOD     10.0
+
+/* PEC mode, settings and status. */
+#define PEC_OFF    0
+#define PEC_PLAY   1
+#define PEC_RECORD 2
+
+#define PEC_CYCLES 0
+#define PEC_TEETH  1
+
+#define PEC_RECORDED      0
+#define PEC_PEAK_TO_PEAK  1
+
+/* Seconds per sidereal day. */
+#define SIDEREAL_DAY 86164.0905
+
+#define LIMIT_RATE         0
+#define LIMIT_ACCELERATION 1
+#define LIMIT_MERIDIAN     2
+
+/*
+  The mechanical position is a (German) equatorial one, hour angle and
+  declination, but with the declination past the pole (> 90) after a
+  meridian flip.  Counterweight down is a mechanical hour angle of 0
+  to 12 hours, pointing West (PIER_EAST) for a declination up to 90
+  and East (PIER_WEST) past that.  This assumes the northern
+  hemisphere.
+*/
+
+static void flip(double &ha, double &dec)
+{
+    ha = rangeHA(ha + 12);
+    dec = 180 - dec;
+}
+
+static void unflip(double &ha, double &dec)
+{
+    if (dec > 90)
+        flip(ha, dec);
+}
+
+/*
+  Where refraction makes hour angle 'ha' (hours) and declination 'dec'
+  (degrees) appear, at 'latitude' (degrees).  Uses Saemundsson's
+  formula for standard conditions, and leaves anything below the
+  horizon alone.
+*/
+
+static void refract(double ha, double dec, double latitude,
+                    double &apparentHA, double &apparentDEC)
+{
+    double h = ha * M_PI / 12, d = dec * M_PI / 180;
+    double phi = latitude * M_PI / 180;
+
+    /* Equatorial (x to the meridian, y to the West) to horizon. */
+    double x = cos(d) * cos(h), y = cos(d) * sin(h), z = sin(d);
+    double south = x * sin(phi) - z * cos(phi);
+    double up = x * cos(phi) + z * sin(phi);
+    double alt = asin(std::max(-1.0, std::min(1.0, up))) * 180 / M_PI;
+
+    apparentHA = ha;
+    apparentDEC = dec;
+
+    if (alt < 0)
+        return;
+
+    double az = atan2(y, south);
+
+    alt += 1.02 / tan((alt + 10.3 / (alt + 5.11)) * M_PI / 180) / 60;
+    south = cos(alt * M_PI / 180) * cos(az);
+    y = cos(alt * M_PI / 180) * sin(az);
+    up = sin(alt * M_PI / 180);
+
+    x = south * sin(phi) + up * cos(phi);
+    z = -south * cos(phi) + up * sin(phi);
+    apparentHA = atan2(y, x) * 12 / M_PI;
+    apparentDEC = asin(std::max(-1.0, std::min(1.0, z))) * 180 / M_PI;
+}
 
 void ISPoll(void *p);
 
@@ -87,7 +201,7 @@ PiMount::PiMount()
 
     SetTelescopeCapability(TELESCOPE_CAN_PARK | TELESCOPE_CAN_SYNC |
 			   TELESCOPE_CAN_GOTO | TELESCOPE_CAN_ABORT |
-			   TELESCOPE_HAS_PIER_SIDE_SIMULATION |
+			   TELESCOPE_HAS_PIER_SIDE |
                            TELESCOPE_HAS_TIME | TELESCOPE_HAS_LOCATION |
 			   TELESCOPE_HAS_TRACK_MODE |
 			   TELESCOPE_CAN_CONTROL_TRACK | TELESCOPE_HAS_TRACK_RATE,
@@ -147,6 +261,70 @@ bool PiMount::initProperties()
 		       "A_NEW_NUMBER", "New Number", MOTION_TAB, IP_RW, 0,
 		       IPS_IDLE);
 
+    /* The pointing model, see pointing.h. */
+    IUFillNumber(&ModelN[PointingModel::IH], "IH", "HA Index (\")",
+		 "%.1f", -1e6, 1e6, 0, 0);
+    IUFillNumber(&ModelN[PointingModel::ID], "ID", "DEC Index (\")",
+		 "%.1f", -1e6, 1e6, 0, 0);
+    IUFillNumber(&ModelN[PointingModel::CH], "CH", "Cone (\")",
+		 "%.1f", -1e6, 1e6, 0, 0);
+    IUFillNumber(&ModelN[PointingModel::NP], "NP", "Non-Perpendicularity (\")",
+		 "%.1f", -1e6, 1e6, 0, 0);
+    IUFillNumber(&ModelN[PointingModel::MA], "MA", "Polar Azimuth (\")",
+		 "%.1f", -1e6, 1e6, 0, 0);
+    IUFillNumber(&ModelN[PointingModel::ME], "ME", "Polar Elevation (\")",
+		 "%.1f", -1e6, 1e6, 0, 0);
+    IUFillNumber(&ModelN[6], "RMS", "RMS (\")", "%.1f", 0, 1e6, 0, 0);
+    IUFillNumber(&ModelN[7], "POINTS", "Sync Points", "%.0f", 0, 1e6, 0, 0);
+    IUFillNumberVector(&ModelNP, ModelN, 8, getDeviceName(),
+		       "POINTING_MODEL", "Pointing Model", ALIGNMENT_TAB,
+		       IP_RO, 0, IPS_IDLE);
+
+    IUFillSwitch(&ModelClearS[0], "CLEAR", "Clear", ISS_OFF);
+    IUFillSwitchVector(&ModelClearSP, ModelClearS, 1, getDeviceName(),
+		       "POINTING_MODEL_CLEAR", "Pointing Model", ALIGNMENT_TAB,
+		       IP_RW, ISR_ATMOST1, 0, IPS_IDLE);
+
+    IUFillNumber(&LimitsN[LIMIT_RATE], "MAX_RATE", "Max Rate (\"/s)",
+		 "%.1f", 1, MAX_RATE, 1, MAX_RATE);
+    IUFillNumber(&LimitsN[LIMIT_ACCELERATION], "ACCELERATION",
+		 "Acceleration (\"/s^2)", "%.1f", 1, 1000, 1, ACCELERATION);
+    IUFillNumber(&LimitsN[LIMIT_MERIDIAN], "MERIDIAN",
+		 "Past Meridian (deg)", "%.1f", 0, 30, 1, MERIDIAN);
+    IUFillNumberVector(&LimitsNP, LimitsN, 3, getDeviceName(),
+		       "MOUNT_LIMITS", "Slew Limits", MOTION_TAB, IP_RW, 0,
+		       IPS_IDLE);
+
+    /* Periodic error correction. */
+    IUFillSwitch(&PECS[PEC_OFF], "PEC_OFF", "Off", ISS_ON);
+    IUFillSwitch(&PECS[PEC_PLAY], "PEC_PLAY", "Play", ISS_OFF);
+    IUFillSwitch(&PECS[PEC_RECORD], "PEC_RECORD", "Record", ISS_OFF);
+    IUFillSwitchVector(&PECSP, PECS, 3, getDeviceName(),
+		       "PEC_MODE", "PEC", MOTION_TAB, IP_RW, ISR_1OFMANY, 0,
+		       IPS_IDLE);
+
+    IUFillNumber(&PECSettingsN[PEC_CYCLES], "PEC_CYCLES", "Worm Turns",
+		 "%.0f", 1, 20, 1, 3);
+    IUFillNumber(&PECSettingsN[PEC_TEETH], "PEC_TEETH", "Worm Wheel Teeth",
+		 "%.0f", 1, 1000, 1, 144);
+    IUFillNumberVector(&PECSettingsNP, PECSettingsN, 2, getDeviceName(),
+		       "PEC_SETTINGS", "PEC Recording", MOTION_TAB, IP_RW, 0,
+		       IPS_IDLE);
+
+    IUFillNumber(&PECStatusN[PEC_RECORDED], "PEC_RECORDED", "Turns Recorded",
+		 "%.2f", 0, 100, 0, 0);
+    IUFillNumber(&PECStatusN[PEC_PEAK_TO_PEAK], "PEC_PEAK_TO_PEAK",
+		 "Peak to Peak (\")", "%.1f", 0, 1e6, 0, 0);
+    IUFillNumberVector(&PECStatusNP, PECStatusN, 2, getDeviceName(),
+		       "PEC_STATUS", "PEC Status", MOTION_TAB, IP_RO, 0,
+		       IPS_IDLE);
+
+    memset(&pec, 0, sizeof(pec));
+
+    updates.add(&EqNP, EQ_RESOLUTION, EQ_INTERVAL);
+    updates.add(&PECStatusNP, 0.01, PEC_INTERVAL);
+    updates.add(&SlewRateSP, 0);
+
     /* How fast do we guide compared to sidereal rate */
     IUFillNumber(&GuideRateN[RA_AXIS], "GUIDE_RATE_WE", "W/E Rate",
 		 "%g", 0, 1, 0.1, 0.5);
@@ -167,7 +345,11 @@ bool PiMount::initProperties()
 
     // Add Tracking Modes
     AddTrackMode("TRACK_SIDEREAL", "Sidereal", true);
+    AddTrackMode("TRACK_SOLAR", "Solar");
+    AddTrackMode("TRACK_LUNAR", "Lunar");
     AddTrackMode("TRACK_CUSTOM", "Custom");
+    AddTrackMode("TRACK_KING", "King");
+    AddTrackMode("TRACK_REFRACTION", "Refraction");
 
     // Let's simulate it to be an F/7.5 120mm telescope
     ScopeParametersN[0].value = 120;
@@ -220,19 +402,6 @@ void PiMount::ISGetProperties(const char *dev)
 
 bool PiMount::updateProperties()
 {
-    // update the pier side capability depending on the pier side simulation state
-    uint32_t cap = GetTelescopeCapability();
-    if (IUFindOnSwitchIndex(&SimulatePierSideSP) == 0)
-    {
-        cap |= TELESCOPE_HAS_PIER_SIDE;
-    }
-    else
-    {
-        cap &= ~static_cast<uint32_t>(TELESCOPE_HAS_PIER_SIDE);
-    }
-
-    SetTelescopeCapability(cap, 4);
-
     INDI::Telescope::updateProperties();
 
     if (isConnected())
@@ -240,6 +409,13 @@ bool PiMount::updateProperties()
         defineNumber(&GuideNSNP);
         defineNumber(&GuideWENP);
         defineNumber(&GuideRateNP);
+        defineNumber(&ModelNP);
+        defineSwitch(&ModelClearSP);
+        defineNumber(&LimitsNP);
+        defineSwitch(&PECSP);
+        defineNumber(&PECSettingsNP);
+        defineNumber(&PECStatusNP);
+        updates.reset();
 
 #ifdef USE_EQUATORIAL_PE
         defineNumber(&EqPENV);
@@ -271,10 +447,6 @@ bool PiMount::updateProperties()
         }
 
         sendTimeFromSystem();
-
-        // initialise the pier side if it's available
-        if (HasPierSide())
-            currentPierSide = Telescope::expectedPierSide(currentRA);
     }
     else
     {
@@ -288,412 +460,787 @@ bool PiMount::updateProperties()
 #endif
         deleteProperty(ANewNumberVector.name);
         deleteProperty(GuideRateNP.name);
+        deleteProperty(ModelNP.name);
+        deleteProperty(ModelClearSP.name);
+        deleteProperty(LimitsNP.name);
+        deleteProperty(PECSP.name);
+        deleteProperty(PECSettingsNP.name);
+        deleteProperty(PECStatusNP.name);
     }
 
     return true;
 }
 
+bool PiMount::saveConfigItems(FILE *fp)
+{
+    INDI::Telescope::saveConfigItems(fp);
+
+    IUSaveConfigNumber(fp, &LimitsNP);
+    IUSaveConfigNumber(fp, &PECSettingsNP);
+
+    return true;
+}
+
 bool PiMount::Connect()
 {
-    IDLog("%s:%s:%d - \n",
-	  __FILE__, __FUNCTION__, __LINE__);
+    struct client_hooks hooks;
+
+    if (daemon != nullptr)
+        return true;
+
+    hooks.added = clientAdded;
+    hooks.removed = clientRemoved;
+    hooks.pushed = clientPushed;
+    hooks.data = this;
+
+    /*
+      Connecting finishes (and, if the daemon goes away, is retried)
+      in the background, see ReadScopeStatus().
+    */
+
+    daemon = client_create("127.0.0.1", 0, 1, &hooks);
+
+    if (daemon == nullptr)
+    {
+        LOG_ERROR("Unable to create the pimount daemon client.");
+        return false;
+    }
+
+    havePosition = false;
+    lastRate[AXIS_RA] = lastRate[AXIS_DE] = 0;
 
     return true;
 }
 
 bool PiMount::Disconnect()
 {
-    IDLog("%s:%s:%d - \n",
-	  __FILE__, __FUNCTION__, __LINE__);
+    struct server_message message;
+
+    if (daemon == nullptr)
+        return true;
+
+    guideCancel();
+
+    /* Give control back, which also stops both axes. */
+    if (client_connected(daemon))
+    {
+        memset(&message, 0, sizeof(message));
+        message.command = SERVER_SET_CONTROL;
+        message.body.control.control = PIMOUNT_CONTROL_OFF;
+        client_call(daemon, &message, 250);
+    }
+
+    client_destroy(daemon);
+    daemon = nullptr;
 
     return true;
 }
 
-bool PiMount::ReadScopeStatus()
+/*
+  Daemon (see ../client.h).  All of these run from the INDI event loop,
+  the client* functions just pass things on to the driver.
+*/
+
+void PiMount::clientAdded(struct client *client, int fd, void *data)
 {
-    static struct timeval lastTime
-    {
-        0, 0
-	    };
-    struct timeval currentTime
-    {
-        0, 0
-	    };
-    double deltaTimeSecs = 0, da_ra = 0, da_dec = 0, deltaRa = 0, deltaDec = 0,
-	ra_guide_dt = 0, dec_guide_dt = 0;
-    int nlocked, ns_guide_dir = -1, we_guide_dir = -1;
+    INDI_UNUSED(client);
+    static_cast<PiMount *>(data)->daemonAdded(fd);
+}
 
-#ifdef USE_EQUATORIAL_PE
-    static double last_dx = 0, last_dy = 0;
-    char RA_DISP[64], DEC_DISP[64], RA_GUIDE[64], DEC_GUIDE[64], RA_PE[64],
-	DEC_PE[64], RA_TARGET[64], DEC_TARGET[64];
-#endif
+void PiMount::clientRemoved(struct client *client, int fd, void *data)
+{
+    INDI_UNUSED(client);
+    INDI_UNUSED(fd);
+    static_cast<PiMount *>(data)->daemonRemoved();
+}
 
-    /* update elapsed time since last poll, don't presume exactly POLLMS */
-    gettimeofday(&currentTime, nullptr);
+void PiMount::clientPushed(struct client *client,
+			   struct server_message *message, void *data)
+{
+    INDI_UNUSED(client);
+    static_cast<PiMount *>(data)->daemonPushed(message);
+}
 
-    if (lastTime.tv_sec == 0 && lastTime.tv_usec == 0)
-        lastTime = currentTime;
+void PiMount::clientInput(int fd, void *data)
+{
+    PiMount *self = static_cast<PiMount *>(data);
 
-    // Time diff in seconds
-    deltaTimeSecs  = currentTime.tv_sec - lastTime.tv_sec +
-	(currentTime.tv_usec - lastTime.tv_usec) / 1e6;
-    lastTime = currentTime;
+    if (self->daemon != nullptr)
+        client_input(self->daemon, fd);
+}
 
-    if (fabs(targetRA - currentRA) * 15. >= GOTO_LIMIT)
-        da_ra = GOTO_RATE * deltaTimeSecs;
-    else if (fabs(targetRA - currentRA) * 15. >= SLEW_LIMIT)
-        da_ra = SLEW_RATE * deltaTimeSecs;
-    else
-        da_ra = FINE_SLEW_RATE * deltaTimeSecs;
+void PiMount::clientReply(struct client *client,
+			  struct server_message *reply, int result,
+			  void *data)
+{
+    INDI_UNUSED(client);
 
-    if (fabs(targetDEC - currentDEC) >= GOTO_LIMIT)
-        da_dec = GOTO_RATE * deltaTimeSecs;
-    else if (fabs(targetDEC - currentDEC) >= SLEW_LIMIT)
-        da_dec = SLEW_RATE * deltaTimeSecs;
-    else
-        da_dec = FINE_SLEW_RATE * deltaTimeSecs;
+    if (result == 0)
+        result = reply->result;
 
-    if (MovementNSSP.s == IPS_BUSY || MovementWESP.s == IPS_BUSY)
+    static_cast<PiMount *>(data)->daemonReply(result);
+}
+
+void PiMount::clientRateReply(struct client *client,
+			      struct server_message *reply, int result,
+			      void *data)
+{
+    PiMount *self = static_cast<PiMount *>(data);
+
+    INDI_UNUSED(client);
+
+    if (result == 0)
+        result = reply->result;
+
+    /* Not set after all, so send it again (without a reply, both). */
+    if (result != 0)
     {
-        int rate = IUFindOnSwitchIndex(&SlewRateSP);
+        if (reply != nullptr)
+            self->lastRate[reply->body.rate.axis] = NAN;
+        else
+            self->lastRate[AXIS_RA] = self->lastRate[AXIS_DE] = NAN;
+    }
+
+    self->daemonReply(result);
+}
+
+void PiMount::daemonAdded(int fd)
+{
+    struct server_message message;
+
+    daemonFd = fd;
+    daemonCallback = IEAddCallback(fd, clientInput, this);
+
+    /*
+      The daemon may have restarted, with the step counts back at
+      0, so keep pointing where we were (see daemonPushed()).
+    */
+
+    rebase = true;
+
+    memset(&message, 0, sizeof(message));
+    message.command = SERVER_SET_CONTROL;
+    message.body.control.control = PIMOUNT_CONTROL_REMOTE;
+    sendRequest(message);
+
+    memset(&message, 0, sizeof(message));
+    message.command = SERVER_SUBSCRIBE;
+    message.body.subscribe.period = DAEMON_PERIOD;
+    sendRequest(message);
+
+    /* Taking control stops the motors, make sure rates are resent. */
+    lastRate[AXIS_RA] = lastRate[AXIS_DE] = NAN;
+
+    LOG_INFO("Connected to the pimount daemon.");
+}
+
+void PiMount::daemonRemoved()
+{
+    if (daemonCallback != -1)
+        IERmCallback(daemonCallback);
+
+    daemonFd = -1;
+    daemonCallback = -1;
+
+    LOG_WARN("Lost the connection to the pimount daemon, retrying...");
+}
+
+void PiMount::daemonPushed(struct server_message *message)
+{
+    double ha, dec;
 
-        switch (rate)
+    if (message->command != SERVER_POSITION)
+        return;
+
+    daemonControl(message->body.position.control);
+
+    if (rebase)
+    {
+        if (havePosition)
+            mountPosition(ha, dec);
+        else
         {
-	case SLEW_GUIDE:
-	    da_ra =
-		TrackRateN[AXIS_RA].value / (3600.0 * 15) *
-		GuideRateN[RA_AXIS].value * deltaTimeSecs;
-	    da_dec =
-		TrackRateN[AXIS_RA].value / 3600.0 *
-		GuideRateN[DEC_AXIS].value * deltaTimeSecs;;
-	    break;
-
-	case SLEW_CENTERING:
-	    da_ra  = FINE_SLEW_RATE * deltaTimeSecs * .1;
-	    da_dec = FINE_SLEW_RATE * deltaTimeSecs * .1;
-	    break;
-
-	case SLEW_FIND:
-	    da_ra  = SLEW_RATE * deltaTimeSecs;
-	    da_dec = SLEW_RATE * deltaTimeSecs;
-	    break;
-
-	default:
-	    da_ra  = GOTO_RATE * deltaTimeSecs;
-	    da_dec = GOTO_RATE * deltaTimeSecs;
-	    break;
+            bool flipped;
+
+            ha = rangeHA(get_local_sidereal_time(
+                             LocationN[LOCATION_LONGITUDE].value) - currentRA);
+
+            /* Assume the counterweight is down. */
+            flipped = ha < 0;
+            model.toMount(ha, currentDEC, flipped, ha, dec);
+
+            if (flipped)
+                flip(ha, dec);
         }
 
-        switch (MovementNSSP.s)
+        /*
+          A daemon that restarted has lost the correction, and the
+          step counts it was in phase with.
+        */
+
+        if (havePEC && !message->body.position.pec)
         {
-	case IPS_BUSY:
-	    if (MovementNSS[DIRECTION_NORTH].s == ISS_ON)
-		currentDEC += da_dec;
-	    else if (MovementNSS[DIRECTION_SOUTH].s == ISS_ON)
-		currentDEC -= da_dec;
-	    break;
-
-	default:
-	    break;
+            havePEC = false;
+            memset(&pec, 0, sizeof(pec));
+            IUResetSwitch(&PECSP);
+            PECS[PEC_OFF].s = ISS_ON;
+            PECSP.s = IPS_ALERT;
+            IDSetSwitch(&PECSP, nullptr);
+            LOG_WARN("The pimount daemon lost the periodic error correction, "
+                     "record it again.");
         }
-
-        switch (MovementWESP.s)
+        else if (!havePEC && message->body.position.pec)
         {
-	case IPS_BUSY:
+            /* Left on by an earlier driver, unknown here. */
+            sendPEC();
+        }
 
-	    if (MovementWES[DIRECTION_WEST].s == ISS_ON)
-		currentRA -= da_ra / 15.;
-	    else if (MovementWES[DIRECTION_EAST].s == ISS_ON)
-		currentRA += da_ra / 15.;
-	    break;
+        position = message->body.position;
+        havePosition = true;
+        setReference(ha, dec);
+        rebase = false;
 
-	default:
-	    break;
-        }
+        return;
+    }
 
-        NewRaDec(currentRA, currentDEC);
-        return true;
+    recordPEC(message->body.position);
+    position = message->body.position;
+    havePosition = true;
+}
+
+/*
+  The game controller or the web page can take the mount (which stops
+  both axes) and give it back at any time.  Until it is back, nothing
+  is tracking, whatever INDI was told.
+*/
+
+void PiMount::daemonControl(int control)
+{
+    bool was = !havePosition || position.control == PIMOUNT_CONTROL_REMOTE;
+
+    if (was && control != PIMOUNT_CONTROL_REMOTE)
+    {
+        lastRate[AXIS_RA] = lastRate[AXIS_DE] = NAN;
+        EqNP.s = IPS_ALERT;
+        updates.changed(&EqNP);
+        LOG_WARN("The mount was taken by the game controller or the web "
+                 "page and has stopped, set it back to remote.");
+    }
+    else if (!was && control == PIMOUNT_CONTROL_REMOTE)
+    {
+        /* ReadScopeStatus() sends them again. */
+        lastRate[AXIS_RA] = lastRate[AXIS_DE] = NAN;
+        LOG_INFO("The mount is back under remote control.");
     }
+}
 
-    /*
-      Process per current state. We check the state of
-      EQUATORIAL_EOD_COORDS_REQUEST and act acoordingly
-    */
-    switch (TrackState)
+void PiMount::daemonReply(int result)
+{
+    if (result == 0 || result == -ECANCELED)
+        return;
+
+    if (result == -EBUSY)
+        LOG_WARN("The game controller has the mount, set it to remote.");
+    else if (result != -EPERM)
+        LOGF_ERROR("pimount daemon request failed: %s", strerror(-result));
+}
+
+/*
+  Requests never wait.  If the daemon isn't there, the request is
+  dropped; rates are sent again once it's back.
+*/
+
+void PiMount::sendRequest(struct server_message &message)
+{
+    if (daemon == nullptr)
+        return;
+
+    if (client_request(daemon, &message, clientReply, this) != 0)
+        DEBUGF(DBG_SCOPE, "Request %d dropped: %s",
+               message.command, strerror(errno));
+}
+
+void PiMount::sendRate(int axis, double rate)
+{
+    struct server_message message;
+
+    rate = std::max(-MAX_RATE, std::min(MAX_RATE, rate));
+
+    /* Small changes (refraction, guiding) don't all need sending. */
+    rate = round(rate / RATE_RESOLUTION) * RATE_RESOLUTION;
+
+    if (rate == lastRate[axis] || daemon == nullptr ||
+        !client_connected(daemon) ||
+        (havePosition && position.control != PIMOUNT_CONTROL_REMOTE))
+        return;
+
+    memset(&message, 0, sizeof(message));
+    message.command = SERVER_SET_RATE;
+    message.body.rate.axis = axis;
+    message.body.rate.rate = rate;
+
+    if (client_request(daemon, &message, clientRateReply, this) == 0)
+        lastRate[axis] = rate;
+}
+
+/*
+  Tell the daemon what to play back: the fitted correction, unless PEC
+  is off.
+*/
+
+void PiMount::sendPEC()
+{
+    struct server_message message;
+
+    pec.enable = havePEC && IUFindOnSwitchIndex(&PECSP) != PEC_OFF;
+
+    memset(&message, 0, sizeof(message));
+    message.command = SERVER_SET_PEC;
+    message.body.pec = pec;
+    sendRequest(message);
+}
+
+/*
+  While recording, every position the daemon pushes adds the time
+  since the last one at the current worm phase.  Only tracking counts.
+*/
+
+void PiMount::recordPEC(const struct server_position &now)
+{
+    if (IUFindOnSwitchIndex(&PECSP) != PEC_RECORD)
+        return;
+
+    if (TrackState != SCOPE_TRACKING || !havePosition)
     {
-        /*case SCOPE_IDLE:
-	  EqNP.s = IPS_IDLE;
-	  break;*/
-    case SCOPE_SLEWING:
-    case SCOPE_PARKING:
-	/* slewing - nail it when both within one pulse @ SLEWRATE */
-	nlocked = 0;        // seems to be some sort of state variable
+        periodic.pause();
+        return;
+    }
 
-	deltaRa = targetRA - currentRA;
+    double dt = (now.stamp.tv_sec - position.stamp.tv_sec) +
+        (now.stamp.tv_nsec - position.stamp.tv_nsec) / 1e9;
+    periodic.track(now.axes[AXIS_RA].position, dt);
+    PECStatusN[PEC_RECORDED].value = periodic.cycles();
+    updates.changed(&PECStatusNP);
 
-	// Always take the shortcut, don't go all around the globe
-	// If the difference between target and current is more than 12 hours,
-	// then we need to take the shortest path
-	if (deltaRa > 12)
-	    deltaRa -= 24;
-	else if (deltaRa < -12)
-	    deltaRa += 24;
+    if (periodic.cycles() >= PECSettingsN[PEC_CYCLES].value)
+        finishPEC();
+}
 
-	// In meridian flip, move to the position by doing a full rotation
-	if (forceMeridianFlip)
-	{
-	    // set deltaRa according to the target pier side so that the
-	    // slew is away from the meridian until the direction to go is
-	    // towards the target.
-	    switch (currentPierSide)
-	    {
-	    case PIER_EAST:
-		// force Ra move direction to be positive, i.e. to the West,
-		// until it is large and positive
-		if (deltaRa < 9)
-		    deltaRa = 1;
-		else
-		    forceMeridianFlip = false;
-		break;
-	    case PIER_WEST:
-		// force Ra move direction to be negative, i.e. East,
-		// until it is large and negative
-		if (deltaRa > -9)
-		    deltaRa = -1;
-		else
-		    forceMeridianFlip = false;
-		break;
-	    case PIER_UNKNOWN:
-		break;
-	    }
-	}
+/*
+  Recording is done: fit what was recorded and start playing it back.
+  Recording while playing back records what is left, so that is added
+  to the correction already there.
+*/
 
-	if (fabs(deltaRa) * 15. <= da_ra)
-	{
-	    currentRA = targetRA;
-	    nlocked++;
-	}
-	else if (deltaRa > 0)
-	    currentRA += da_ra / 15.;
-	else
-	    currentRA -= da_ra / 15.;
+void PiMount::finishPEC()
+{
+    float a[PEC_HARMONICS], b[PEC_HARMONICS];
 
-	currentRA = range24(currentRA);
+    if (!periodic.fit(a, b))
+    {
+        /* Some phase hasn't been seen, keep going. */
+        return;
+    }
 
-	deltaDec = targetDEC - currentDEC;
-	if (fabs(deltaDec) <= da_dec)
-	{
-	    currentDEC = targetDEC;
-	    nlocked++;
-	}
-	else if (deltaDec > 0)
-	    currentDEC += da_dec;
-	else
-	    currentDEC -= da_dec;
+    if (!havePEC)
+        memset(&pec, 0, sizeof(pec));
 
-	EqNP.s = IPS_BUSY;
+    for (int k = 0; k < PEC_HARMONICS; ++k)
+    {
+        pec.a[k] += a[k];
+        pec.b[k] += b[k];
+    }
 
-	if (nlocked == 2)
-	{
-	    forceMeridianFlip = false;
+    pec.period = periodic.period();
+    pec.origin = 0;
+    havePEC = true;
+
+    IUResetSwitch(&PECSP);
+    PECS[PEC_PLAY].s = ISS_ON;
+    PECSP.s = IPS_OK;
+    IDSetSwitch(&PECSP, nullptr);
+    sendPEC();
+
+    PECStatusN[PEC_RECORDED].value = periodic.cycles();
+    PECStatusN[PEC_PEAK_TO_PEAK].value =
+        PeriodicError::peakToPeak(pec.a, pec.b,
+                                  SIDEREAL_DAY / PECSettingsN[PEC_TEETH].value);
+    PECStatusNP.s = IPS_OK;
+    updates.changed(&PECStatusNP);
+
+    LOGF_INFO("Periodic error recorded over %.1f turns of the worm, "
+              "correcting %.1f arcsec peak to peak.",
+              periodic.cycles(), PECStatusN[PEC_PEAK_TO_PEAK].value);
+}
 
-	    if (TrackState == SCOPE_SLEWING)
-	    {
-		// Initially no PE in both axis.
-#ifdef USE_EQUATORIAL_PE
-		EqPEN[0].value = currentRA;
-		EqPEN[1].value = currentDEC;
-		IDSetNumber(&EqPENV, nullptr);
-#endif
+/*
+  Hour angle (hours) and declination (degrees) the mount points at,
+  from the last position pushed by the daemon moved on to now at the
+  current rates.
+*/
 
-		TrackState = SCOPE_TRACKING;
+void PiMount::mountPosition(double &ha, double &dec)
+{
+    struct timespec now;
+    double dt;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    dt = (now.tv_sec - position.stamp.tv_sec) +
+        (now.tv_nsec - position.stamp.tv_nsec) / 1e9;
+
+    ha = refHA +
+        ((position.axes[AXIS_RA].position - refSteps[AXIS_RA]) *
+         position.axes[AXIS_RA].scale +
+         position.axes[AXIS_RA].rate * dt) / 54000.0;
+    dec = refDEC +
+        ((position.axes[AXIS_DE].position - refSteps[AXIS_DE]) *
+         position.axes[AXIS_DE].scale +
+         position.axes[AXIS_DE].rate * dt) / 3600.0;
+}
 
-		if (IUFindOnSwitchIndex(&SlewRateSP) != SLEW_CENTERING)
-		{
-		    IUResetSwitch(&SlewRateSP);
-		    SlewRateS[SLEW_CENTERING].s = ISS_ON;
-		    IDSetSwitch(&SlewRateSP, nullptr);
-		}
+void PiMount::setReference(double ha, double dec)
+{
+    refSteps[AXIS_RA] = position.axes[AXIS_RA].position;
+    refSteps[AXIS_DE] = position.axes[AXIS_DE].position;
+    refHA = ha;
+    refDEC = dec;
+}
 
+/*
+  Seconds since the slew started.
+*/
 
-		EqNP.s = IPS_OK;
-		LOG_INFO("Telescope slew is complete. Tracking...");
-	    }
-	    else
-	    {
-		SetParked(true);
-		EqNP.s = IPS_IDLE;
-	    }
-	}
+double PiMount::slewTime()
+{
+    struct timeval now, elapsed;
 
-	break;
+    gettimeofday(&now, nullptr);
+    timersub(&now, &slewStart, &elapsed);
 
-    case SCOPE_IDLE:
-	//currentRA += (TRACKRATE_SIDEREAL/3600.0 * dt) / 15.0;
-	currentRA += (TrackRateN[AXIS_RA].value / 3600.0 * deltaTimeSecs) / 15.0;
-	currentRA = range24(currentRA);
-	break;
+    return elapsed.tv_sec + elapsed.tv_usec / 1e6;
+}
 
-    case SCOPE_TRACKING:
-	// In case of custom tracking rate
-	if (TrackModeS[1].s == ISS_ON)
-	{
-	    currentRA +=
-		( ((TRACKRATE_SIDEREAL / 3600.0) -
-		   (TrackRateN[AXIS_RA].value / 3600.0)) * deltaTimeSecs) / 15.0;
-	    currentDEC += ( (TrackRateN[AXIS_DE].value / 3600.0) * deltaTimeSecs);
-	}
+/*
+  How far (arcseconds) each axis is behind the plan, t seconds into
+  the slew.  Once the plan has run out, that is the distance to the
+  target.
+*/
 
-	deltaTimeSecs *= 1000;
+void PiMount::slewError(double t, double error[2])
+{
+    double ha, dec;
 
-	if (guiderNSTarget[GUIDE_NORTH] > 0)
-	{
-	    LOGF_DEBUG("Commanded to GUIDE NORTH for %g ms",
-		       guiderNSTarget[GUIDE_NORTH]);
-	    ns_guide_dir = GUIDE_NORTH;
-	}
-	else if (guiderNSTarget[GUIDE_SOUTH] > 0)
-	{
-	    LOGF_DEBUG("Commanded to GUIDE SOUTH for %g ms",
-		       guiderNSTarget[GUIDE_SOUTH]);
-	    ns_guide_dir = GUIDE_SOUTH;
-	}
+    mountPosition(ha, dec);
 
-	// WE Guide Selection
-	if (guiderEWTarget[GUIDE_WEST] > 0)
-	{
-	    we_guide_dir = GUIDE_WEST;
-	    LOGF_DEBUG("Commanded to GUIDE WEST for %g ms",
-		       guiderEWTarget[GUIDE_WEST]);
-	}
-	else if (guiderEWTarget[GUIDE_EAST] > 0)
-	{
-	    we_guide_dir = GUIDE_EAST;
-	    LOGF_DEBUG("Commanded to GUIDE EAST for %g ms",
-		       guiderEWTarget[GUIDE_EAST]);
-	}
+    error[AXIS_RA] = slew.position(AXIS_RA, t) -
+        ((ha - slewFrom[AXIS_RA]) * 54000.0 - TRACKRATE_SIDEREAL * t);
+    error[AXIS_DE] = slew.position(AXIS_DE, t) -
+        (dec - slewFrom[AXIS_DE]) * 3600.0;
+}
 
-	if ( (ns_guide_dir != -1 || we_guide_dir != -1) &&
-	     IUFindOnSwitchIndex(&SlewRateSP) != SLEW_GUIDE)
-	{
-	    IUResetSwitch(&SlewRateSP);
-	    SlewRateS[SLEW_GUIDE].s = ISS_ON;
-	    IDSetSwitch(&SlewRateSP, nullptr);
-	}
+void PiMount::updateModel()
+{
+    for (int t = 0; t < PointingModel::TERMS; ++t)
+        ModelN[t].value =
+            model.term(static_cast<PointingModel::Term>(t)) * 206264.806;
+
+    ModelN[6].value = model.rms();
+    ModelN[7].value = model.size();
+    ModelNP.s = IPS_OK;
+    IDSetNumber(&ModelNP, nullptr);
+}
 
-	if (ns_guide_dir != -1)
-	{
-	    dec_guide_dt =
-		(TrackRateN[AXIS_RA].value * GuideRateN[DEC_AXIS].value *
-		 guiderNSTarget[ns_guide_dir] / 1000.0 *
-		 (ns_guide_dir == GUIDE_NORTH ? 1 : -1)) / 3600.0;
+/*
+  The refraction rate is the difference between where the target
+  appears now and TRACK_PERIOD seconds of hour angle later.  'now'
+  skips the wait, for a new track mode or rate.
+*/
 
-	    guiderNSTarget[ns_guide_dir] = 0;
-	    GuideNSNP.s = IPS_IDLE;
-	    IDSetNumber(&GuideNSNP, nullptr);
+void PiMount::updateTrackRate(bool now)
+{
+    struct timeval tv, elapsed;
 
-#ifdef USE_EQUATORIAL_PE
-	    EqPEN[DEC_AXIS].value += dec_guide_dt;
-#else
-	    currentDEC += dec_guide_dt;
-#endif
-	}
+    gettimeofday(&tv, nullptr);
+    timersub(&tv, &trackStamp, &elapsed);
 
-	if (we_guide_dir != -1)
-	{
-	    ra_guide_dt =
-		(TrackRateN[AXIS_RA].value * GuideRateN[RA_AXIS].value *
-		 guiderEWTarget[we_guide_dir] / 1000.0 *
-		 (we_guide_dir == GUIDE_WEST ? -1 : 1)) / (3600.0 * 15.0);
+    if (!now && elapsed.tv_sec < TRACK_PERIOD)
+        return;
 
-	    ra_guide_dt /= (cos(currentDEC * 0.0174532925));
+    trackStamp = tv;
+    trackRate[AXIS_DE] = 0;
 
-	    guiderEWTarget[we_guide_dir] = 0;
-	    GuideWENP.s = IPS_IDLE;
-	    IDSetNumber(&GuideWENP, nullptr);
+    switch (IUFindOnSwitchIndex(&TrackModeSP))
+    {
+    case TRACK_SOLAR:
+        trackRate[AXIS_RA] = TRACKRATE_SOLAR;
+        break;
+    case TRACK_LUNAR:
+        trackRate[AXIS_RA] = TRACKRATE_LUNAR;
+        break;
+    case TRACK_CUSTOM:
+        trackRate[AXIS_RA] = TrackRateN[AXIS_RA].value;
+        trackRate[AXIS_DE] = TrackRateN[AXIS_DE].value;
+        break;
+    case TRACK_KING:
+        trackRate[AXIS_RA] = TRACKRATE_KING;
+        break;
+    case TRACK_REFRACTION:
+    {
+        double latitude = LocationN[LOCATION_LATITUDE].value;
+        double ha = rangeHA(get_local_sidereal_time(
+                                LocationN[LOCATION_LONGITUDE].value) -
+                            currentRA);
+        double dt = TRACK_PERIOD * TRACKRATE_SIDEREAL / 54000.0;
+        double ha0, dec0, ha1, dec1;
+
+        refract(ha, currentDEC, latitude, ha0, dec0);
+        refract(ha + dt, currentDEC, latitude, ha1, dec1);
+
+        trackRate[AXIS_RA] = rangeHA(ha1 - ha0) * 54000.0 / TRACK_PERIOD;
+        trackRate[AXIS_DE] = (dec1 - dec0) * 3600.0 / TRACK_PERIOD;
+        break;
+    }
+    default:
+        trackRate[AXIS_RA] = TRACKRATE_SIDEREAL;
+        break;
+    }
+}
 
-#ifdef USE_EQUATORIAL_PE
-	    EqPEN[RA_AXIS].value += ra_guide_dt;
-#else
-	    currentRA += ra_guide_dt;
-#endif
-	}
+/*
+  Work out what each axis should be doing now, and tell the daemon if
+  that changed.  Positive is West (RA) and North (DEC).
+*/
 
-	//Mention the followng:
-	// Current RA displacemet and direction
-	// Current DEC displacement and direction
-	// Amount of RA GUIDING correction and direction
-	// Amount of DEC GUIDING correction and direction
+void PiMount::updateRates()
+{
+    double rate[2] = { 0, 0 };
 
-#ifdef USE_EQUATORIAL_PE
+    if (!havePosition)
+        return;
 
-	dx = EqPEN[RA_AXIS].value - targetRA;
-	dy = EqPEN[DEC_AXIS].value - targetDEC;
-	fs_sexa(RA_DISP, fabs(dx), 2, 3600);
-	fs_sexa(DEC_DISP, fabs(dy), 2, 3600);
+    switch (TrackState)
+    {
+    case SCOPE_SLEWING:
+    case SCOPE_PARKING:
+    {
+        double t = slewTime(), error[2];
 
-	fs_sexa(RA_GUIDE, fabs(ra_guide_dt), 2, 3600);
-	fs_sexa(DEC_GUIDE, fabs(dec_guide_dt), 2, 3600);
+        slewError(t, error);
 
-	fs_sexa(RA_PE, EqPEN[RA_AXIS].value, 2, 3600);
-	fs_sexa(DEC_PE, EqPEN[DEC_AXIS].value, 2, 3600);
+        /* Hour angle increases at the sidereal rate. */
+        rate[AXIS_RA] = TRACKRATE_SIDEREAL + slew.velocity(AXIS_RA, t) +
+            error[AXIS_RA] / GOTO_TIME;
+        rate[AXIS_DE] = slew.velocity(AXIS_DE, t) +
+            error[AXIS_DE] / GOTO_TIME;
+        break;
+    }
 
-	fs_sexa(RA_TARGET, targetRA, 2, 3600);
-	fs_sexa(DEC_TARGET, targetDEC, 2, 3600);
+    case SCOPE_TRACKING:
+    {
+        double ha, dec;
 
-	if (dx != last_dx || dy != last_dy || ra_guide_dt != 0.0 ||
-	    dec_guide_dt != 0.0)
-	{
-	    last_dx = dx;
-	    last_dy = dy;
-	    //LOGF_DEBUG("dt is %g\n", dt);
-	    LOGF_DEBUG("RA Displacement (%c%s) %s -- %s of target RA %s",
-		       dx >= 0 ? '+' : '-', RA_DISP, RA_PE,
-		       (EqPEN[RA_AXIS].value - targetRA) > 0 ? "East" : "West",
-		       RA_TARGET);
-	    LOGF_DEBUG("DEC Displacement (%c%s) %s -- %s of target RA %s",
-		       dy >= 0 ? '+' : '-', DEC_DISP, DEC_PE,
-		       (EqPEN[DEC_AXIS].value - targetDEC) > 0 ?
-		       "North" : "South", DEC_TARGET);
-	    LOGF_DEBUG("RA Guide Correction (%g) %s -- Direction %s",
-		       ra_guide_dt, RA_GUIDE,
-		       ra_guide_dt > 0 ? "East" : "West");
-	    LOGF_DEBUG("DEC Guide Correction (%g) %s -- Direction %s",
-		       dec_guide_dt, DEC_GUIDE,
-		       dec_guide_dt > 0 ? "North" : "South");
-	}
+        updateTrackRate(false);
+        rate[AXIS_RA] = trackRate[AXIS_RA] + guideOffset[AXIS_RA];
+        rate[AXIS_DE] = trackRate[AXIS_DE] + guideOffset[AXIS_DE];
 
-	if (ns_guide_dir != -1 || we_guide_dir != -1)
-	    IDSetNumber(&EqPENV, nullptr);
-#endif
+        /* Past the pole, North is the other way mechanically. */
+        mountPosition(ha, dec);
 
-	break;
+        if (dec > 90)
+            rate[AXIS_DE] = -rate[AXIS_DE];
+        break;
+    }
 
     default:
-	break;
+        break;
     }
 
-    char RAStr[64], DecStr[64];
+    /* Manual motion, on top of whatever else is going on. */
+    if (MovementWESP.s == IPS_BUSY || MovementNSSP.s == IPS_BUSY)
+    {
+        double speed[2];
 
-    fs_sexa(RAStr, currentRA, 2, 3600);
-    fs_sexa(DecStr, currentDEC, 2, 3600);
+        switch (IUFindOnSwitchIndex(&SlewRateSP))
+        {
+        case SLEW_GUIDE:
+            speed[AXIS_RA] = TRACKRATE_SIDEREAL * GuideRateN[RA_AXIS].value;
+            speed[AXIS_DE] = TRACKRATE_SIDEREAL * GuideRateN[DEC_AXIS].value;
+            break;
+        case SLEW_CENTERING:
+            speed[AXIS_RA] = speed[AXIS_DE] = CENTERING_RATE;
+            break;
+        case SLEW_FIND:
+            speed[AXIS_RA] = speed[AXIS_DE] = FIND_RATE;
+            break;
+        default:
+            speed[AXIS_RA] = speed[AXIS_DE] = MAX_RATE;
+            break;
+        }
 
-    DEBUGF(DBG_SCOPE, "Current RA: %s Current DEC: %s", RAStr, DecStr);
+        if (MovementWESP.s == IPS_BUSY)
+            rate[AXIS_RA] += (MovementWES[DIRECTION_WEST].s == ISS_ON) ?
+                speed[AXIS_RA] : -speed[AXIS_RA];
 
-    NewRaDec(currentRA, currentDEC);
+        if (MovementNSSP.s == IPS_BUSY)
+            rate[AXIS_DE] += (MovementNSS[DIRECTION_NORTH].s == ISS_ON) ?
+                speed[AXIS_DE] : -speed[AXIS_DE];
+    }
+
+    sendRate(AXIS_RA, rate[AXIS_RA]);
+    sendRate(AXIS_DE, rate[AXIS_DE]);
+}
+
+bool PiMount::ReadScopeStatus()
+{
+    double mountHA, mountDEC, ha, dec;
+    bool flipped;
+
+    if (daemon == nullptr)
+        return false;
+
+    /* Finish connecting, reconnect and flush -- never waits. */
+    client_service(daemon, 0);
+
+    if (!havePosition || !client_connected(daemon))
+        return false;
+
+    mountPosition(mountHA, mountDEC);
+    flipped = mountDEC > 90;
+    setPierSide(flipped ? PIER_WEST : PIER_EAST);
+    unflip(mountHA, mountDEC);
+    model.toSky(mountHA, mountDEC, flipped, ha, dec);
+
+    currentRA = range24(get_local_sidereal_time(
+                            LocationN[LOCATION_LONGITUDE].value) - ha);
+    currentDEC = dec;
+
+    if (TrackState == SCOPE_SLEWING || TrackState == SCOPE_PARKING)
+    {
+        double t = slewTime(), error[2];
+
+        slewError(t, error);
+
+        if (t >= slew.duration() &&
+            fabs(error[AXIS_RA]) < GOTO_LIMIT &&
+            fabs(error[AXIS_DE]) < GOTO_LIMIT)
+        {
+            if (TrackState == SCOPE_SLEWING)
+            {
+                TrackState = SCOPE_TRACKING;
+
+                if (IUFindOnSwitchIndex(&SlewRateSP) != SLEW_CENTERING)
+                {
+                    IUResetSwitch(&SlewRateSP);
+                    SlewRateS[SLEW_CENTERING].s = ISS_ON;
+                    updates.changed(&SlewRateSP);
+                }
+
+                LOG_INFO("Telescope slew is complete. Tracking...");
+            }
+            else
+                SetParked(true);
+        }
+    }
+
+    updateRates();
+
+    if (isDebug())
+    {
+        char RAStr[64], DecStr[64];
+
+        fs_sexa(RAStr, currentRA, 2, 3600);
+        fs_sexa(DecStr, currentDEC, 2, 3600);
+
+        DEBUGF(DBG_SCOPE, "Current RA: %s Current DEC: %s", RAStr, DecStr);
+    }
+
+    newRaDec(currentRA, currentDEC);
+    updates.flush();
 
     return true;
 }
 
+/*
+  Like INDI::Telescope::NewRaDec(), but through updates.
+*/
+
+void PiMount::newRaDec(double ra, double dec)
+{
+    switch (TrackState)
+    {
+    case SCOPE_SLEWING:
+    case SCOPE_PARKING:
+        EqNP.s = IPS_BUSY;
+        break;
+    case SCOPE_TRACKING:
+        EqNP.s = IPS_OK;
+        break;
+    default:
+        EqNP.s = IPS_IDLE;
+        break;
+    }
+
+    /* Not moving as INDI was told, see daemonControl(). */
+    if (havePosition && position.control != PIMOUNT_CONTROL_REMOTE &&
+        EqNP.s != IPS_IDLE)
+        EqNP.s = IPS_ALERT;
+
+    EqN[AXIS_RA].value = ra;
+    EqN[AXIS_DE].value = dec;
+    updates.changed(&EqNP);
+}
+
 bool PiMount::Goto(double r, double d)
 {
-    StartSlew(r, d, SCOPE_SLEWING);
-    return true;
+    return StartSlew(r, d, SCOPE_SLEWING);
 }
 
 bool PiMount::Sync(double ra, double dec)
 {
+    if (!havePosition)
+    {
+        LOG_ERROR("Can't sync, no position from the pimount daemon yet.");
+        return false;
+    }
+
+    double ha = rangeHA(get_local_sidereal_time(
+                            LocationN[LOCATION_LONGITUDE].value) - ra);
+
+    /*
+      The first sync also sets where the step counts start from, so
+      the mechanical position and the sky agree there.
+    */
+
+    if (model.size() == 0)
+    {
+        double mountHA = ha, mountDEC = dec;
+
+        /* Assume the counterweight is down. */
+        if (mountHA < 0)
+            flip(mountHA, mountDEC);
+
+        setReference(mountHA, mountDEC);
+
+        if (!model.add(ha, dec, ha, dec, ha < 0))
+            LOG_WARN("Unable to fit the pointing model.");
+    }
+    else
+    {
+        double mountHA, mountDEC;
+        bool flipped;
+
+        mountPosition(mountHA, mountDEC);
+        flipped = mountDEC > 90;
+        unflip(mountHA, mountDEC);
+
+        if (!model.add(ha, dec, mountHA, mountDEC, flipped))
+            LOG_WARN("Unable to fit the pointing model.");
+    }
+
+    updateModel();
+    LOGF_INFO("Pointing model: %zu points, RMS %.1f arcsec.",
+              model.size(), model.rms());
+
     currentRA  = ra;
     currentDEC = dec;
 
@@ -705,50 +1252,98 @@ bool PiMount::Sync(double ra, double dec)
 
     LOG_INFO("Sync is successful.");
 
-    EqNP.s = IPS_OK;
-
-    NewRaDec(currentRA, currentDEC);
+    newRaDec(currentRA, currentDEC);
 
     return true;
 }
 
 bool PiMount::Park()
 {
-    StartSlew(GetAxis1Park(), GetAxis2Park(), SCOPE_PARKING);
-    return true;
+    return StartSlew(GetAxis1Park(), GetAxis2Park(), SCOPE_PARKING);
 }
 
 // common code for GoTo and park
-void PiMount::StartSlew(double ra, double dec, TelescopeStatus status)
+bool PiMount::StartSlew(double ra, double dec, TelescopeStatus status)
 {
-    targetRA  = ra;
-    targetDEC = dec;
     char RAStr[64], DecStr[64];
+    double ha, mountHA, mountDEC;
+    double maxPositive[2], maxNegative[2], best[2] = { 0, 0 };
+    double limit, duration = -1;
+    int side = -1;
+
+    if (!havePosition)
+    {
+        LOG_ERROR("No position from the pimount daemon yet.");
+        return false;
+    }
+
+    fs_sexa(RAStr, ra, 2, 3600);
+    fs_sexa(DecStr, dec, 2, 3600);
+
+    /*
+      Where the target is now.  It moves West at the sidereal rate,
+      which the plan (relative to the sky) leaves out.
+    */
+
+    ha = rangeHA(get_local_sidereal_time(LocationN[LOCATION_LONGITUDE].value) -
+                 ra);
+    mountPosition(mountHA, mountDEC);
+
+    maxPositive[AXIS_RA] = LimitsN[LIMIT_RATE].value - TRACKRATE_SIDEREAL;
+    maxNegative[AXIS_RA] = LimitsN[LIMIT_RATE].value + TRACKRATE_SIDEREAL;
+    maxPositive[AXIS_DE] = maxNegative[AXIS_DE] = LimitsN[LIMIT_RATE].value;
+    limit = LimitsN[LIMIT_MERIDIAN].value / 15.0;
 
-    fs_sexa(RAStr, targetRA, 2, 3600);
-    fs_sexa(DecStr, targetDEC, 2, 3600);
+    /*
+      Try both sides of the pier, and take the quicker one that keeps
+      the counterweight within the limit -- at the start of tracking
+      too.
+    */
 
-    if (getSimulatePierSide())
+    for (int i = 0; i < 2; ++i)
     {
-        // set the pier side
-        TelescopePierSide newPierSide = expectedPierSide(targetRA);
+        double targetHA, targetDE, distance[2], t;
+
+        /* Mechanically, the model depends on the side. */
+        model.toMount(ha, dec, i == 1, targetHA, targetDE);
+
+        if (i == 1)
+            flip(targetHA, targetDE);
 
-        // check if a meridian flip is needed
-        if (newPierSide != currentPierSide)
+        distance[AXIS_RA] = (targetHA - mountHA) * 54000.0;
+        distance[AXIS_DE] = (targetDE - mountDEC) * 3600.0;
+        t = slew.plan(distance, maxPositive, maxNegative,
+                      LimitsN[LIMIT_ACCELERATION].value);
+
+        if (targetHA < -limit ||
+            targetHA + t * TRACKRATE_SIDEREAL / 54000.0 > 12 + limit)
+            continue;
+
+        if (side == -1 || t < duration)
         {
-            forceMeridianFlip = true;
-            setPierSide(newPierSide);
+            side = i;
+            duration = t;
+            best[AXIS_RA] = distance[AXIS_RA];
+            best[AXIS_DE] = distance[AXIS_DE];
         }
-        currentPierSide = newPierSide;
     }
 
-    if (IUFindOnSwitchIndex(&TrackModeSP) != SLEW_MAX)
+    if (side == -1)
     {
-        IUResetSwitch(&TrackModeSP);
-        TrackModeS[SLEW_MAX].s = ISS_ON;
-        IDSetSwitch(&TrackModeSP, nullptr);
+        LOGF_ERROR("RA: %s - DEC: %s can't be reached within the limits.",
+                   RAStr, DecStr);
+        return false;
     }
 
+    slew.plan(best, maxPositive, maxNegative,
+              LimitsN[LIMIT_ACCELERATION].value);
+    gettimeofday(&slewStart, nullptr);
+    slewFrom[AXIS_RA] = mountHA;
+    slewFrom[AXIS_DE] = mountDEC;
+
+    targetRA  = ra;
+    targetDEC = dec;
+
     const char * statusStr;
 
     switch (status)
@@ -765,9 +1360,13 @@ void PiMount::StartSlew(double ra, double dec, TelescopeStatus status)
 
     TrackState = status;
 
-    LOGF_INFO("%s to RA: %s - DEC: %s, pier side %s, %s",
-	      statusStr, RAStr, DecStr, getPierSideStr(currentPierSide),
-	      forceMeridianFlip ? "with flip" : "direct");
+    LOGF_INFO("%s to RA: %s - DEC: %s, pier side %s, %.0f s",
+	      statusStr, RAStr, DecStr,
+	      getPierSideStr((side == 0) ? PIER_EAST : PIER_WEST), duration);
+
+    updateRates();
+
+    return true;
 }
 
 bool PiMount::UnPark()
@@ -791,6 +1390,37 @@ bool PiMount::ISNewNumber(const char *dev, const char *name, double values[],
             return true;
         }
 
+        if (strcmp(name, PECSettingsNP.name) == 0)
+        {
+            double teeth = PECSettingsN[PEC_TEETH].value;
+
+            IUUpdateNumber(&PECSettingsNP, values, names, n);
+            PECSettingsNP.s = IPS_OK;
+            IDSetNumber(&PECSettingsNP, nullptr);
+
+            /* A different worm, the correction doesn't apply. */
+            if (teeth != PECSettingsN[PEC_TEETH].value && havePEC)
+            {
+                havePEC = false;
+                IUResetSwitch(&PECSP);
+                PECS[PEC_OFF].s = ISS_ON;
+                PECSP.s = IPS_IDLE;
+                IDSetSwitch(&PECSP, nullptr);
+                sendPEC();
+                LOG_INFO("Worm changed, periodic error correction cleared.");
+            }
+
+            return true;
+        }
+
+        if (strcmp(name, LimitsNP.name) == 0)
+        {
+            IUUpdateNumber(&LimitsNP, values, names, n);
+            LimitsNP.s = IPS_OK;
+            IDSetNumber(&LimitsNP, nullptr);
+            return true;
+        }
+
 	if (strcmp(name, "A_NEW_NUMBER") == 0)
 	{
 	    IUUpdateNumber(&ANewNumberVector, values, names, n);
@@ -827,6 +1457,72 @@ bool PiMount::ISNewSwitch(const char *dev, const char *name, ISState *states, ch
             return true;
         }
 
+        if (strcmp(name, ModelClearSP.name) == 0)
+        {
+            model.clear();
+            updateModel();
+            ModelClearS[0].s = ISS_OFF;
+            ModelClearSP.s = IPS_OK;
+            IDSetSwitch(&ModelClearSP, nullptr);
+            LOG_INFO("Pointing model cleared, the next sync starts a new one.");
+            return true;
+        }
+
+        if (strcmp(name, PECSP.name) == 0)
+        {
+            int previous = IUFindOnSwitchIndex(&PECSP);
+
+            if (IUUpdateSwitch(&PECSP, states, names, n) < 0)
+                return false;
+
+            switch (IUFindOnSwitchIndex(&PECSP))
+            {
+            case PEC_PLAY:
+                if (!havePEC)
+                {
+                    IUResetSwitch(&PECSP);
+                    PECS[previous].s = ISS_ON;
+                    PECSP.s = IPS_ALERT;
+                    IDSetSwitch(&PECSP, nullptr);
+                    LOG_ERROR("Nothing to play back, record the periodic "
+                              "error first.");
+                    return false;
+                }
+                break;
+
+            case PEC_RECORD:
+                if (!havePosition)
+                {
+                    IUResetSwitch(&PECSP);
+                    PECS[previous].s = ISS_ON;
+                    PECSP.s = IPS_ALERT;
+                    IDSetSwitch(&PECSP, nullptr);
+                    LOG_ERROR("No position from the pimount daemon yet.");
+                    return false;
+                }
+
+                /* Turns of the RA motor, in 1/8 steps, per turn of the worm. */
+                periodic.start(1296000.0 / (PECSettingsN[PEC_TEETH].value *
+                                            position.axes[AXIS_RA].scale));
+                PECStatusN[PEC_RECORDED].value = 0;
+                PECStatusNP.s = IPS_BUSY;
+                updates.changed(&PECStatusNP);
+                LOGF_INFO("Recording periodic error for %.0f turns of the "
+                          "worm, guide while tracking.",
+                          PECSettingsN[PEC_CYCLES].value);
+                break;
+
+            default:
+                break;
+            }
+
+            PECSP.s = (IUFindOnSwitchIndex(&PECSP) == PEC_RECORD) ?
+                IPS_BUSY : IPS_OK;
+            IDSetSwitch(&PECSP, nullptr);
+            sendPEC();
+            return true;
+        }
+
 #ifdef USE_EQUATORIAL_PE
         if (strcmp(name, "PE_NS") == 0)
         {
@@ -892,61 +1588,160 @@ bool PiMount::ISNewSwitch(const char *dev, const char *name, ISState *states, ch
 
 bool PiMount::Abort()
 {
+    struct server_message message;
+
+    guideCancel();
+
+    memset(&message, 0, sizeof(message));
+    message.command = SERVER_STOP;
+    sendRequest(message);
+    lastRate[AXIS_RA] = lastRate[AXIS_DE] = 0;
+
     return true;
 }
 
 bool PiMount::MoveNS(INDI_DIR_NS dir, TelescopeMotionCommand command)
 {
     INDI_UNUSED(dir);
-    INDI_UNUSED(command);
     if (TrackState == SCOPE_PARKED)
     {
         LOG_ERROR("Please unpark the mount before issuing any motion commands.");
         return false;
     }
 
+    // The base class updates MovementNSSP after this returns.
+    MovementNSSP.s = (command == MOTION_START) ? IPS_BUSY : IPS_IDLE;
+    updateRates();
+
     return true;
 }
 
 bool PiMount::MoveWE(INDI_DIR_WE dir, TelescopeMotionCommand command)
 {
     INDI_UNUSED(dir);
-    INDI_UNUSED(command);
     if (TrackState == SCOPE_PARKED)
     {
         LOG_ERROR("Please unpark the mount before issuing any motion commands.");
         return false;
     }
 
+    MovementWESP.s = (command == MOTION_START) ? IPS_BUSY : IPS_IDLE;
+    updateRates();
+
     return true;
 }
 
-IPState PiMount::GuideNorth(uint32_t ms)
+/*
+  A guide pulse adds GUIDE_RATE times sidereal to the axis rate, sent
+  to the daemon right away, and an INDI timer takes it off again after
+  'ms'.  Pulses on the two axes run at the same time.
+
+  A pulse on an axis that is still pulsing is added to what is left of
+  the first one, so no guiding is lost.
+*/
+
+IPState PiMount::guidePulse(int axis, double offset, uint32_t ms)
 {
-    guiderNSTarget[GUIDE_NORTH] = ms;
-    guiderNSTarget[GUIDE_SOUTH] = 0;
+    long net = ms;
+
+    if (TrackState != SCOPE_TRACKING)
+    {
+        LOG_ERROR("Guiding requires tracking.");
+        return IPS_ALERT;
+    }
+
+    if (axis == AXIS_RA && IUFindOnSwitchIndex(&PECSP) == PEC_RECORD)
+        periodic.correct(position.axes[AXIS_RA].position, offset * ms / 1000.0);
+
+    if (guideTimer[axis] != -1)
+    {
+        long left = std::max(0, IERemainingTimer(guideTimer[axis]));
+
+        IERmTimer(guideTimer[axis]);
+        guideTimer[axis] = -1;
+
+        net += ((guideOffset[axis] < 0) == (offset < 0)) ? left : -left;
+
+        if (net < 0)
+        {
+            offset = guideOffset[axis];
+            net = -net;
+        }
+    }
+
+    if (net == 0)
+    {
+        guideDone(axis);
+        return IPS_OK;
+    }
+
+    guideOffset[axis] = offset;
+    guideTimer[axis] = IEAddTimer(net, (axis == AXIS_RA) ?
+                                  guideTimeoutRA : guideTimeoutDE, this);
+    updateRates();
+
     return IPS_BUSY;
 }
 
+void PiMount::guideTimeoutRA(void *data)
+{
+    PiMount *self = static_cast<PiMount *>(data);
+
+    self->guideTimer[AXIS_RA] = -1;
+    self->guideDone(AXIS_RA);
+}
+
+void PiMount::guideTimeoutDE(void *data)
+{
+    PiMount *self = static_cast<PiMount *>(data);
+
+    self->guideTimer[AXIS_DE] = -1;
+    self->guideDone(AXIS_DE);
+}
+
+void PiMount::guideDone(int axis)
+{
+    guideOffset[axis] = 0;
+    updateRates();
+    GuideComplete(static_cast<INDI_EQ_AXIS>(axis));
+}
+
+void PiMount::guideCancel()
+{
+    for (int axis = AXIS_RA; axis <= AXIS_DE; ++axis)
+    {
+        if (guideTimer[axis] == -1)
+            continue;
+
+        IERmTimer(guideTimer[axis]);
+        guideTimer[axis] = -1;
+        guideOffset[axis] = 0;
+        GuideComplete(static_cast<INDI_EQ_AXIS>(axis));
+    }
+}
+
+IPState PiMount::GuideNorth(uint32_t ms)
+{
+    return guidePulse(AXIS_DE,
+                      TRACKRATE_SIDEREAL * GuideRateN[DEC_AXIS].value, ms);
+}
+
 IPState PiMount::GuideSouth(uint32_t ms)
 {
-    guiderNSTarget[GUIDE_SOUTH] = ms;
-    guiderNSTarget[GUIDE_NORTH] = 0;
-    return IPS_BUSY;
+    return guidePulse(AXIS_DE,
+                      -TRACKRATE_SIDEREAL * GuideRateN[DEC_AXIS].value, ms);
 }
 
 IPState PiMount::GuideEast(uint32_t ms)
 {
-    guiderEWTarget[GUIDE_EAST] = ms;
-    guiderEWTarget[GUIDE_WEST] = 0;
-    return IPS_BUSY;
+    return guidePulse(AXIS_RA,
+                      -TRACKRATE_SIDEREAL * GuideRateN[RA_AXIS].value, ms);
 }
 
 IPState PiMount::GuideWest(uint32_t ms)
 {
-    guiderEWTarget[GUIDE_WEST] = ms;
-    guiderEWTarget[GUIDE_EAST] = 0;
-    return IPS_BUSY;
+    return guidePulse(AXIS_RA,
+                      TRACKRATE_SIDEREAL * GuideRateN[RA_AXIS].value, ms);
 }
 
 bool PiMount::SetCurrentPark()
@@ -970,19 +1765,38 @@ bool PiMount::SetDefaultPark()
 
 bool PiMount::SetTrackMode(uint8_t mode)
 {
+    // TrackModeSP is already up to date, see updateTrackRate().
     INDI_UNUSED(mode);
+    updateTrackRate(true);
+    updateRates();
+
     return true;
 }
 
 bool PiMount::SetTrackEnabled(bool enabled)
 {
-    INDI_UNUSED(enabled);
+    if (enabled)
+        TrackState = SCOPE_TRACKING;
+    else if (TrackState == SCOPE_TRACKING)
+        TrackState = SCOPE_IDLE;
+
+    updateRates();
+
     return true;
 }
 
 bool PiMount::SetTrackRate(double raRate, double deRate)
 {
-    INDI_UNUSED(raRate);
-    INDI_UNUSED(deRate);
+    if (fabs(raRate) > MAX_RATE || fabs(deRate) > MAX_RATE)
+    {
+        LOGF_ERROR("Track rates are limited to %.0f arcsec/s.", MAX_RATE);
+        return false;
+    }
+
+    TrackRateN[AXIS_RA].value = raRate;
+    TrackRateN[AXIS_DE].value = deRate;
+    updateTrackRate(true);
+    updateRates();
+
     return true;
 }
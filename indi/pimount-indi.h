@@ -9,9 +9,18 @@
 
 #pragma once
 
+#include <sys/time.h>
+
 #include "indiguiderinterface.h"
 #include "inditelescope.h"
 
+#include "client.h"
+
+#include "periodic.h"
+#include "pointing.h"
+#include "slew.h"
+#include "updates.h"
+
 class PiMount : public INDI::Telescope, public INDI::GuiderInterface
 {
   public:
@@ -25,6 +34,7 @@ class PiMount : public INDI::Telescope, public INDI::GuiderInterface
     virtual bool initProperties() override;
     virtual void ISGetProperties(const char *dev) override;
     virtual bool updateProperties() override;
+    virtual bool saveConfigItems(FILE *fp) override;
 
     virtual bool ISNewNumber(const char *dev, const char *name, double values[],
 			     char *names[], int n) override;
@@ -61,13 +71,144 @@ private:
     double targetDEC { 0 };
 
     /// used by GoTo and Park
-    void StartSlew(double ra, double dec, TelescopeStatus status);
+    bool StartSlew(double ra, double dec, TelescopeStatus status);
 
-    bool forceMeridianFlip { false };
     unsigned int DBG_SCOPE { 0 };
 
-    double guiderEWTarget[2];
-    double guiderNSTarget[2];
+    /* Sent once per poll, from ReadScopeStatus(). */
+    PropertyUpdates updates;
+
+    void newRaDec(double ra, double dec);
+
+    /*
+      The connection to the pimount daemon (see ../client.h).  The
+      socket is watched by the INDI event loop, the daemon pushes the
+      step counts (position) every DAEMON_PERIOD ms.
+    */
+
+    struct client *daemon { nullptr };
+    int daemonFd { -1 };
+    int daemonCallback { -1 };
+    bool rebase { false };
+
+    static void clientAdded(struct client *client, int fd, void *data);
+    static void clientRemoved(struct client *client, int fd, void *data);
+    static void clientPushed(struct client *client,
+			     struct server_message *message, void *data);
+    static void clientInput(int fd, void *data);
+    static void clientReply(struct client *client,
+			    struct server_message *reply, int result,
+			    void *data);
+    static void clientRateReply(struct client *client,
+				struct server_message *reply, int result,
+				void *data);
+
+    void daemonAdded(int fd);
+    void daemonRemoved();
+    void daemonPushed(struct server_message *message);
+    void daemonControl(int control);
+    void daemonReply(int result);
+
+    void sendRequest(struct server_message &message);
+    void sendRate(int axis, double rate);
+    void updateRates();
+
+    /*
+      Where the mount points is worked out from the step counts: the
+      axes were at refSteps[] when the mount pointed at refHA (hours)
+      and refDEC (degrees).  Sync() moves the reference.
+    */
+
+    struct server_position position;
+    bool havePosition { false };
+    long long refSteps[2] { 0, 0 };
+    double refHA { 0 };
+    double refDEC { 90 };
+    double lastRate[2] { 0, 0 };
+
+    void mountPosition(double &ha, double &dec);
+    void setReference(double ha, double dec);
+
+    /*
+      Sync points build up the pointing model, which maps between the
+      sky and the mechanical position above.
+    */
+
+    PointingModel model;
+
+    void updateModel();
+
+    INumber ModelN[8];
+    INumberVectorProperty ModelNP;
+
+    ISwitch ModelClearS[1];
+    ISwitchVectorProperty ModelClearSP;
+
+    /*
+      Goto and Park follow a planned slew (see slew.h), which started
+      at slewStart from slewFrom[] (mechanical hour angle and
+      declination).
+    */
+
+    SlewPlan slew;
+    struct timeval slewStart;
+    double slewFrom[2];
+
+    double slewTime();
+    void slewError(double t, double error[2]);
+
+    /*
+      The tracking rate (arcsec/s, hour angle and declination) for the
+      track mode.  Refraction changes it as the mount moves, so it is
+      worked out again every TRACK_PERIOD seconds (at trackStamp).
+    */
+
+    double trackRate[2] { 0, 0 };
+    struct timeval trackStamp { 0, 0 };
+
+    void updateTrackRate(bool now);
+
+    /* Maximum rate, acceleration and how far past the meridian. */
+    INumber LimitsN[3];
+    INumberVectorProperty LimitsNP;
+
+    /*
+      Guide pulses, as a rate offset (arcsec/s) until the axis'
+      guideTimer (an INDI timer) goes off.
+    */
+
+    double guideOffset[2] { 0, 0 };
+    int guideTimer[2] { -1, -1 };
+
+    IPState guidePulse(int axis, double offset, uint32_t ms);
+    void guideDone(int axis);
+    void guideCancel();
+    static void guideTimeoutRA(void *data);
+    static void guideTimeoutDE(void *data);
+
+    /*
+      Periodic error correction, recorded here (see periodic.h) and
+      played back by the daemon (see ../pec.h).
+    */
+
+    PeriodicError periodic;
+    struct pec pec;
+    bool havePEC { false };
+
+    void sendPEC();
+    void recordPEC(const struct server_position &now);
+    void finishPEC();
+
+    ISwitch PECS[3];
+    ISwitchVectorProperty PECSP;
+
+    /* Turns to record, and teeth on the RA worm wheel. */
+    INumber PECSettingsN[2];
+    INumberVectorProperty PECSettingsNP;
+
+    /* Turns recorded, and the peak to peak error corrected. */
+    INumber PECStatusN[2];
+    INumberVectorProperty PECStatusNP;
 
     INumber ANewNumber[1];
     INumberVectorProperty ANewNumberVector;
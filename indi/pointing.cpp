@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+  pointing.cpp
+
+  See pointing.h.  The fit is linear least squares (normal equations)
+  using the small angle form of the model,
+
+    (mount HA - sky HA) cos(dec) =
+        IH cos(dec) + sign CH + sign NP sin(dec)
+        - MA cos(HA) sin(dec) + ME sin(HA) sin(dec)
+    mount DEC - sky DEC = sign ID + MA sin(HA) + ME cos(HA)
+
+  where sign is -1 for points taken flipped and 1 otherwise.
+
+  The hour angle equation is scaled by cos(dec) so both are in
+  arcseconds on the sky, otherwise points near the pole would swamp
+  the rest.
+*/
+
+#include "pointing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#define HOUR (M_PI / 12.0)
+#define DEGREE (M_PI / 180.0)
+#define ARCSEC (DEGREE / 3600.0)
+
+/* Keep sec(dec) and tan(dec) finite at the pole. */
+#define MIN_COS_DEC 1.7e-3
+
+static double wrap(double angle)
+{
+    angle = fmod(angle + M_PI, 2 * M_PI);
+
+    if (angle < 0)
+        angle += 2 * M_PI;
+
+    return angle - M_PI;
+}
+
+PointingModel::PointingModel()
+{
+    clear();
+}
+
+void PointingModel::clear()
+{
+    points.clear();
+    memset(terms, 0, sizeof(terms));
+    residual = 0;
+    update();
+}
+
+bool PointingModel::add(double skyHA, double skyDEC,
+                        double mountHA, double mountDEC, bool flipped)
+{
+    points.push_back({ skyHA, skyDEC, mountHA, mountDEC, flipped });
+
+    return fit();
+}
+
+/*
+  Solve A x = b (n x n, row major) in place by Gaussian elimination
+  with partial pivoting.  Returns false if A is (nearly) singular.
+*/
+
+static bool solve(double *a, double *b, int n)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        int pivot = i;
+
+        for (int j = i + 1; j < n; ++j)
+            if (fabs(a[j * n + i]) > fabs(a[pivot * n + i]))
+                pivot = j;
+
+        if (fabs(a[pivot * n + i]) < 1e-9)
+            return false;
+
+        if (pivot != i)
+        {
+            for (int k = 0; k < n; ++k)
+                std::swap(a[i * n + k], a[pivot * n + k]);
+            std::swap(b[i], b[pivot]);
+        }
+
+        for (int j = i + 1; j < n; ++j)
+        {
+            double f = a[j * n + i] / a[i * n + i];
+
+            for (int k = i; k < n; ++k)
+                a[j * n + k] -= f * a[i * n + k];
+            b[j] -= f * b[i];
+        }
+    }
+
+    for (int i = n - 1; i >= 0; --i)
+    {
+        for (int k = i + 1; k < n; ++k)
+            b[i] -= a[i * n + k] * b[k];
+        b[i] /= a[i * n + i];
+    }
+
+    return true;
+}
+
+/*
+  Fit as many terms as the points allow: one point only gives the
+  index errors, two add the polar axis, three or more fit everything.
+  If the points don't pin the terms down (all at the same declination,
+  for example) fall back to fewer.
+*/
+
+bool PointingModel::fit()
+{
+    static const Term sets[3][TERMS] = {
+        { IH, ID, MA, ME, CH, NP },
+        { IH, ID, MA, ME },
+        { IH, ID },
+    };
+    static const int sizes[3] = { 6, 4, 2 };
+    size_t n = points.size();
+
+    for (int s = (n >= 3) ? 0 : (n == 2) ? 1 : 2; s < 3; ++s)
+    {
+        int k = sizes[s];
+        double a[TERMS * TERMS] = { 0 };
+        double b[TERMS] = { 0 };
+        double sum = 0;
+
+        for (const Point &p : points)
+        {
+            double h = p.skyHA * HOUR, d = p.skyDEC * DEGREE;
+            double c = std::max(cos(d), MIN_COS_DEC);
+            double sign = p.flipped ? -1 : 1;
+            double row[2][TERMS], rhs[2];
+
+            row[0][IH] = c;
+            row[0][ID] = 0;
+            row[0][CH] = sign;
+            row[0][NP] = sign * sin(d);
+            row[0][MA] = -cos(h) * sin(d);
+            row[0][ME] = sin(h) * sin(d);
+            rhs[0] = wrap((p.mountHA - p.skyHA) * HOUR) * c;
+
+            row[1][IH] = 0;
+            row[1][ID] = sign;
+            row[1][CH] = 0;
+            row[1][NP] = 0;
+            row[1][MA] = sin(h);
+            row[1][ME] = cos(h);
+            rhs[1] = (p.mountDEC - p.skyDEC) * DEGREE;
+
+            for (int e = 0; e < 2; ++e)
+            {
+                for (int i = 0; i < k; ++i)
+                {
+                    for (int j = 0; j < k; ++j)
+                        a[i * k + j] += row[e][sets[s][i]] * row[e][sets[s][j]];
+                    b[i] += row[e][sets[s][i]] * rhs[e];
+                }
+            }
+        }
+
+        if (!solve(a, b, k))
+            continue;
+
+        memset(terms, 0, sizeof(terms));
+
+        for (int i = 0; i < k; ++i)
+            terms[sets[s][i]] = b[i];
+
+        update();
+
+        /* RMS of the distance on the sky, in arcseconds. */
+        for (const Point &p : points)
+        {
+            double ha, dec;
+
+            toSky(p.mountHA, p.mountDEC, p.flipped, ha, dec);
+            ha = wrap((ha - p.skyHA) * HOUR) * cos(p.skyDEC * DEGREE);
+            dec = (dec - p.skyDEC) * DEGREE;
+            sum += ha * ha + dec * dec;
+        }
+
+        residual = sqrt(sum / n) / ARCSEC;
+
+        return true;
+    }
+
+    return false;
+}
+
+void PointingModel::update()
+{
+    double ca = cos(terms[MA]), sa = sin(terms[MA]);
+    double ce = cos(-terms[ME]), se = sin(-terms[ME]);
+
+    /* Rx(MA) Ry(-ME) */
+    rotation[0][0] = ce;
+    rotation[0][1] = 0;
+    rotation[0][2] = se;
+    rotation[1][0] = sa * se;
+    rotation[1][1] = ca;
+    rotation[1][2] = -sa * ce;
+    rotation[2][0] = -ca * se;
+    rotation[2][1] = sa;
+    rotation[2][2] = ca * ce;
+}
+
+void PointingModel::toMount(double ha, double dec, bool flipped,
+                            double &mountHA, double &mountDEC) const
+{
+    double sign = flipped ? -1 : 1;
+    double h = ha * HOUR, d = dec * DEGREE;
+    double v[3] = { cos(d) * cos(h), cos(d) * sin(h), sin(d) };
+    double r[3];
+    double c;
+
+    for (int i = 0; i < 3; ++i)
+        r[i] = rotation[i][0] * v[0] + rotation[i][1] * v[1] +
+            rotation[i][2] * v[2];
+
+    h = atan2(r[1], r[0]);
+    d = asin(std::max(-1.0, std::min(1.0, r[2])));
+    c = std::max(cos(d), MIN_COS_DEC);
+
+    h += terms[IH] + sign * (terms[CH] / c + terms[NP] * sin(d) / c);
+    d += sign * terms[ID];
+
+    mountHA = wrap(h) / HOUR;
+    mountDEC = d / DEGREE;
+}
+
+void PointingModel::toSky(double mountHA, double mountDEC, bool flipped,
+                          double &ha, double &dec) const
+{
+    double sign = flipped ? -1 : 1;
+    double d = mountDEC * DEGREE - sign * terms[ID];
+    double c = std::max(cos(d), MIN_COS_DEC);
+    double h = mountHA * HOUR - terms[IH] -
+        sign * (terms[CH] / c + terms[NP] * sin(d) / c);
+    double v[3] = { cos(d) * cos(h), cos(d) * sin(h), sin(d) };
+    double r[3];
+
+    /* The inverse of a rotation is its transpose. */
+    for (int i = 0; i < 3; ++i)
+        r[i] = rotation[0][i] * v[0] + rotation[1][i] * v[1] +
+            rotation[2][i] * v[2];
+
+    ha = wrap(atan2(r[1], r[0])) / HOUR;
+    dec = asin(std::max(-1.0, std::min(1.0, r[2]))) / DEGREE;
+}
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+  pointing.h
+
+  A pointing model for the mount, fitted to sync points.
+
+  The mount has no encoders, so where it points (mechanically) is only
+  known from the step counts.  The difference between that and the sky
+  is modelled with the usual terms for an equatorial mount, all in
+  radians.
+
+    IH  hour angle index error
+    ID  declination index error
+    CH  cone (collimation) error
+    NP  non-perpendicularity of the axes
+    MA  polar axis azimuth error (east/west)
+    ME  polar axis elevation error
+
+  Mechanical and sky positions are hour angle (hours) and declination
+  (degrees).  The polar axis terms are applied as a rotation, the rest
+  as offsets; the rotation matrix is only rebuilt when the model is
+  refitted.
+
+  Mechanical positions are given unflipped, with 'flipped' set if the
+  mount is past the pole (PIER_WEST).  There ID, CH and NP change
+  sign, so points on both sides of the meridian fit one model.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+class PointingModel
+{
+  public:
+    enum Term { IH, ID, CH, NP, MA, ME, TERMS };
+
+    PointingModel();
+
+    void clear();
+
+    /* Add a sync point and refit.  Returns false if the fit failed. */
+    bool add(double skyHA, double skyDEC,
+             double mountHA, double mountDEC, bool flipped);
+
+    size_t size() const { return points.size(); }
+
+    /* The fitted terms (radians) and the RMS of the fit (arcseconds). */
+    double term(Term t) const { return terms[t]; }
+    double rms() const { return residual; }
+
+    void toMount(double ha, double dec, bool flipped,
+                 double &mountHA, double &mountDEC) const;
+    void toSky(double mountHA, double mountDEC, bool flipped,
+               double &ha, double &dec) const;
+
+  private:
+    struct Point
+    {
+        double skyHA, skyDEC;
+        double mountHA, mountDEC;
+        bool flipped;
+    };
+
+    std::vector<Point> points;
+    double terms[TERMS];
+    double residual { 0 };
+
+    /* Rotation for the polar axis terms, sky to mount. */
+    double rotation[3][3];
+
+    bool fit();
+    void update();
+};
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+  slew.cpp
+
+  See slew.h.
+*/
+
+#include "slew.h"
+
+#include <algorithm>
+#include <cmath>
+
+double SlewPlan::minimumTime(double distance, double rate,
+                             double acceleration)
+{
+    distance = fabs(distance);
+
+    /* Not enough room to reach 'rate', a triangle. */
+    if (distance < rate * rate / acceleration)
+        return 2.0 * sqrt(distance / acceleration);
+
+    /* A trapezoid, ramping up and down takes rate/acceleration each. */
+    return distance / rate + rate / acceleration;
+}
+
+double SlewPlan::plan(const double distance[2], const double maxPositive[2],
+                      const double maxNegative[2], double acceleration)
+{
+    this->acceleration = acceleration;
+    total = 0;
+
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        double rate = (distance[axis] < 0) ? maxNegative[axis] :
+            maxPositive[axis];
+
+        total = std::max(total, minimumTime(distance[axis], rate,
+                                            acceleration));
+    }
+
+    /*
+      Cruise at v so the axis takes exactly 'total',
+
+        |distance| = v (total - v / acceleration)
+
+      taking the smaller root.
+    */
+
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        Profile &p = axes[axis];
+        double d = fabs(distance[axis]);
+        double a = acceleration, t = total;
+        double v = 0;
+
+        if (d > 0 && t > 0)
+            v = (a * t - sqrt(std::max(0.0, a * a * t * t - 4.0 * a * d))) /
+                2.0;
+
+        p.distance = distance[axis];
+        p.cruise = (distance[axis] < 0) ? -v : v;
+        p.ramp = v / a;
+    }
+
+    return total;
+}
+
+double SlewPlan::position(int axis, double t) const
+{
+    const Profile &p = axes[axis];
+    double a = (p.cruise < 0) ? -acceleration : acceleration;
+
+    if (t <= 0)
+        return 0;
+
+    if (t >= total)
+        return p.distance;
+
+    if (t < p.ramp)
+        return a * t * t / 2.0;
+
+    if (t > total - p.ramp)
+    {
+        double left = total - t;
+
+        return p.distance - a * left * left / 2.0;
+    }
+
+    return p.cruise * (t - p.ramp / 2.0);
+}
+
+double SlewPlan::velocity(int axis, double t) const
+{
+    const Profile &p = axes[axis];
+    double a = (p.cruise < 0) ? -acceleration : acceleration;
+
+    if (t <= 0 || t >= total)
+        return 0;
+
+    if (t < p.ramp)
+        return a * t;
+
+    if (t > total - p.ramp)
+        return a * (total - t);
+
+    return p.cruise;
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+  slew.h
+
+  Plans a slew as a velocity profile for each axis: accelerate at
+  'acceleration' up to a cruise rate, cruise, and decelerate to a
+  stop.  Whichever axis needs longer sets the duration; the other
+  cruises slower so both arrive together.
+
+  Everything is in arcseconds and seconds, relative to the sky, so the
+  RA axis moves at the tracking rate on top of the planned velocity.
+  That is why the RA limits differ by direction -- going West, the
+  tracking rate uses up part of the maximum rate.
+*/
+
+#pragma once
+
+class SlewPlan
+{
+  public:
+    /*
+      distance[] is how far each axis has to go.  The maximum rate for
+      each axis is given for the positive and negative directions.
+      Returns the duration.
+    */
+    double plan(const double distance[2], const double maxPositive[2],
+                const double maxNegative[2], double acceleration);
+
+    double duration() const { return total; }
+
+    /* Where each axis should be, and how fast it should be going, t
+       seconds after the start. */
+    double position(int axis, double t) const;
+    double velocity(int axis, double t) const;
+
+    double distance(int axis) const { return axes[axis].distance; }
+
+    /* The shortest time to move 'distance' at up to 'rate'. */
+    static double minimumTime(double distance, double rate,
+                              double acceleration);
+
+  private:
+    struct Profile
+    {
+        double distance { 0 };
+        double cruise { 0 };    // signed
+        double ramp { 0 };      // time to reach cruise
+    };
+
+    Profile axes[2];
+    double acceleration { 1 };
+    double total { 0 };
+};
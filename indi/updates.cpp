@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+  updates.cpp
+
+  See updates.h.
+*/
+
+#include "updates.h"
+
+#include <cmath>
+
+void PropertyUpdates::add(INumberVectorProperty *property, double resolution,
+                          double interval)
+{
+    Entry entry;
+
+    entry.number = property;
+    entry.resolution = resolution;
+    entry.interval = interval;
+    entries.push_back(entry);
+}
+
+void PropertyUpdates::add(ISwitchVectorProperty *property, double interval)
+{
+    Entry entry;
+
+    entry.switches = property;
+    entry.interval = interval;
+    entries.push_back(entry);
+}
+
+void PropertyUpdates::changed(const void *property)
+{
+    for (auto &entry : entries)
+        if (entry.number == property || entry.switches == property)
+            entry.dirty = true;
+}
+
+void PropertyUpdates::reset()
+{
+    for (auto &entry : entries)
+        entry.sent = false;
+}
+
+/*
+  Is the property far enough from what was sent last to be worth
+  sending?  Switches are compared exactly.
+*/
+
+bool PropertyUpdates::significant(const Entry &entry) const
+{
+    if (!entry.sent)
+        return true;
+
+    if (entry.number != nullptr)
+    {
+        if (entry.number->s != entry.state)
+            return true;
+
+        for (int i = 0; i < entry.number->nnp; ++i)
+            if (fabs(entry.number->np[i].value - entry.values[i]) >=
+                entry.resolution)
+                return true;
+    }
+    else
+    {
+        if (entry.switches->s != entry.state)
+            return true;
+
+        for (int i = 0; i < entry.switches->nsp; ++i)
+            if (entry.switches->sp[i].s != static_cast<ISState>(entry.values[i]))
+                return true;
+    }
+
+    return false;
+}
+
+void PropertyUpdates::send(Entry &entry, const struct timeval &now)
+{
+    entry.values.clear();
+
+    if (entry.number != nullptr)
+    {
+        for (int i = 0; i < entry.number->nnp; ++i)
+            entry.values.push_back(entry.number->np[i].value);
+
+        entry.state = entry.number->s;
+        IDSetNumber(entry.number, nullptr);
+    }
+    else
+    {
+        for (int i = 0; i < entry.switches->nsp; ++i)
+            entry.values.push_back(entry.switches->sp[i].s);
+
+        entry.state = entry.switches->s;
+        IDSetSwitch(entry.switches, nullptr);
+    }
+
+    entry.sent = true;
+    entry.dirty = false;
+    entry.last = now;
+}
+
+void PropertyUpdates::flush()
+{
+    struct timeval now, elapsed;
+
+    gettimeofday(&now, nullptr);
+
+    for (auto &entry : entries)
+    {
+        if (!entry.dirty)
+            continue;
+
+        if (!significant(entry))
+        {
+            entry.dirty = false;
+            continue;
+        }
+
+        IPState state = (entry.number != nullptr) ? entry.number->s :
+            entry.switches->s;
+
+        /* Too soon, unless the state changed; try again next flush. */
+        timersub(&now, &entry.last, &elapsed);
+
+        if (entry.sent && state == entry.state &&
+            elapsed.tv_sec + elapsed.tv_usec / 1e6 < entry.interval)
+            continue;
+
+        send(entry, now);
+    }
+}
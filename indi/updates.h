@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+  updates.h
+
+  Outgoing property updates, sent once per poll instead of as things
+  happen.  Changing a property just marks it; flush() then sends the
+  ones that changed by at least their resolution (or changed state),
+  each no more often than its interval.  A state change is always sent
+  right away, so clients see slews start and finish on time.
+*/
+
+#pragma once
+
+#include <sys/time.h>
+
+#include <vector>
+
+#include "indidevapi.h"
+
+class PropertyUpdates
+{
+  public:
+    /*
+      Watch a property.  'resolution' is in the units of the number
+      elements, 'interval' in seconds.
+    */
+    void add(INumberVectorProperty *property, double resolution,
+             double interval);
+    void add(ISwitchVectorProperty *property, double interval);
+
+    /* Something in the property changed, send it with the next flush(). */
+    void changed(const void *property);
+
+    void flush();
+
+    /* Clients (re)connected, the next flush() sends everything marked. */
+    void reset();
+
+  private:
+    struct Entry
+    {
+        INumberVectorProperty *number { nullptr };
+        ISwitchVectorProperty *switches { nullptr };
+        double resolution { 0 };
+        double interval { 0 };
+        bool dirty { false };
+        bool sent { false };
+        IPState state { IPS_IDLE };
+        std::vector<double> values;
+        struct timeval last { 0, 0 };
+    };
+
+    bool significant(const Entry &entry) const;
+    void send(Entry &entry, const struct timeval &now);
+
+    std::vector<Entry> entries;
+};
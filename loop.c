@@ -0,0 +1,543 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  loop.c
+
+  See loop.h.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/signalfd.h>
+#include <sys/eventfd.h>
+
+#include "pimount.h"
+#include "timespec.h"
+#include "loop.h"
+
+/*
+  ==============================================================================
+  Private
+  ==============================================================================
+*/
+
+/* epoll data for the loop's own descriptors, after the LOOP_FDS slots. */
+
+#define LOOP_TIMER_FD  (LOOP_FDS + 0)
+#define LOOP_SIGNAL_FD (LOOP_FDS + 1)
+#define LOOP_STOP_FD   (LOOP_FDS + 2)
+
+struct timer {
+	loop_timer_function function;
+	void *data;
+	struct timespec due;
+	struct timespec slack;
+	bool active;		/* 'due' is set */
+};
+
+struct watch {
+	int fd;			/* -1 if the slot is free */
+	loop_fd_function function;
+	void *data;
+};
+
+static struct {
+	pthread_mutex_t mutex;
+	int epoll_fd;
+	int timer_fd;
+	int signal_fd;
+	int stop_fd;
+	struct timer timers[LOOP_TIMERS];
+	unsigned count;
+	struct watch watches[LOOP_FDS];
+	struct timespec armed;
+	bool is_armed;
+} global = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.epoll_fd = -1,
+	.timer_fd = -1,
+	.signal_fd = -1,
+	.stop_fd = -1,
+	.count = 0,
+	.is_armed = false
+};
+
+/*
+  ------------------------------------------------------------------------------
+  add
+
+  Add one of the loop's own descriptors to epoll.
+*/
+
+static int
+add(int fd, uint32_t which)
+{
+	struct epoll_event event;
+
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.u32 = which;
+
+	if (-1 == epoll_ctl(global.epoll_fd, EPOLL_CTL_ADD, fd, &event)) {
+		fprintf(stderr, "%s:%d - epoll_ctl() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  arm
+
+  Set the timerfd for the earliest time any active timer reaches the
+  end of its slack.  Call with the mutex held.
+*/
+
+static void
+arm(void)
+{
+	struct itimerspec setting;
+	struct timespec latest;
+	bool any = false;
+	unsigned i;
+
+	for (i = 0; i < global.count; ++i) {
+		struct timer *timer = &global.timers[i];
+		struct timespec end;
+
+		if (!timer->active)
+			continue;
+
+		end = timespec_add(timer->due, timer->slack);
+
+		if (!any || timespec_lt(end, latest))
+			latest = end;
+
+		any = true;
+	}
+
+	if (any == global.is_armed &&
+	    (!any || timespec_eq(latest, global.armed)))
+		return;
+
+	memset(&setting, 0, sizeof(setting));
+
+	if (any)
+		setting.it_value = latest;
+
+	if (-1 == timerfd_settime(global.timer_fd, TFD_TIMER_ABSTIME,
+				  &setting, NULL)) {
+		fprintf(stderr, "%s:%d - timerfd_settime() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return;
+	}
+
+	global.armed = latest;
+	global.is_armed = any;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  run_timers
+
+  Run every timer that is due, including any a callback makes due.
+*/
+
+static void
+run_timers(void)
+{
+	struct timespec now;
+	unsigned i;
+	bool ran;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	lock(&global.mutex);
+
+	/* The timerfd has fired, so it is no longer set. */
+	global.is_armed = false;
+
+	do {
+		ran = false;
+
+		for (i = 0; i < global.count; ++i) {
+			struct timer *timer = &global.timers[i];
+			struct timespec due;
+			struct timespec next;
+			double delay;
+
+			if (!timer->active || timespec_gt(timer->due, now))
+				continue;
+
+			due = timer->due;
+			timer->active = false;
+			unlock(&global.mutex);
+
+			delay = timer->function(timer->data, now);
+
+			lock(&global.mutex);
+			ran = true;
+
+			if (0.0 > delay)
+				continue;
+
+			next = timespec_add(due, timespec_from_double(delay));
+
+			/* After a stall, start again from now. */
+			if (timespec_le(next, now))
+				next = timespec_add(now,
+						    timespec_from_double(delay));
+
+			/* Unless loop_schedule() wants it sooner. */
+			if (!timer->active || timespec_lt(next, timer->due)) {
+				timer->due = next;
+				timer->active = true;
+			}
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &now);
+	} while (ran);
+
+	arm();
+	unlock(&global.mutex);
+
+	return;
+}
+
+/*
+  ==============================================================================
+  Public
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  loop_initialize
+*/
+
+int
+loop_initialize(const sigset_t *signals)
+{
+	unsigned i;
+
+	for (i = 0; i < LOOP_FDS; ++i)
+		global.watches[i].fd = -1;
+
+	global.count = 0;
+	global.is_armed = false;
+	global.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	global.timer_fd = timerfd_create(CLOCK_MONOTONIC,
+					 TFD_NONBLOCK | TFD_CLOEXEC);
+	global.stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+	if (-1 == global.epoll_fd || -1 == global.timer_fd ||
+	    -1 == global.stop_fd) {
+		fprintf(stderr, "%s:%d - loop_initialize() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+		loop_finalize();
+
+		return -1;
+	}
+
+	if (NULL != signals) {
+		global.signal_fd = signalfd(-1, signals,
+					    SFD_NONBLOCK | SFD_CLOEXEC);
+
+		if (-1 == global.signal_fd) {
+			fprintf(stderr, "%s:%d - signalfd() failed: %s\n",
+				__FILE__, __LINE__, strerror(errno));
+			loop_finalize();
+
+			return -1;
+		}
+	}
+
+	if (add(global.timer_fd, LOOP_TIMER_FD) ||
+	    add(global.stop_fd, LOOP_STOP_FD) ||
+	    (-1 != global.signal_fd &&
+	     add(global.signal_fd, LOOP_SIGNAL_FD))) {
+		loop_finalize();
+
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  loop_finalize
+
+  Closes the loop's own descriptors, not those given to loop_fd().
+*/
+
+void
+loop_finalize(void)
+{
+	if (-1 != global.signal_fd)
+		close(global.signal_fd);
+
+	if (-1 != global.stop_fd)
+		close(global.stop_fd);
+
+	if (-1 != global.timer_fd)
+		close(global.timer_fd);
+
+	if (-1 != global.epoll_fd)
+		close(global.epoll_fd);
+
+	global.signal_fd = -1;
+	global.stop_fd = -1;
+	global.timer_fd = -1;
+	global.epoll_fd = -1;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  loop_timer
+*/
+
+int
+loop_timer(loop_timer_function function, void *data,
+	   double delay, double slack)
+{
+	struct timer *timer;
+	struct timespec now;
+	int index;
+
+	lock(&global.mutex);
+
+	if (LOOP_TIMERS <= global.count) {
+		unlock(&global.mutex);
+		fprintf(stderr, "%s:%d - Too Many Timers\n",
+			__FILE__, __LINE__);
+
+		return -1;
+	}
+
+	index = global.count++;
+	timer = &global.timers[index];
+	timer->function = function;
+	timer->data = data;
+	timer->slack = timespec_from_double(slack);
+	timer->active = (0.0 <= delay);
+
+	if (timer->active) {
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		timer->due = timespec_add(now, timespec_from_double(delay));
+		arm();
+	}
+
+	unlock(&global.mutex);
+
+	return index;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  loop_schedule
+*/
+
+int
+loop_schedule(int index, double delay)
+{
+	struct timer *timer;
+	struct timespec due;
+
+	if (0 > index || LOOP_TIMERS <= index)
+		return -1;
+
+	clock_gettime(CLOCK_MONOTONIC, &due);
+	due = timespec_add(due, timespec_from_double(delay));
+
+	lock(&global.mutex);
+
+	if ((unsigned)index >= global.count) {
+		unlock(&global.mutex);
+
+		return -1;
+	}
+
+	timer = &global.timers[index];
+
+	if (!timer->active || timespec_lt(due, timer->due)) {
+		timer->due = due;
+		timer->active = true;
+		arm();
+	}
+
+	unlock(&global.mutex);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  loop_fd
+*/
+
+int
+loop_fd(int fd, loop_fd_function function, void *data)
+{
+	struct epoll_event event;
+	unsigned i;
+
+	for (i = 0; i < LOOP_FDS; ++i)
+		if (-1 == global.watches[i].fd)
+			break;
+
+	if (LOOP_FDS == i) {
+		fprintf(stderr, "%s:%d - Too Many Descriptors\n",
+			__FILE__, __LINE__);
+
+		return -1;
+	}
+
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.u32 = i;
+
+	if (-1 == epoll_ctl(global.epoll_fd, EPOLL_CTL_ADD, fd, &event)) {
+		fprintf(stderr, "%s:%d - epoll_ctl() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return -1;
+	}
+
+	global.watches[i].fd = fd;
+	global.watches[i].function = function;
+	global.watches[i].data = data;
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  loop_remove_fd
+
+  Call before closing 'fd'.
+*/
+
+void
+loop_remove_fd(int fd)
+{
+	unsigned i;
+
+	for (i = 0; i < LOOP_FDS; ++i) {
+		if (fd != global.watches[i].fd)
+			continue;
+
+		epoll_ctl(global.epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+		global.watches[i].fd = -1;
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  loop_run
+*/
+
+int
+loop_run(void)
+{
+	struct epoll_event events[LOOP_FDS + 3];
+	struct signalfd_siginfo info;
+	uint64_t value;
+	int count;
+	int i;
+
+	for (;;) {
+		count = epoll_wait(global.epoll_fd, events,
+				   sizeof(events) / sizeof(events[0]), -1);
+
+		if (-1 == count) {
+			if (EINTR == errno)
+				continue;
+
+			fprintf(stderr, "%s:%d - epoll_wait() failed: %s\n",
+				__FILE__, __LINE__, strerror(errno));
+
+			return -1;
+		}
+
+		for (i = 0; i < count; ++i) {
+			uint32_t which = events[i].data.u32;
+			struct watch *watch;
+
+			switch (which) {
+			case LOOP_TIMER_FD:
+				/* Just to clear it, how many doesn't matter. */
+				if (-1 == read(global.timer_fd,
+					       &value, sizeof(value)) &&
+				    EAGAIN != errno)
+					fprintf(stderr,
+						"%s:%d - read() failed: %s\n",
+						__FILE__, __LINE__,
+						strerror(errno));
+
+				run_timers();
+				break;
+			case LOOP_SIGNAL_FD:
+				if (sizeof(info) == read(global.signal_fd,
+							 &info, sizeof(info)))
+					return (int)info.ssi_signo;
+
+				break;
+			case LOOP_STOP_FD:
+				if (sizeof(value) == read(global.stop_fd,
+							  &value,
+							  sizeof(value)))
+					return 0;
+
+				break;
+			default:
+				watch = &global.watches[which];
+
+				/* Removed by an earlier callback? */
+				if (-1 != watch->fd)
+					watch->function(watch->fd,
+							watch->data);
+
+				break;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  loop_stop
+*/
+
+void
+loop_stop(void)
+{
+	uint64_t value = 1;
+
+	if (sizeof(value) != write(global.stop_fd, &value, sizeof(value)))
+		fprintf(stderr, "%s:%d - write() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+	return;
+}
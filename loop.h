@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  loop.h
+
+  The housekeeping loop.  Fan control, telemetry, the display and the
+  joystick are mostly asleep, so instead of a thread each they are
+  callbacks run by one thread (main's) from epoll.
+
+  Timers share one timerfd.  A timer may run up to 'slack' seconds
+  after it is due, and the timerfd is set for the latest time that
+  keeps every timer within its slack, so timers due at about the same
+  time are run on one wakeup.
+
+  Callbacks run in the loop's thread, one at a time, and must not
+  block.  loop_schedule() and loop_stop() can be called from any
+  thread.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _LOOP_H_
+#define _LOOP_H_
+
+#include <signal.h>
+#include <time.h>
+
+#define LOOP_TIMERS 8
+#define LOOP_FDS 8
+
+/*
+  A timer's callback returns the seconds, from when it was due, until
+  it should run again, or LOOP_NEVER to wait for loop_schedule().
+*/
+
+#define LOOP_NEVER -1.0
+
+typedef double (*loop_timer_function)(void *data, struct timespec now);
+
+/* Called when 'fd' is readable, or has hung up. */
+
+typedef void (*loop_fd_function)(int fd, void *data);
+
+/*
+  'signals' (or NULL) end loop_run().  They must be blocked in all
+  threads, so block them before starting any (pigpio's included).
+*/
+
+int loop_initialize(const sigset_t *signals);
+void loop_finalize(void);
+
+/* Returns the timer, for loop_schedule(), or -1. */
+
+int loop_timer(loop_timer_function function, void *data,
+	       double delay, double slack);
+
+/* Run 'timer' within 'delay' seconds, unless it is due sooner. */
+
+int loop_schedule(int timer, double delay);
+
+int loop_fd(int fd, loop_fd_function function, void *data);
+void loop_remove_fd(int fd);
+
+/*
+  Run until one of the signals arrives (returning it) or loop_stop()
+  is called (returning 0).  Returns -1 on errors.
+*/
+
+int loop_run(void);
+void loop_stop(void);
+
+#endif	/* _LOOP_H_ */
@@ -23,6 +23,8 @@
 #include <signal.h>
 #include <limits.h>
 #include <fcntl.h>
+#include <errno.h>
+#include <math.h>
 #include <pthread.h>
 #include <arpa/inet.h>
 #include <linux/joystick.h>
@@ -31,39 +33,24 @@
 
 #include "pimount.h"
 #include "server.h"
+#include "http.h"
 #include "fan.h"
 #include "pins.h"
 #include "timespec.h"
 #include "stepper.h"
+#include "steps.h"
 #include "stats.h"
+#include "recorder.h"
+#include "loop.h"
+#include "power.h"
 
 char *cmdErrStr(int);
 
-static pthread_t fan_thread;
-static pthread_t controller_thread;
 static pthread_t server_thread;
 
-/*
-  ------------------------------------------------------------------------------
-  handler
-*/
+/* Late by up to this much, to share a wakeup (see loop.h). */
 
-static void
-handler(__attribute__((unused)) int signal)
-{
-	stats_finalize();
-	stepper_finalize();
-	pthread_cancel(server_thread);
-	pthread_join(server_thread, NULL);
-	pthread_cancel(controller_thread);
-	pthread_join(controller_thread, NULL);
-	pthread_cancel(fan_thread);
-	pthread_join(fan_thread, NULL);
-
-	gpioTerminate();
-
-	pthread_exit(NULL);
-}
+#define FAN_SLACK 0.5
 
 /*
   ------------------------------------------------------------------------------
@@ -74,7 +61,12 @@ static void
 usage(int exit_code)
 {
 	printf("Usage: pimount\n"
-	       "\t--help|-h  Display this wonderful help text...\n");
+	       "\t--help|-h  Display this wonderful help text...\n"
+	       "\t--port|-p  Control port (default %d)\n"
+	       "\t--http|-w  HTTP port, 0 to disable (default %d)\n"
+	       "\t--record|-r <file>  Record the session (see recorder.h)\n"
+	       "\t--fan|-f <degrees>  Fan setpoint (default %.0f)\n",
+	       SERVER_DEFAULT_PORT, HTTP_DEFAULT_PORT, FAN_SETPOINT);
 
 	exit(exit_code);
 }
@@ -82,25 +74,46 @@ usage(int exit_code)
 /*
   ------------------------------------------------------------------------------
   controller
+
+  The c_*() functions are also used by the web user interface (see
+  http.c).
+*/
+
+/*
+  The stick: outside a deadzone, its position (shaped by an expo curve,
+  (1 - STICK_EXPO) * x + STICK_EXPO * x^3) is a rate, up to the axis's
+  maximum, added to the axis's rate when the stick was pushed.  So the
+  stick nudges tracking, and centering it goes back to tracking, the
+  base rate exactly.  Rates are changed on the running axis
+  (stepper_set_rate()), no more than once per step at the faster of
+  the current and new rates, and never held back longer than
+  STICK_HOLD.
 */
 
+#define STICK_FULL 32767
+#define STICK_DEADZONE 0.10	/* of full travel */
+#define STICK_EXPO 0.6		/* 0 is linear, 1 cubic */
+#define STICK_RESOLUTION 0.05	/* arc-seconds per second */
+#define STICK_HOLD 0.1		/* seconds */
+
+struct stick {
+	enum stepper_axis axis;
+	double maximum;		/* arc-seconds per second */
+	double offset;		/* from the stick, 0.0 when centered */
+	double base;		/* the rate when the stick was pushed */
+	bool pushed;
+	bool warned;		/* not in local control */
+	struct timespec applied;
+};
+
 struct controller {
 	char joystick[80];
 	int joystick_fd;
+	int timer;		/* runs stick_apply() */
+	struct stick sticks[2];	/* X is RA, Y is DEC */
 };
 
-static void
-controller_cleanup(void *input)
-{
-	struct controller *controller_input;
-
-	controller_input = (struct controller *)input;
-
-	if (-1 != controller_input->joystick_fd)
-		close(controller_input->joystick_fd);
-}
-
-static void
+void
 c_stop(void)
 {
 	int rc;
@@ -110,6 +123,7 @@ c_stop(void)
 	state.ra_rate = 0.0;
 	state.dec_rate = 0.0;
 	state.control = PIMOUNT_CONTROL_OFF;
+	stats_notify(STATS_CHANGE_CONTROL | STATS_CHANGE_RATE);
 	
 	rc = stepper_stop(STEPPER_AXIS_DEC);
 
@@ -131,7 +145,7 @@ c_stop(void)
 	return;
 }
 
-static void
+void
 c_remote(void)
 {
 	int rc;
@@ -141,6 +155,7 @@ c_remote(void)
 	state.ra_rate = 0.0;
 	state.dec_rate = 0.0;
 	state.control = PIMOUNT_CONTROL_REMOTE;
+	stats_notify(STATS_CHANGE_CONTROL | STATS_CHANGE_RATE);
 
 	rc = stepper_stop(STEPPER_AXIS_DEC);
 
@@ -162,7 +177,7 @@ c_remote(void)
 	return;
 }
 
-static void
+void
 c_local(void)
 {
 	int rc;
@@ -172,6 +187,7 @@ c_local(void)
 	state.ra_rate = 0.0;
 	state.dec_rate = 0.0;
 	state.control = PIMOUNT_CONTROL_LOCAL;
+	stats_notify(STATS_CHANGE_CONTROL | STATS_CHANGE_RATE);
 
 	rc = stepper_stop(STEPPER_AXIS_DEC);
 
@@ -193,7 +209,7 @@ c_local(void)
 	return;
 }
 
-static void
+void
 c_track(void)
 {
 	int rc;
@@ -210,6 +226,7 @@ c_track(void)
 
 	state.dec_rate = 0.0;
 	state.ra_rate = 15.0;
+	stats_notify(STATS_CHANGE_RATE);
 
 	rc = stepper_stop(STEPPER_AXIS_DEC);
 
@@ -238,7 +255,7 @@ c_track(void)
 	return;
 }
 
-static void
+void
 c_ra(bool positive)
 {
 	int rc;
@@ -284,24 +301,14 @@ c_ra(bool positive)
 	}
 
 	if (something_changed) {
-		rc = stepper_stop(STEPPER_AXIS_RA);
+		stats_notify(STATS_CHANGE_RATE);
 
-		if (rc) {
-			unlock(&state.mutex);
+		/* Without restarting the thread, stops it at 0.0. */
+		rc = stepper_set_rate(STEPPER_AXIS_RA, state.ra_rate);
+
+		if (rc)
 			fprintf(stderr,
 				"%s:%d - rc=%d\n", __FILE__, __LINE__, rc);
-		}
-
-		if (0.0 != state.ra_rate) {
-			rc = stepper_start(STEPPER_AXIS_RA, state.ra_rate, 0);
-
-			if (rc) {
-				unlock(&state.mutex);
-				fprintf(stderr,
-					"%s:%d - rc=%d\n",
-					__FILE__, __LINE__, rc);
-			}
-		}
 	}
 
 	unlock(&state.mutex);
@@ -309,7 +316,7 @@ c_ra(bool positive)
 	return;
 }
 
-static void
+void
 c_dec(bool positive)
 {
 	int rc;
@@ -355,120 +362,278 @@ c_dec(bool positive)
 	}
 
 	if (something_changed) {
-		rc = stepper_stop(STEPPER_AXIS_DEC);
+		stats_notify(STATS_CHANGE_RATE);
 
-		if (rc) {
-			unlock(&state.mutex);
+		/* Without restarting the thread, stops it at 0.0. */
+		rc = stepper_set_rate(STEPPER_AXIS_DEC, state.dec_rate);
+
+		if (rc)
 			fprintf(stderr,
 				"%s:%d - rc=%d\n", __FILE__, __LINE__, rc);
+	}
+
+	unlock(&state.mutex);
+
+	return;
+}
+
+/*
+  Position, -STICK_FULL...STICK_FULL, to rate.
+*/
+
+static double
+stick_shape(int value, double maximum)
+{
+	double x;
+
+	x = fabs((double)value / STICK_FULL);
+
+	if (STICK_DEADZONE >= x)
+		return 0.0;
+
+	x = fmin((x - STICK_DEADZONE) / (1.0 - STICK_DEADZONE), 1.0);
+	x = ((1.0 - STICK_EXPO) * x) + (STICK_EXPO * x * x * x);
+
+	return copysign(x * maximum, (double)value);
+}
+
+/*
+  Seconds per step at 'rate', or 0.0 if stopped.
+*/
+
+static double
+stick_period(enum stepper_axis axis, double rate)
+{
+	struct steps steps;
+
+	if (0.0 == rate || steps_from_rate(axis, rate, &steps))
+		return 0.0;
+
+	return (double)(steps.width + steps.delay) / 1000000.0;
+}
+
+/*
+  Move one axis towards where the stick wants it.  Returns 0.0 when
+  done, or the seconds to wait before trying again.
+*/
+
+static double
+stick_update(struct stick *stick, struct timespec now)
+{
+	double *rate;
+	double target;
+	double period;
+	double next;
+	double since;
+	bool centered;
+	int rc;
+
+	lock(&state.mutex);
+
+	if (PIMOUNT_CONTROL_LOCAL != state.control) {
+		if (0.0 != stick->offset && !stick->warned)
+			fprintf(stderr, "Switch to Local Control First!\n");
+
+		stick->warned = (0.0 != stick->offset);
+		stick->pushed = false;
+		unlock(&state.mutex);
+
+		return 0.0;
+	}
+
+	stick->warned = false;
+
+	if (STEPPER_AXIS_RA == stick->axis)
+		rate = &state.ra_rate;
+	else
+		rate = &state.dec_rate;
+
+	if (!stick->pushed) {
+		if (0.0 == stick->offset) {
+			unlock(&state.mutex);
+
+			return 0.0;
 		}
 
-		if (0.0 != state.dec_rate) {
-			rc = stepper_start(STEPPER_AXIS_DEC, state.dec_rate, 0);
+		stick->base = *rate;
+		stick->pushed = true;
+	}
 
-			if (rc) {
-				unlock(&state.mutex);
-				fprintf(stderr,
-					"%s:%d - rc=%d\n",
-					__FILE__, __LINE__, rc);
-			}
+	centered = (0.0 == stick->offset);
+	target = fmax(-stick->maximum,
+		      fmin(stick->base + stick->offset, stick->maximum));
+
+	/* Small changes are skipped, but not going back to the base rate. */
+	if (target != *rate &&
+	    (centered || STICK_RESOLUTION <= fabs(target - *rate))) {
+		/* No more than one change per step, at the faster rate. */
+		period = stick_period(stick->axis, *rate);
+		next = stick_period(stick->axis, target);
+
+		if (0.0 == period || (0.0 != next && next < period))
+			period = next;
+
+		period = fmin(period, STICK_HOLD);
+		since = timespec_to_double(timespec_sub(now, stick->applied));
+
+		if (since < period) {
+			unlock(&state.mutex);
+
+			return period - since;
 		}
+
+		*rate = target;
+		stick->applied = now;
+		stats_notify(STATS_CHANGE_RATE);
+		rc = stepper_set_rate(stick->axis, target);
+
+		if (rc)
+			fprintf(stderr, "%s:%d - rc=%d\n",
+				__FILE__, __LINE__, rc);
 	}
 
+	/* Centered, and back at the base rate. */
+	if (centered && target == *rate)
+		stick->pushed = false;
+
 	unlock(&state.mutex);
 
-	return;
+	return 0.0;
 }
 
-static void *
-controller(void *input)
+/*
+  Run by the housekeeping loop after the stick moves, and again while
+  a change is held back.
+*/
+
+static double
+stick_apply(void *input, struct timespec now)
 {
 	struct controller *controller_input;
+	double wait = LOOP_NEVER;
+	double left;
+	int i;
 
 	controller_input = (struct controller *)input;
 
-	controller_input->joystick_fd =
-		open(controller_input->joystick, O_RDONLY);
+	for (i = 0; i < 2; ++i) {
+		left = stick_update(&controller_input->sticks[i], now);
 
-	if (-1 == controller_input->joystick_fd) {
-		fprintf(stderr, "open(%s, O_RDONLY) failed: %s\n",
-			controller_input->joystick, strerror(errno));
+		if (0.0 < left && (0.0 > wait || left < wait))
+			wait = left;
+	}
+
+	return wait;
+}
 
-		pthread_exit(NULL);
+static void
+controller_event(struct controller *controller_input,
+		 const struct js_event *event)
+{
+	struct stick *stick;
+
+	switch (event->type) {
+	case JS_EVENT_BUTTON:
+		if (0 == event->value) { /* Button pressed. */
+			switch (event->number) {
+			case BUTTON_RED_A:
+				c_stop();
+				break;
+			case BUTTON_YEL_B:
+				c_local();
+				c_track();
+				break;
+			case BUTTON_BLU_X:
+				c_remote();
+				break;
+			case BUTTON_GRN_Y:
+				c_local();
+				break;
+			default:
+				/* Ignore other buttons. */
+				return;
+			}
+
+			/* The rates have changed under the stick. */
+			controller_input->sticks[0].pushed = false;
+			controller_input->sticks[1].pushed = false;
+		}
+		break;
+	case JS_EVENT_AXIS:
+		/* Local search. */
+		if (0 != (event->number / 2))
+			break;
+
+		/* Right (X) is East, down (Y) is South. */
+		stick = &controller_input->sticks[event->number % 2];
+		stick->offset = -stick_shape(event->value, stick->maximum);
+		loop_schedule(controller_input->timer, 0.0);
+		break;
+	default:
+		/* Ignore everything else. */
+		break;
 	}
 
-	pthread_cleanup_push(controller_cleanup, input);
+	return;
+}
+
+/*
+  Run by the housekeeping loop when the joystick has events.
+*/
+
+static void
+controller(int fd, void *input)
+{
+	struct controller *controller_input;
+
+	controller_input = (struct controller *)input;
 
 	for (;;) {
 		ssize_t bytes;
 		struct js_event event;
 
-		bytes = read(controller_input->joystick_fd,
-			     &event, sizeof(event));
+		bytes = read(fd, &event, sizeof(event));
+
+		if (-1 == bytes && (EAGAIN == errno || EINTR == errno))
+			return;
 
 		if (bytes != sizeof(event)) {
 			/* Controller Unplugged... Or Some Such. */
 			fprintf(stderr, "Controller Disappeared!\n");
-			pthread_exit(NULL);
+			loop_remove_fd(fd);
+			close(fd);
+			controller_input->joystick_fd = -1;
+
+			return;
 		}
 
-		switch (event.type) {
-		case JS_EVENT_BUTTON:
-			if (0 == event.value) { /* Button pressed. */
-				switch (event.number) {
-				case BUTTON_RED_A:
-					c_stop();
-					break;
-				case BUTTON_YEL_B:
-					c_local();
-					c_track();
-					break;
-				case BUTTON_BLU_X:
-					c_remote();
-					break;
-				case BUTTON_GRN_Y:
-					c_local();
-					break;
-				default:
-					/* Ignore other buttons. */
-					break;
-				}
-			}
-			break;
-		case JS_EVENT_AXIS:
-			/* Local search. */
-			if (0 != (event.number / 2))
-				break;
+		controller_event(controller_input, &event);
+	}
+}
 
-			if (0 == event.number % 2) {
-				/* X */
-				if (16000 < event.value)
-					c_ra(false);
-				else if (-16000 > event.value)
-					c_ra(true);
-				else
-					break;
-			} else {
-				/* Y */
-				if (16000 < event.value)
-					c_dec(false);
-				else if (-16000 > event.value)
-					c_dec(true);
-				else
-					break;
-			}
-			break;
-		default:
-			/* Ignore everything else. */
-			break;
-		}
+static void
+controller_open(struct controller *controller_input)
+{
+	controller_input->timer =
+		loop_timer(stick_apply, controller_input, LOOP_NEVER, 0.0);
+	controller_input->joystick_fd =
+		open(controller_input->joystick,
+		     O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+
+	if (-1 == controller_input->joystick_fd) {
+		fprintf(stderr, "open(%s, O_RDONLY) failed: %s\n",
+			controller_input->joystick, strerror(errno));
+
+		return;
 	}
 
-	if (-1 != controller_input->joystick_fd)
+	if (loop_fd(controller_input->joystick_fd,
+		    controller, controller_input)) {
 		close(controller_input->joystick_fd);
+		controller_input->joystick_fd = -1;
+	}
 
-	pthread_cleanup_pop(1);
-	pthread_exit(NULL);
+	return;
 }
 
 /*
@@ -485,18 +650,39 @@ main(int argc, char *argv[])
 	struct fan_params fan_input;
 	struct server_input server_parameters;
 	struct controller controller_input;
+	unsigned short port = SERVER_DEFAULT_PORT;
+	unsigned short http_port = HTTP_DEFAULT_PORT;
+	const char *recording = NULL;
+	double setpoint = FAN_SETPOINT;
+	sigset_t signals;
 
 	static struct option long_options[] = {
 		{"help",      no_argument,       0,  'h' },
+		{"port",      required_argument, 0,  'p' },
+		{"http",      required_argument, 0,  'w' },
+		{"record",    required_argument, 0,  'r' },
+		{"fan",       required_argument, 0,  'f' },
 		{0, 0, 0, 0}
 	};
 
-	while ((opt = getopt_long(argc, argv, "ha:d:u:r:n:", 
+	while ((opt = getopt_long(argc, argv, "hp:w:r:f:", 
 				  long_options, &long_index )) != -1) {
 		switch (opt) {
 		case 'h':
 			usage(EXIT_SUCCESS);
 			break;
+		case 'p':
+			port = (unsigned short)strtoul(optarg, NULL, 0);
+			break;
+		case 'w':
+			http_port = (unsigned short)strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			recording = optarg;
+			break;
+		case 'f':
+			setpoint = strtod(optarg, NULL);
+			break;
 		default:
 			fprintf(stderr, "Invalid Option\n");
 			usage(EXIT_FAILURE);
@@ -504,6 +690,23 @@ main(int argc, char *argv[])
 		}
 	}
 
+	/*
+	  Catch Signals
+
+	  Blocked in every thread (so before pigpio starts any), and
+	  read by the housekeeping loop.
+	*/
+
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGHUP);
+	sigaddset(&signals, SIGINT);
+	sigaddset(&signals, SIGCONT);
+	sigaddset(&signals, SIGTERM);
+	pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+	if (loop_initialize(&signals))
+		return EXIT_FAILURE;
+
 	/*
 	  Initialize pigpio
 	*/
@@ -517,35 +720,20 @@ main(int argc, char *argv[])
 	}
 
 	/*
-	  Catch Signals
-	*/
-
-	signal(SIGHUP, handler);
-	signal(SIGINT, handler);
-	signal(SIGCONT, handler);
-	signal(SIGTERM, handler);
-
-	/*
-	  Start the Fan Thread
+	  Fan Control
 	*/
 
 	fan_input.bias = 200000;
 	fan_input.high = 70;
 	fan_input.low = 50;
+	fan_input.setpoint = setpoint;
 
-	rc = pthread_create(&fan_thread, NULL, fan, (void *)&fan_input);
-
-	if (0 != rc) {
-		fprintf(stderr, "pthread_create() failed: %d\n", rc);
+	if (-1 == loop_timer(fan_control, &fan_input, 1.0, FAN_SLACK)) {
+		gpioTerminate();
 
 		return EXIT_FAILURE;
 	}
 
-	rc = pthread_setname_np(fan_thread, "pimount.fan");
-
-	if (0 != rc)
-		fprintf(stderr, "pthread_setname_np() failed: %d\n", rc);
-
 	/*
 	  Initialize the Stepper Motor Driver
 	*/
@@ -560,25 +748,30 @@ main(int argc, char *argv[])
 	}
 
 	/*
-	  Set up the USB Controller
+	  Low Latency While an Axis Runs, see power.h
 	*/
 
-	strcpy(controller_input.joystick, JOYSTICK);
-
-	rc = pthread_create(&controller_thread, NULL, controller,
-			    (void *)&controller_input);
+	if (power_initialize())
+		fprintf(stderr, "power_initialize() failed\n");
 
-	if (0 != rc) {
-		fprintf(stderr, "pthread_create() failed: %d\n", rc);
+	/*
+	  Set up the USB Controller
+	*/
 
-		return EXIT_FAILURE;
-	}
+	memset(&controller_input, 0, sizeof(controller_input));
+	strcpy(controller_input.joystick, JOYSTICK);
+	controller_input.sticks[0].axis = STEPPER_AXIS_RA;
+	controller_input.sticks[0].maximum = MAX_RA_RATE;
+	controller_input.sticks[1].axis = STEPPER_AXIS_DEC;
+	controller_input.sticks[1].maximum = MAX_DEC_RATE;
+	controller_open(&controller_input);
 
 	/*
 	  Start the Server Thread
 	*/
 
-	server_parameters.port = 0;
+	server_parameters.port = port;
+	server_parameters.http_port = http_port;
 
 	rc = pthread_create(&server_thread, NULL,
 			    server, (void *)&server_parameters);
@@ -594,6 +787,13 @@ main(int argc, char *argv[])
 	if (0 != rc)
 		fprintf(stderr, "pthread_setname_np() failed: %d\n", rc);
 
+	/*
+	  Open the Recording, Written by 'stats'
+	*/
+
+	if (NULL != recording && recorder_open(recording, RECORDER_CAPACITY))
+		fprintf(stderr, "Not recording to %s\n", recording);
+
 	/*
 	  Start 'stats'
 	*/
@@ -607,20 +807,27 @@ main(int argc, char *argv[])
 	}
 
 	/*
-	  Pause...
+	  Run the Housekeeping Loop, Until Signalled
 	*/
 
-	pause();
+	loop_run();
 
 	/*
-	  Join all Threads
+	  Clean Up
 	*/
 
 	stats_finalize();
+	recorder_close();
+	power_finalize();
 	stepper_finalize();
+	pthread_cancel(server_thread);
 	pthread_join(server_thread, NULL);
-	pthread_join(controller_thread, NULL);
-	pthread_join(fan_thread, NULL);
+
+	if (-1 != controller_input.joystick_fd)
+		close(controller_input.joystick_fd);
+
+	fan_off();
+	loop_finalize();
 	gpioTerminate();
 
 	pthread_exit(NULL);
@@ -12,11 +12,20 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
-
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#ifdef OLED_SIMULATE
+#include "oledsim.h"
+#else
 #include <pigpio.h>
 char *cmdErrStr(int);
+#endif
 
 #include "oled.h"
+#include "fonts.h"		/* Generated, see fontgen.c */
 
 /*
   ==============================================================================
@@ -26,3409 +35,116 @@ char *cmdErrStr(int);
 
 /*
   Fonts
-*/
 
-/* 5x7 font (in 6x8 cell) */
-static char oled_font_small[] = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
-	0x45, 0x51, 0x45, 0x3e, 0x00, 0x3e, 0x6b, 0x6f,
-	0x6b, 0x3e, 0x00, 0x1c, 0x3e, 0x7c, 0x3e, 0x1c,
-	0x00, 0x18, 0x3c, 0x7e, 0x3c, 0x18, 0x00, 0x30,
-	0x36, 0x7f, 0x36, 0x30, 0x00, 0x18, 0x5c, 0x7e,
-	0x5c, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
-	0x00, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0x00, 0x3c,
-	0x24, 0x24, 0x3c, 0x00, 0x00, 0xc3, 0xdb, 0xdb,
-	0xc3, 0xff, 0x00, 0x30, 0x48, 0x4a, 0x36, 0x0e,
-	0x00, 0x06, 0x29, 0x79, 0x29, 0x06, 0x00, 0x60,
-	0x70, 0x3f, 0x02, 0x04, 0x00, 0x60, 0x7e, 0x0a,
-	0x35, 0x3f, 0x00, 0x2a, 0x1c, 0x36, 0x1c, 0x2a,
-	0x00, 0x00, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x08,
-	0x1c, 0x3e, 0x7f, 0x00, 0x00, 0x14, 0x36, 0x7f,
-	0x36, 0x14, 0x00, 0x00, 0x5f, 0x00, 0x5f, 0x00,
-	0x00, 0x06, 0x09, 0x7f, 0x01, 0x7f, 0x00, 0x22,
-	0x4d, 0x55, 0x59, 0x22, 0x00, 0x60, 0x60, 0x60,
-	0x60, 0x00, 0x00, 0x14, 0xb6, 0xff, 0xb6, 0x14,
-	0x00, 0x04, 0x06, 0x7f, 0x06, 0x04, 0x00, 0x10,
-	0x30, 0x7f, 0x30, 0x10, 0x00, 0x08, 0x08, 0x3e,
-	0x1c, 0x08, 0x00, 0x08, 0x1c, 0x3e, 0x08, 0x08,
-	0x00, 0x78, 0x40, 0x40, 0x40, 0x40, 0x00, 0x08,
-	0x3e, 0x08, 0x3e, 0x08, 0x00, 0x30, 0x3c, 0x3f,
-	0x3c, 0x30, 0x00, 0x03, 0x0f, 0x3f, 0x0f, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x06, 0x5f, 0x06, 0x00, 0x00, 0x07, 0x03, 0x00,
-	0x07, 0x03, 0x00, 0x24, 0x7e, 0x24, 0x7e, 0x24,
-	0x00, 0x24, 0x2b, 0x6a, 0x12, 0x00, 0x00, 0x63,
-	0x13, 0x08, 0x64, 0x63, 0x00, 0x36, 0x49, 0x56,
-	0x20, 0x50, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x3e, 0x41, 0x00, 0x00, 0x00, 0x00,
-	0x41, 0x3e, 0x00, 0x00, 0x00, 0x08, 0x3e, 0x1c,
-	0x3e, 0x08, 0x00, 0x08, 0x08, 0x3e, 0x08, 0x08,
-	0x00, 0x00, 0xe0, 0x60, 0x00, 0x00, 0x00, 0x08,
-	0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x60, 0x60,
-	0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02,
-	0x00, 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00, 0x00,
-	0x42, 0x7f, 0x40, 0x00, 0x00, 0x62, 0x51, 0x49,
-	0x49, 0x46, 0x00, 0x22, 0x49, 0x49, 0x49, 0x36,
-	0x00, 0x18, 0x14, 0x12, 0x7f, 0x10, 0x00, 0x2f,
-	0x49, 0x49, 0x49, 0x31, 0x00, 0x3c, 0x4a, 0x49,
-	0x49, 0x30, 0x00, 0x01, 0x71, 0x09, 0x05, 0x03,
-	0x00, 0x36, 0x49, 0x49, 0x49, 0x36, 0x00, 0x06,
-	0x49, 0x49, 0x29, 0x1e, 0x00, 0x00, 0x6c, 0x6c,
-	0x00, 0x00, 0x00, 0x00, 0xec, 0x6c, 0x00, 0x00,
-	0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x24,
-	0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x41, 0x22,
-	0x14, 0x08, 0x00, 0x02, 0x01, 0x59, 0x09, 0x06,
-	0x00, 0x3e, 0x41, 0x5d, 0x55, 0x1e, 0x00, 0x7e,
-	0x11, 0x11, 0x11, 0x7e, 0x00, 0x7f, 0x49, 0x49,
-	0x49, 0x36, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x22,
-	0x00, 0x7f, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x7f,
-	0x49, 0x49, 0x49, 0x41, 0x00, 0x7f, 0x09, 0x09,
-	0x09, 0x01, 0x00, 0x3e, 0x41, 0x49, 0x49, 0x7a,
-	0x00, 0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00, 0x00,
-	0x41, 0x7f, 0x41, 0x00, 0x00, 0x30, 0x40, 0x40,
-	0x40, 0x3f, 0x00, 0x7f, 0x08, 0x14, 0x22, 0x41,
-	0x00, 0x7f, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7f,
-	0x02, 0x04, 0x02, 0x7f, 0x00, 0x7f, 0x02, 0x04,
-	0x08, 0x7f, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x3e,
-	0x00, 0x7f, 0x09, 0x09, 0x09, 0x06, 0x00, 0x3e,
-	0x41, 0x51, 0x21, 0x5e, 0x00, 0x7f, 0x09, 0x09,
-	0x19, 0x66, 0x00, 0x26, 0x49, 0x49, 0x49, 0x32,
-	0x00, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x00, 0x3f,
-	0x40, 0x40, 0x40, 0x3f, 0x00, 0x1f, 0x20, 0x40,
-	0x20, 0x1f, 0x00, 0x3f, 0x40, 0x3c, 0x40, 0x3f,
-	0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x07,
-	0x08, 0x70, 0x08, 0x07, 0x00, 0x71, 0x49, 0x45,
-	0x43, 0x00, 0x00, 0x00, 0x7f, 0x41, 0x41, 0x00,
-	0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
-	0x41, 0x41, 0x7f, 0x00, 0x00, 0x04, 0x02, 0x01,
-	0x02, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x20,
-	0x54, 0x54, 0x54, 0x78, 0x00, 0x7f, 0x44, 0x44,
-	0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28,
-	0x00, 0x38, 0x44, 0x44, 0x44, 0x7f, 0x00, 0x38,
-	0x54, 0x54, 0x54, 0x08, 0x00, 0x08, 0x7e, 0x09,
-	0x09, 0x00, 0x00, 0x18, 0xa4, 0xa4, 0xa4, 0x7c,
-	0x00, 0x7f, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00,
-	0x00, 0x7d, 0x40, 0x00, 0x00, 0x40, 0x80, 0x84,
-	0x7d, 0x00, 0x00, 0x7f, 0x10, 0x28, 0x44, 0x00,
-	0x00, 0x00, 0x00, 0x7f, 0x40, 0x00, 0x00, 0x7c,
-	0x04, 0x18, 0x04, 0x78, 0x00, 0x7c, 0x04, 0x04,
-	0x78, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38,
-	0x00, 0xfc, 0x44, 0x44, 0x44, 0x38, 0x00, 0x38,
-	0x44, 0x44, 0x44, 0xfc, 0x00, 0x44, 0x78, 0x44,
-	0x04, 0x08, 0x00, 0x08, 0x54, 0x54, 0x54, 0x20,
-	0x00, 0x04, 0x3e, 0x44, 0x24, 0x00, 0x00, 0x3c,
-	0x40, 0x20, 0x7c, 0x00, 0x00, 0x1c, 0x20, 0x40,
-	0x20, 0x1c, 0x00, 0x3c, 0x60, 0x30, 0x60, 0x3c,
-	0x00, 0x6c, 0x10, 0x10, 0x6c, 0x00, 0x00, 0x9c,
-	0xa0, 0x60, 0x3c, 0x00, 0x00, 0x64, 0x54, 0x54,
-	0x4c, 0x00, 0x00, 0x08, 0x3e, 0x41, 0x41, 0x00,
-	0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00,
-	0x41, 0x41, 0x3e, 0x08, 0x00, 0x02, 0x01, 0x02,
-	0x01, 0x00, 0x00, 0x3c, 0x26, 0x23, 0x26, 0x3c
-};
+  Each glyph is 'width' columns of (height + 7) / 8 bytes, the top
+  byte first.  A column is at most 25 pixels high, so shifted to any
+  pixel row within a page it still fits in 32 bits.
+*/
 
-/* 8x8 */
-static char oled_font_medium[] = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7e, 0x81, 0x95, 0xb1, 0xb1, 0x95, 0x81, 0x7e,
-	0x7e, 0xff, 0xeb, 0xcf, 0xcf, 0xeb, 0xff, 0x7e,
-	0x0e, 0x1f, 0x3f, 0x7e, 0x3f, 0x1f, 0x0e, 0x00,
-	0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x08, 0x00,
-	0x38, 0x9a, 0x9f, 0xff, 0x9f, 0x9a, 0x38, 0x00,
-	0x10, 0xb8, 0xfc, 0xfe, 0xfc, 0xb8, 0x10, 0x00,
-	0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00,
-	0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff,
-	0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00,
-	0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff,
-	0x70, 0xf8, 0x88, 0x88, 0xfd, 0x7f, 0x07, 0x0f,
-	0x00, 0x4e, 0x5f, 0xf1, 0xf1, 0x5f, 0x4e, 0x00,
-	0xc0, 0xe0, 0xff, 0x7f, 0x05, 0x05, 0x07, 0x07,
-	0xc0, 0xff, 0x7f, 0x05, 0x05, 0x65, 0x7f, 0x3f,
-	0x99, 0x5a, 0x3c, 0xe7, 0xe7, 0x3c, 0x5a, 0x99,
-	0x7f, 0x3e, 0x3e, 0x1c, 0x1c, 0x08, 0x08, 0x00,
-	0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x7f, 0x00,
-	0x00, 0x24, 0x66, 0xff, 0xff, 0x66, 0x24, 0x00,
-	0x00, 0x5f, 0x5f, 0x00, 0x00, 0x5f, 0x5f, 0x00,
-	0x06, 0x0f, 0x09, 0x7f, 0x7f, 0x01, 0x7f, 0x7f,
-	0xc0, 0x9a, 0xbf, 0xa5, 0xbd, 0xd9, 0x43, 0x02,
-	0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00,
-	0x80, 0x94, 0xb6, 0xff, 0xff, 0xb6, 0x94, 0x80,
-	0x00, 0x04, 0x06, 0x7f, 0x7f, 0x06, 0x04, 0x00,
-	0x00, 0x10, 0x30, 0x7f, 0x7f, 0x30, 0x10, 0x00,
-	0x08, 0x08, 0x08, 0x2a, 0x3e, 0x1c, 0x08, 0x00,
-	0x08, 0x1c, 0x3e, 0x2a, 0x08, 0x08, 0x08, 0x00,
-	0x3c, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
-	0x08, 0x1c, 0x3e, 0x08, 0x08, 0x3e, 0x1c, 0x08,
-	0x30, 0x38, 0x3c, 0x3e, 0x3e, 0x3c, 0x38, 0x30,
-	0x06, 0x0e, 0x1e, 0x3e, 0x3e, 0x1e, 0x0e, 0x06,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x06, 0x5f, 0x5f, 0x06, 0x00, 0x00,
-	0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00,
-	0x14, 0x7f, 0x7f, 0x14, 0x7f, 0x7f, 0x14, 0x00,
-	0x24, 0x2e, 0x2a, 0x6b, 0x6b, 0x3a, 0x12, 0x00,
-	0x46, 0x66, 0x30, 0x18, 0x0c, 0x66, 0x62, 0x00,
-	0x30, 0x7a, 0x4f, 0x5d, 0x37, 0x7a, 0x48, 0x00,
-	0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x1c, 0x3e, 0x63, 0x41, 0x00, 0x00, 0x00,
-	0x00, 0x41, 0x63, 0x3e, 0x1c, 0x00, 0x00, 0x00,
-	0x08, 0x2a, 0x3e, 0x1c, 0x1c, 0x3e, 0x2a, 0x08,
-	0x00, 0x08, 0x08, 0x3e, 0x3e, 0x08, 0x08, 0x00,
-	0x00, 0x00, 0x80, 0xe0, 0x60, 0x00, 0x00, 0x00,
-	0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
-	0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
-	0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x00,
-	0x3e, 0x7f, 0x59, 0x4d, 0x47, 0x7f, 0x3e, 0x00,
-	0x40, 0x42, 0x7f, 0x7f, 0x40, 0x40, 0x00, 0x00,
-	0x62, 0x73, 0x59, 0x49, 0x6f, 0x66, 0x00, 0x00,
-	0x22, 0x63, 0x49, 0x49, 0x7f, 0x36, 0x00, 0x00,
-	0x18, 0x1c, 0x16, 0x53, 0x7f, 0x7f, 0x50, 0x00,
-	0x27, 0x67, 0x45, 0x45, 0x7d, 0x39, 0x00, 0x00,
-	0x3c, 0x7e, 0x4b, 0x49, 0x79, 0x30, 0x00, 0x00,
-	0x03, 0x03, 0x71, 0x79, 0x0f, 0x07, 0x00, 0x00,
-	0x36, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x00, 0x00,
-	0x06, 0x4f, 0x49, 0x69, 0x3f, 0x1e, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0xe6, 0x66, 0x00, 0x00, 0x00,
-	0x08, 0x1c, 0x36, 0x63, 0x41, 0x00, 0x00, 0x00,
-	0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-	0x00, 0x41, 0x63, 0x36, 0x1c, 0x08, 0x00, 0x00,
-	0x00, 0x02, 0x03, 0x59, 0x5d, 0x07, 0x02, 0x00,
-	0x3e, 0x7f, 0x41, 0x5d, 0x5d, 0x5f, 0x0e, 0x00,
-	0x7c, 0x7e, 0x13, 0x13, 0x7e, 0x7c, 0x00, 0x00,
-	0x41, 0x7f, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x00,
-	0x1c, 0x3e, 0x63, 0x41, 0x41, 0x63, 0x22, 0x00,
-	0x41, 0x7f, 0x7f, 0x41, 0x63, 0x3e, 0x1c, 0x00,
-	0x41, 0x7f, 0x7f, 0x49, 0x5d, 0x41, 0x63, 0x00,
-	0x41, 0x7f, 0x7f, 0x49, 0x1d, 0x01, 0x03, 0x00,
-	0x1c, 0x3e, 0x63, 0x41, 0x51, 0x33, 0x72, 0x00,
-	0x7f, 0x7f, 0x08, 0x08, 0x7f, 0x7f, 0x00, 0x00,
-	0x00, 0x41, 0x7f, 0x7f, 0x41, 0x00, 0x00, 0x00,
-	0x30, 0x70, 0x40, 0x41, 0x7f, 0x3f, 0x01, 0x00,
-	0x41, 0x7f, 0x7f, 0x08, 0x1c, 0x77, 0x63, 0x00,
-	0x41, 0x7f, 0x7f, 0x41, 0x40, 0x60, 0x70, 0x00,
-	0x7f, 0x7f, 0x0e, 0x1c, 0x0e, 0x7f, 0x7f, 0x00,
-	0x7f, 0x7f, 0x06, 0x0c, 0x18, 0x7f, 0x7f, 0x00,
-	0x1c, 0x3e, 0x63, 0x41, 0x63, 0x3e, 0x1c, 0x00,
-	0x41, 0x7f, 0x7f, 0x49, 0x09, 0x0f, 0x06, 0x00,
-	0x1e, 0x3f, 0x21, 0x31, 0x61, 0x7f, 0x5e, 0x00,
-	0x41, 0x7f, 0x7f, 0x09, 0x19, 0x7f, 0x66, 0x00,
-	0x26, 0x6f, 0x4d, 0x49, 0x59, 0x73, 0x32, 0x00,
-	0x03, 0x41, 0x7f, 0x7f, 0x41, 0x03, 0x00, 0x00,
-	0x7f, 0x7f, 0x40, 0x40, 0x7f, 0x7f, 0x00, 0x00,
-	0x1f, 0x3f, 0x60, 0x60, 0x3f, 0x1f, 0x00, 0x00,
-	0x3f, 0x7f, 0x60, 0x30, 0x60, 0x7f, 0x3f, 0x00,
-	0x63, 0x77, 0x1c, 0x08, 0x1c, 0x77, 0x63, 0x00,
-	0x07, 0x4f, 0x78, 0x78, 0x4f, 0x07, 0x00, 0x00,
-	0x47, 0x63, 0x71, 0x59, 0x4d, 0x67, 0x73, 0x00,
-	0x00, 0x7f, 0x7f, 0x41, 0x41, 0x00, 0x00, 0x00,
-	0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x00,
-	0x00, 0x41, 0x41, 0x7f, 0x7f, 0x00, 0x00, 0x00,
-	0x08, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x08, 0x00,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x00, 0x00, 0x03, 0x07, 0x04, 0x00, 0x00, 0x00,
-	0x20, 0x74, 0x54, 0x54, 0x3c, 0x78, 0x40, 0x00,
-	0x41, 0x7f, 0x3f, 0x48, 0x48, 0x78, 0x30, 0x00,
-	0x38, 0x7c, 0x44, 0x44, 0x6c, 0x28, 0x00, 0x00,
-	0x30, 0x78, 0x48, 0x49, 0x3f, 0x7f, 0x40, 0x00,
-	0x38, 0x7c, 0x54, 0x54, 0x5c, 0x18, 0x00, 0x00,
-	0x48, 0x7e, 0x7f, 0x49, 0x03, 0x06, 0x00, 0x00,
-	0x98, 0xbc, 0xa4, 0xa4, 0xf8, 0x7c, 0x04, 0x00,
-	0x41, 0x7f, 0x7f, 0x08, 0x04, 0x7c, 0x78, 0x00,
-	0x00, 0x44, 0x7d, 0x7d, 0x40, 0x00, 0x00, 0x00,
-	0x60, 0xe0, 0x80, 0x84, 0xfd, 0x7d, 0x00, 0x00,
-	0x41, 0x7f, 0x7f, 0x10, 0x38, 0x6c, 0x44, 0x00,
-	0x00, 0x41, 0x7f, 0x7f, 0x40, 0x00, 0x00, 0x00,
-	0x7c, 0x7c, 0x18, 0x78, 0x1c, 0x7c, 0x78, 0x00,
-	0x7c, 0x78, 0x04, 0x04, 0x7c, 0x78, 0x00, 0x00,
-	0x38, 0x7c, 0x44, 0x44, 0x7c, 0x38, 0x00, 0x00,
-	0x84, 0xfc, 0xf8, 0xa4, 0x24, 0x3c, 0x18, 0x00,
-	0x18, 0x3c, 0x24, 0xa4, 0xf8, 0xfc, 0x84, 0x00,
-	0x44, 0x7c, 0x78, 0x4c, 0x04, 0x0c, 0x18, 0x00,
-	0x48, 0x5c, 0x54, 0x74, 0x64, 0x24, 0x00, 0x00,
-	0x04, 0x04, 0x3e, 0x7f, 0x44, 0x24, 0x00, 0x00,
-	0x3c, 0x7c, 0x40, 0x40, 0x3c, 0x7c, 0x40, 0x00,
-	0x1c, 0x3c, 0x60, 0x60, 0x3c, 0x1c, 0x00, 0x00,
-	0x3c, 0x7c, 0x60, 0x30, 0x60, 0x7c, 0x3c, 0x00,
-	0x44, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0x44, 0x00,
-	0x9c, 0xbc, 0xa0, 0xa0, 0xfc, 0x7c, 0x00, 0x00,
-	0x4c, 0x64, 0x74, 0x5c, 0x4c, 0x64, 0x00, 0x00,
-	0x08, 0x08, 0x3e, 0x77, 0x41, 0x41, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00,
-	0x41, 0x41, 0x77, 0x3e, 0x08, 0x08, 0x00, 0x00,
-	0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x01, 0x00,
-	0x70, 0x78, 0x4c, 0x46, 0x4c, 0x78, 0x70, 0x00,
-	0x0e, 0x9f, 0x91, 0x91, 0xb1, 0xfb, 0x4a, 0x00,
-	0x3a, 0x7a, 0x40, 0x40, 0x3a, 0x7a, 0x40, 0x00,
-	0x38, 0x7c, 0x54, 0x55, 0x5d, 0x19, 0x00, 0x00,
-	0x02, 0x21, 0x75, 0x55, 0x55, 0x3d, 0x79, 0x42,
-	0x21, 0x75, 0x54, 0x54, 0x3d, 0x79, 0x40, 0x00,
-	0x21, 0x75, 0x55, 0x54, 0x3c, 0x78, 0x40, 0x00,
-	0x20, 0x74, 0x57, 0x57, 0x3c, 0x78, 0x40, 0x00,
-	0x18, 0x3c, 0xa4, 0xa4, 0xe4, 0x4c, 0x08, 0x00,
-	0x02, 0x39, 0x7d, 0x55, 0x55, 0x5d, 0x19, 0x02,
-	0x39, 0x7d, 0x54, 0x54, 0x5d, 0x19, 0x00, 0x00,
-	0x39, 0x7d, 0x55, 0x54, 0x5c, 0x18, 0x00, 0x00,
-	0x01, 0x45, 0x7c, 0x7c, 0x41, 0x01, 0x00, 0x00,
-	0x02, 0x01, 0x45, 0x7d, 0x7d, 0x41, 0x02, 0x00,
-	0x01, 0x45, 0x7d, 0x7c, 0x40, 0x00, 0x00, 0x00,
-	0x79, 0x7d, 0x14, 0x16, 0x14, 0x7d, 0x79, 0x00,
-	0x70, 0x78, 0x2b, 0x2b, 0x78, 0x70, 0x00, 0x00,
-	0x44, 0x7c, 0x7c, 0x55, 0x55, 0x45, 0x00, 0x00,
-	0x20, 0x74, 0x54, 0x54, 0x7c, 0x7c, 0x54, 0x54,
-	0x7c, 0x7e, 0x0b, 0x09, 0x7f, 0x7f, 0x49, 0x00,
-	0x32, 0x79, 0x49, 0x49, 0x79, 0x32, 0x00, 0x00,
-	0x32, 0x7a, 0x48, 0x48, 0x7a, 0x32, 0x00, 0x00,
-	0x32, 0x7a, 0x4a, 0x48, 0x78, 0x30, 0x00, 0x00,
-	0x3a, 0x79, 0x41, 0x41, 0x39, 0x7a, 0x40, 0x00,
-	0x3a, 0x7a, 0x42, 0x40, 0x38, 0x78, 0x40, 0x00,
-	0x9a, 0xba, 0xa0, 0xa0, 0xfa, 0x7a, 0x00, 0x00,
-	0x01, 0x19, 0x3c, 0x66, 0x66, 0x3c, 0x19, 0x01,
-	0x3d, 0x7d, 0x40, 0x40, 0x7d, 0x3d, 0x00, 0x00,
-	0x18, 0x3c, 0x24, 0xe7, 0xe7, 0x24, 0x24, 0x00,
-	0x68, 0x7e, 0x7f, 0x49, 0x43, 0x66, 0x20, 0x00,
-	0x53, 0x57, 0xfc, 0xfc, 0x57, 0x53, 0x00, 0x00,
-	0xff, 0xff, 0x09, 0x09, 0x2f, 0x76, 0xf8, 0xa0,
-	0x40, 0xc0, 0x88, 0xfe, 0x7f, 0x09, 0x03, 0x02,
-	0x20, 0x74, 0x54, 0x55, 0x3d, 0x79, 0x40, 0x00,
-	0x00, 0x44, 0x7d, 0x7d, 0x41, 0x00, 0x00, 0x00,
-	0x30, 0x78, 0x48, 0x4a, 0x7a, 0x32, 0x00, 0x00,
-	0x38, 0x78, 0x40, 0x42, 0x3a, 0x7a, 0x40, 0x00,
-	0x7a, 0x72, 0x0a, 0x0a, 0x7a, 0x70, 0x00, 0x00,
-	0x7d, 0x7d, 0x19, 0x31, 0x7d, 0x7d, 0x00, 0x00,
-	0x00, 0x26, 0x2f, 0x29, 0x2f, 0x2f, 0x28, 0x00,
-	0x00, 0x26, 0x2f, 0x29, 0x2f, 0x26, 0x00, 0x00,
-	0x00, 0x20, 0x70, 0x5d, 0x4d, 0x60, 0x20, 0x00,
-	0x38, 0x38, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
-	0x08, 0x08, 0x08, 0x08, 0x38, 0x38, 0x00, 0x00,
-	0x67, 0x37, 0x18, 0x0c, 0x96, 0xcb, 0xb9, 0x90,
-	0x4f, 0x6f, 0x30, 0x18, 0x6c, 0x76, 0xdb, 0xf9,
-	0x00, 0x00, 0x30, 0x7d, 0x7d, 0x30, 0x00, 0x00,
-	0x08, 0x1c, 0x36, 0x22, 0x08, 0x1c, 0x36, 0x22,
-	0x22, 0x36, 0x1c, 0x08, 0x22, 0x36, 0x1c, 0x08,
-	0xaa, 0x00, 0x55, 0x00, 0xaa, 0x00, 0x55, 0x00,
-	0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
-	0xd7, 0xff, 0xaa, 0x77, 0xbd, 0xea, 0x7f, 0xdd,
-	0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,
-	0x10, 0x10, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00,
-	0x14, 0x14, 0x14, 0xff, 0xff, 0x00, 0x00, 0x00,
-	0x10, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-	0x10, 0x10, 0xf0, 0xf0, 0x10, 0xf0, 0xf0, 0x00,
-	0x14, 0x14, 0x14, 0xfc, 0xfc, 0x00, 0x00, 0x00,
-	0x14, 0x14, 0xf7, 0xf7, 0x00, 0xff, 0xff, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-	0x14, 0x14, 0xf4, 0xf4, 0x04, 0xfc, 0xfc, 0x00,
-	0x14, 0x14, 0x17, 0x17, 0x10, 0x1f, 0x1f, 0x00,
-	0x10, 0x10, 0x1f, 0x1f, 0x10, 0x1f, 0x1f, 0x00,
-	0x14, 0x14, 0x14, 0x1f, 0x1f, 0x00, 0x00, 0x00,
-	0x10, 0x10, 0x10, 0xf0, 0xf0, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x1f, 0x1f, 0x10, 0x10, 0x10,
-	0x10, 0x10, 0x10, 0x1f, 0x1f, 0x10, 0x10, 0x10,
-	0x10, 0x10, 0x10, 0xf0, 0xf0, 0x10, 0x10, 0x10,
-	0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0x10, 0x10,
-	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-	0x10, 0x10, 0x10, 0xff, 0xff, 0x10, 0x10, 0x10,
-	0x00, 0x00, 0x00, 0xff, 0xff, 0x14, 0x14, 0x14,
-	0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10,
-	0x00, 0x00, 0x1f, 0x1f, 0x10, 0x17, 0x17, 0x14,
-	0x00, 0x00, 0xfc, 0xfc, 0x04, 0xf4, 0xf4, 0x14,
-	0x14, 0x14, 0x17, 0x17, 0x10, 0x17, 0x17, 0x14,
-	0x14, 0x14, 0xf4, 0xf4, 0x04, 0xf4, 0xf4, 0x14,
-	0x00, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xf7, 0x14,
-	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-	0x14, 0x14, 0xf7, 0xf7, 0x00, 0xf7, 0xf7, 0x14,
-	0x14, 0x14, 0x14, 0x17, 0x17, 0x14, 0x14, 0x14,
-	0x10, 0x10, 0x1f, 0x1f, 0x10, 0x1f, 0x1f, 0x10,
-	0x14, 0x14, 0x14, 0xf4, 0xf4, 0x14, 0x14, 0x14,
-	0x10, 0x10, 0xf0, 0xf0, 0x10, 0xf0, 0xf0, 0x10,
-	0x00, 0x00, 0x1f, 0x1f, 0x10, 0x1f, 0x1f, 0x10,
-	0x00, 0x00, 0x00, 0x1f, 0x1f, 0x14, 0x14, 0x14,
-	0x00, 0x00, 0x00, 0xfc, 0xfc, 0x14, 0x14, 0x14,
-	0x00, 0x00, 0xf0, 0xf0, 0x10, 0xf0, 0xf0, 0x10,
-	0x10, 0x10, 0xff, 0xff, 0x10, 0xff, 0xff, 0x10,
-	0x14, 0x14, 0x14, 0xff, 0xff, 0x14, 0x14, 0x14,
-	0x10, 0x10, 0x10, 0x1f, 0x1f, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xf0, 0xf0, 0x10, 0x10, 0x10,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x38, 0x7c, 0x44, 0x6c, 0x38, 0x6c, 0x44, 0x00,
-	0xfc, 0xfe, 0x2a, 0x2a, 0x3e, 0x14, 0x00, 0x00,
-	0x7e, 0x7e, 0x02, 0x02, 0x06, 0x06, 0x00, 0x00,
-	0x04, 0x7c, 0x7c, 0x04, 0x7c, 0x7c, 0x04, 0x00,
-	0x63, 0x77, 0x5d, 0x49, 0x63, 0x63, 0x00, 0x00,
-	0x38, 0x7c, 0x44, 0x7c, 0x3c, 0x04, 0x04, 0x00,
-	0x80, 0xfe, 0x7e, 0x20, 0x20, 0x3e, 0x1e, 0x00,
-	0x04, 0x06, 0x02, 0x7e, 0x7c, 0x06, 0x02, 0x00,
-	0x99, 0xbd, 0xe7, 0xe7, 0xbd, 0x99, 0x00, 0x00,
-	0x1c, 0x3e, 0x6b, 0x49, 0x6b, 0x3e, 0x1c, 0x00,
-	0x4c, 0x7e, 0x73, 0x01, 0x73, 0x7e, 0x4c, 0x00,
-	0x30, 0x78, 0x4a, 0x4f, 0x7d, 0x39, 0x00, 0x00,
-	0x18, 0x3c, 0x24, 0x3c, 0x3c, 0x24, 0x3c, 0x18,
-	0x98, 0xfc, 0x64, 0x3c, 0x3e, 0x27, 0x3d, 0x18,
-	0x1c, 0x3e, 0x6b, 0x49, 0x49, 0x00, 0x00, 0x00,
-	0x7e, 0x7f, 0x01, 0x01, 0x7f, 0x7e, 0x00, 0x00,
-	0x00, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x00,
-	0x00, 0x44, 0x44, 0x5f, 0x5f, 0x44, 0x44, 0x00,
-	0x40, 0x51, 0x5b, 0x4e, 0x44, 0x40, 0x00, 0x00,
-	0x40, 0x44, 0x4e, 0x5b, 0x51, 0x40, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x07, 0x06,
-	0x60, 0xe0, 0x80, 0xff, 0x7f, 0x00, 0x00, 0x00,
-	0x00, 0x08, 0x08, 0x6b, 0x6b, 0x08, 0x08, 0x00,
-	0x24, 0x36, 0x12, 0x36, 0x24, 0x36, 0x12, 0x00,
-	0x00, 0x06, 0x0f, 0x09, 0x0f, 0x06, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00,
-	0x10, 0x30, 0x70, 0xc0, 0xff, 0xff, 0x01, 0x01,
-	0x00, 0x1f, 0x1e, 0x01, 0x1f, 0x1e, 0x00, 0x00,
-	0x12, 0x19, 0x1d, 0x17, 0x12, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7e, 0x81, 0xa5, 0x81, 0x81, 0xbd, 0x99, 0x81,
-	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff,
-	0xdb, 0xff, 0xff, 0xc3, 0xe7, 0xff, 0x7e, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xfe, 0xfe,
-	0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x7c,
-	0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x3c, 0x3c, 0xe7, 0xe7, 0xe7, 0x99, 0x18,
-	0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c,
-	0x7e, 0xff, 0xff, 0x7e, 0x18, 0x18, 0x3c, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0xc3,
-	0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-	0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x1e, 0x0e, 0x1a, 0x32,
-	0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x18,
-	0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0x33, 0x3f, 0x30, 0x30, 0x30, 0x70, 0xf0,
-	0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x63,
-	0x7f, 0x63, 0x63, 0x63, 0x67, 0xe7, 0xe6, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0xdb, 0x3c,
-	0xe7, 0x3c, 0xdb, 0x18, 0x18, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf8, 0xfe, 0xf8,
-	0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x02, 0x06, 0x0e, 0x3e, 0xfe, 0x3e, 0x0e, 0x06,
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c,
-	0x7e, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66,
-	0x66, 0x66, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b,
-	0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x7c,
-	0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38,
-	0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18,
-	0x18, 0x18, 0x7e, 0x3c, 0x18, 0x7e, 0x00, 0x00,
-	0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c,
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x0c, 0xfe, 0x0c, 0x18, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60,
-	0xfe, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0,
-	0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x28, 0x6c, 0xfe, 0x6c, 0x28, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-	0x38, 0x38, 0x7c, 0x7c, 0xfe, 0xfe, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x7c,
-	0x7c, 0x38, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 0x00, 0x18,
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66,
-	0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0xfe, 0x6c,
-	0x6c, 0x6c, 0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x7c, 0xc6, 0xc2, 0xc0, 0x7c, 0x06,
-	0x86, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc2, 0xc6, 0x0c, 0x18, 0x30, 0x66,
-	0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c,
-	0x6c, 0x38, 0x76, 0xdc, 0xcc, 0xcc, 0x76, 0x00,
-	0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x60, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x30,
-	0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x18,
-	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
-	0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0c, 0x18,
-	0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x38, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6,
-	0x06, 0x0c, 0x18, 0x30, 0x60, 0xc6, 0xfe, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x06,
-	0x3c, 0x06, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x1c, 0x3c, 0x6c, 0xcc, 0xfe,
-	0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfe, 0xc0, 0xc0, 0xfc, 0x0e, 0x06, 0x06, 0xc6,
-	0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x60,
-	0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0x06, 0x0c,
-	0x18, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7c, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x0c,
-	0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00,
-	0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x30,
-	0x18, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30,
-	0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x0c,
-	0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xde, 0xde, 0xde,
-	0xdc, 0xc0, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6,
-	0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66,
-	0x66, 0x66, 0x7c, 0x66, 0x66, 0x66, 0xfc, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0,
-	0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x66,
-	0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66,
-	0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x66,
-	0x62, 0x68, 0x78, 0x68, 0x60, 0x60, 0xf0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0,
-	0xc0, 0xde, 0xc6, 0x66, 0x3a, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c,
-	0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xe6, 0x66, 0x6c, 0x6c,
-	0x78, 0x6c, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6,
-	0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe6,
-	0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6,
-	0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60,
-	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xde, 0x7c,
-	0x0c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66,
-	0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0xe6, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60,
-	0x38, 0x0c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-	0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6,
-	0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6,
-	0xd6, 0xd6, 0xfe, 0x7c, 0x6c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x38, 0x38, 0x38,
-	0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18,
-	0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6,
-	0x8c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x30, 0x30, 0x30,
-	0x30, 0x30, 0x30, 0x30, 0x3c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
-	0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x3c, 0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
-	0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc,
-	0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x60,
-	0x60, 0x78, 0x6c, 0x66, 0x66, 0x66, 0xdc, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
-	0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc6,
-	0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c,
-	0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0xf0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76,
-	0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00,
-	0x00, 0x00, 0xe0, 0x60, 0x60, 0x6c, 0x76, 0x66,
-	0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18,
-	0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,
-	0x00, 0x0e, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66,
-	0x3c, 0x00, 0x00, 0x00, 0xe0, 0x60, 0x60, 0x66,
-	0x6c, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6, 0xd6, 0xd6,
-	0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
-	0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66,
-	0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0x7c,
-	0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xdc, 0x76, 0x62, 0x60, 0x60, 0xf0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
-	0xc6, 0x70, 0x1c, 0xc6, 0x7c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30,
-	0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-	0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6,
-	0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38,
-	0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e,
-	0x06, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfe, 0xcc, 0x18, 0x30, 0x66, 0xfe, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x18, 0x18,
-	0x70, 0x18, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18,
-	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x70, 0x18, 0x18, 0x18, 0x0e, 0x18, 0x18, 0x18,
-	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38,
-	0x6c, 0xc6, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc2,
-	0x66, 0x3c, 0x0c, 0x06, 0x7c, 0x00, 0x00, 0x00,
-	0xcc, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-	0x76, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30,
-	0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00,
-	0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0x00, 0x78,
-	0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xcc, 0xcc, 0x00, 0x78, 0x0c, 0x7c,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x60,
-	0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc,
-	0x76, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c, 0x38,
-	0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66,
-	0x60, 0x66, 0x3c, 0x0c, 0x06, 0x3c, 0x00, 0x00,
-	0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe,
-	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xcc, 0xcc, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc6,
-	0x7c, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x18,
-	0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc6, 0x7c, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x38,
-	0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x60,
-	0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18,
-	0x3c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x10,
-	0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00,
-	0x00, 0x00, 0x38, 0x6c, 0x38, 0x00, 0x38, 0x6c,
-	0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x00, 0x00, 0x00,
-	0x18, 0x30, 0x60, 0x00, 0xfe, 0x66, 0x60, 0x7c,
-	0x60, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xcc, 0x76, 0x36, 0x7e, 0xd8, 0xd8,
-	0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x6c,
-	0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xce, 0x00,
-	0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c,
-	0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc6, 0xc6, 0x00, 0x7c, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x60,
-	0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6,
-	0x7c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0xcc,
-	0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00,
-	0x00, 0x00, 0x00, 0x60, 0x30, 0x18, 0x00, 0xcc,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc6, 0xc6, 0x00, 0xc6, 0xc6, 0xc6,
-	0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00, 0x00, 0xc6,
-	0xc6, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c,
-	0x38, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0x00,
-	0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
-	0x00, 0x00, 0x00, 0x18, 0x18, 0x7c, 0xc6, 0xc0,
-	0xc0, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00,
-	0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60,
-	0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18,
-	0x18, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xcc, 0xcc,
-	0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xc6, 0x00,
-	0x00, 0x00, 0x00, 0x0e, 0x1b, 0x18, 0x18, 0x18,
-	0x7e, 0x18, 0x18, 0x18, 0x18, 0xd8, 0x70, 0x00,
-	0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x0c,
-	0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18,
-	0x3c, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x60,
-	0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
-	0x00, 0x00, 0x00, 0x18, 0x30, 0x60, 0x00, 0xcc,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66,
-	0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x76, 0xdc,
-	0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6,
-	0xc6, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x6c, 0x6c,
-	0x3e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00,
-	0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc6, 0xcc, 0xd8,
-	0x30, 0x60, 0xce, 0x93, 0x06, 0x0c, 0x1f, 0x00,
-	0x00, 0xc0, 0xc0, 0xc6, 0xcc, 0xd8, 0x30, 0x66,
-	0xce, 0x9a, 0x3f, 0x06, 0x0f, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x3c,
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66,
-	0x33, 0x66, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x55, 0xaa,
-	0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
-	0x55, 0xaa, 0x55, 0xaa, 0xdd, 0x77, 0xdd, 0x77,
-	0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77,
-	0xdd, 0x77, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0xf6, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfe, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
-	0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-	0x00, 0xf7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,
-	0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xff, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x3f, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0xff, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8,
-	0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7c, 0xc6, 0xfc, 0xc6, 0xc6, 0xfc,
-	0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xfe, 0xc6,
-	0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
-	0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x30,
-	0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8, 0xd8,
-	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66,
-	0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0x6c,
-	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c,
-	0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0xee, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c,
-	0x3e, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb,
-	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x06, 0x7e, 0xcf, 0xdb, 0xf3, 0x7e, 0x60,
-	0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x30,
-	0x60, 0x60, 0x7c, 0x60, 0x60, 0x30, 0x1c, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6,
-	0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
-	0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00,
-	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18,
-	0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x60,
-	0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8, 0xd8,
-	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc,
-	0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0xec, 0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00,
-	0x00, 0xd8, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-	0x98, 0x30, 0x60, 0xc8, 0xf8, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7e, 0x81, 0xa5, 0x81, 0x81, 0xbd, 0x99,
-	0x81, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7e, 0xff, 0xdb, 0xff, 0xff, 0xc3, 0xe7,
-	0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x6c, 0xfe, 0xfe, 0xfe, 0xfe,
-	0x7c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x7c,
-	0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x18, 0x3c, 0x3c, 0xe7, 0xe7, 0xe7,
-	0x99, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x7e,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c,
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0xc3,
-	0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x42, 0x42,
-	0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xc3, 0x99, 0xbd, 0xbd,
-	0x99, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-	0x00, 0x1e, 0x0e, 0x1a, 0x32, 0x78, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18,
-	0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3f, 0x33, 0x3f, 0x30, 0x30, 0x30, 0x30,
-	0x70, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7f, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x63,
-	0x67, 0xe7, 0xe6, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x18, 0x18, 0xdb, 0x3c, 0xe7, 0x3c,
-	0xdb, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfe, 0xf8, 0xf0,
-	0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x02, 0x06, 0x0e, 0x1e, 0x3e, 0xfe, 0x3e, 0x1e,
-	0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18,
-	0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-	0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7f, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b,
-	0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c,
-	0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
-	0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18,
-	0x7e, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0xfe, 0x0c,
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0xfe, 0x60,
-	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x28, 0x6c, 0xfe, 0x6c,
-	0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x7c, 0x7c,
-	0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xfe, 0xfe, 0x7c, 0x7c, 0x38,
-	0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 0x18,
-	0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x66, 0x66, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x6c, 0x6c, 0xfe, 0x6c, 0x6c, 0x6c,
-	0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x18, 0x7c, 0xc6, 0xc2, 0xc0, 0x7c, 0x06, 0x86,
-	0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xc2, 0xc6, 0x0c, 0x18, 0x30,
-	0x60, 0xc6, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x38, 0x6c, 0x6c, 0x38, 0x76, 0xdc, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x30, 0x30, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30,
-	0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x66, 0x3c, 0xff, 0x3c,
-	0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18,
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x02, 0x06, 0x0c, 0x18, 0x30,
-	0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7c, 0xc6, 0xc6, 0xce, 0xd6, 0xd6, 0xe6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x38, 0x78, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7c, 0xc6, 0x06, 0x0c, 0x18, 0x30, 0x60,
-	0xc0, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7c, 0xc6, 0x06, 0x06, 0x3c, 0x06, 0x06,
-	0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0c, 0x1c, 0x3c, 0x6c, 0xcc, 0xfe, 0x0c,
-	0x0c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xfc, 0x0e, 0x06,
-	0x06, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x38, 0x60, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfe, 0xc6, 0x06, 0x06, 0x0c, 0x18, 0x30,
-	0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06,
-	0x06, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x30,
-	0x18, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
-	0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x0c,
-	0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7c, 0xc6, 0xc6, 0x0c, 0x18, 0x18, 0x18,
-	0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xde, 0xde, 0xde,
-	0xdc, 0xc0, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x66, 0x66,
-	0x66, 0x66, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x66, 0x66,
-	0x66, 0x6c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60,
-	0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60,
-	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde, 0xc6,
-	0xc6, 0x66, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x1e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc,
-	0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xe6, 0x66, 0x6c, 0x6c, 0x78, 0x78, 0x6c,
-	0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-	0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60,
-	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-	0xd6, 0xde, 0x7c, 0x0c, 0x0e, 0x00, 0x00, 0x00,
-	0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66,
-	0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x7e, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-	0x6c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6,
-	0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xc6, 0x6c, 0x6c, 0x38, 0x38, 0x6c,
-	0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60,
-	0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-	0x30, 0x30, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
-	0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x10,
-	0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x30,
-	0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xe0, 0x60, 0x60, 0x78, 0x6c, 0x66, 0x66,
-	0x66, 0x66, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc0,
-	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
-	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60,
-	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00, 0x00,
-	0x00, 0xe0, 0x60, 0x60, 0x6c, 0x76, 0x66, 0x66,
-	0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x06, 0x06, 0x00, 0x0e, 0x06, 0x06, 0x06,
-	0x06, 0x06, 0x06, 0x66, 0x66, 0x3c, 0x00, 0x00,
-	0x00, 0xe0, 0x60, 0x60, 0x66, 0x6c, 0x78, 0x78,
-	0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6, 0xd6,
-	0xd6, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66,
-	0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66,
-	0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x7c, 0x0c, 0x0c, 0x1e, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x62, 0x60,
-	0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x60, 0x38,
-	0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30,
-	0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66,
-	0x66, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xd6,
-	0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x38,
-	0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0xcc, 0x18, 0x30,
-	0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0e, 0x18, 0x18, 0x18, 0x70, 0x18, 0x18,
-	0x18, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x70, 0x18, 0x18, 0x18, 0x0e, 0x18, 0x18,
-	0x18, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6,
-	0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc2,
-	0x66, 0x3c, 0x0c, 0x06, 0x7c, 0x00, 0x00, 0x00,
-	0x00, 0xcc, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x18, 0x30, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
-	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xcc, 0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x3c, 0x66, 0x60, 0x60, 0x66,
-	0x3c, 0x0c, 0x06, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
-	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xc6, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
-	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xfe, 0xc0,
-	0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x66, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x3c, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc6, 0xc6, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x38,
-	0x6c, 0x38, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x30, 0x60, 0x00, 0xfe, 0x66, 0x60, 0x7c, 0x60,
-	0x60, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xcc, 0x76, 0x36, 0x7e,
-	0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc,
-	0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x60, 0x30, 0x18, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xc6, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00, 0x00,
-	0xc6, 0xc6, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6,
-	0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc6, 0xc6, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x18, 0x3c, 0x66, 0x60, 0x60, 0x60, 0x66,
-	0x3c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60,
-	0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e,
-	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc,
-	0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0e, 0x1b, 0x18, 0x18, 0x18, 0x7e, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x00, 0x00,
-	0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x30, 0x60, 0x00, 0xcc, 0xcc, 0xcc, 0xcc,
-	0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66,
-	0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x76,
-	0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xc0,
-	0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06,
-	0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc2, 0xc6, 0xcc, 0x18, 0x30, 0x60,
-	0xce, 0x93, 0x06, 0x0c, 0x1f, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc2, 0xc6, 0xcc, 0x18, 0x30, 0x66,
-	0xce, 0x9a, 0x3f, 0x06, 0x0f, 0x00, 0x00, 0x00,
-	0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3c,
-	0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x33, 0x66, 0xcc, 0x66,
-	0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x33, 0x66,
-	0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11,
-	0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x55,
-	0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
-	0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0xdd,
-	0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd,
-	0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xfe, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0xf7, 0x00, 0xf7, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0xff, 0x00, 0xff, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xff, 0x36,
-	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0xff, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8,
-	0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfc, 0xc6, 0xfc, 0xc6,
-	0xc6, 0xfc, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
-	0x00, 0xfe, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x80, 0xfe, 0x6c, 0x6c, 0x6c,
-	0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xfe, 0xc6, 0x60, 0x30, 0x18, 0x30,
-	0x60, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7e, 0xd8, 0xd8, 0xd8,
-	0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66,
-	0x7c, 0x60, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x76, 0xdc, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66,
-	0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6,
-	0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c,
-	0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66,
-	0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7e, 0xdb, 0xdb, 0xdb,
-	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x06, 0x7e, 0xcf, 0xdb, 0xf3,
-	0x7e, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x1c, 0x30, 0x60, 0x60, 0x7c, 0x60, 0x60,
-	0x60, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-	0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
-	0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18,
-	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18,
-	0x30, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18,
-	0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xd8,
-	0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7e, 0x00,
-	0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x76,
-	0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xec, 0x6c,
-	0x6c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xd8, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x70, 0x98, 0x30, 0x60, 0xc8, 0xf8, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-	0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+struct font {
+	unsigned width;
+	unsigned height;
+	unsigned glyphs;
+	const unsigned char *columns;
 };
 
-/* 16x24 */
-static char oled_font_large[] = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0x03, 0x03, 0x33, 0x33, 0x03, 0x03,
-	0x03, 0x03, 0x33, 0x33, 0x03, 0x03, 0xfc, 0xfc,
-	0xff, 0xff, 0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00, 0xff, 0xff,
-	0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0xcf, 0xcf, 0xff, 0xff,
-	0xff, 0xff, 0xcf, 0xcf, 0xff, 0xff, 0xfc, 0xfc,
-	0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xc3, 0xc3,
-	0xc3, 0xc3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff,
-	0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
-	0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc,
-	0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0x3f, 0x3f, 0x3f, 0x3f, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x3f, 0x3f, 0x3f, 0x3f, 0xff, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc,
-	0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
-	0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f, 0xff, 0xff,
-	0xff, 0xff, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xff, 0xff,
-	0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0x00, 0x00,
-	0x00, 0x00, 0xc3, 0xc3, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xc3, 0xc3, 0x00, 0x00,
-	0x00, 0x00, 0xc3, 0xc3, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x3f, 0x3f,
-	0x3f, 0x3f, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x3c, 0x3c, 0xff, 0xff,
-	0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc,
-	0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x00, 0x00, 0xc3, 0xc3, 0xcf, 0xcf, 0xfc, 0xfc,
-	0xfc, 0xfc, 0xcf, 0xcf, 0xc3, 0xc3, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-	0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f,
-	0x00, 0x00, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33,
-	0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff,
-	0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xfc, 0xfc,
-	0xfc, 0xfc, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x3f, 0x3f, 0xf3, 0xf3,
-	0xf3, 0xf3, 0x3f, 0x3f, 0xcc, 0xcc, 0xcc, 0xcc,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xf0, 0xf0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f,
-	0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
-	0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x03, 0x03, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0xff, 0xff,
-	0xff, 0xff, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff,
-	0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00,
-	0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0xff, 0xff,
-	0xff, 0xff, 0x03, 0x03, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xcf, 0xcf, 0xfc, 0xfc, 0x30, 0x30,
-	0xf0, 0xf0, 0xc3, 0xc3, 0x03, 0x03, 0x00, 0x00,
-	0x0f, 0x0f, 0x3f, 0x3f, 0xf0, 0xf0, 0xc0, 0xc0,
-	0xf0, 0xf0, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00,
-	0x0c, 0x0c, 0x3c, 0x3c, 0x30, 0x30, 0x30, 0x30,
-	0x33, 0x33, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0xff, 0xff,
-	0xff, 0xff, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff,
-	0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x30, 0x33, 0x33, 0x3f, 0x3f,
-	0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0xff, 0xff,
-	0xff, 0xff, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff,
-	0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc,
-	0xff, 0xff, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x3f, 0x3f, 0xff, 0xff, 0xcc, 0xcc,
-	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x3f, 0x3f, 0xff, 0xff, 0x0c, 0x0c,
-	0xff, 0xff, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xff, 0xff,
-	0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
-	0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00,
-	0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0,
-	0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00,
-	0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0,
-	0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0,
-	0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00,
-	0xf0, 0xf0, 0xc3, 0xc3, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f,
-	0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x3c, 0x3c, 0xff, 0xff, 0xc3, 0xc3,
-	0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x0f, 0x0f,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
-	0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x0c, 0x0c, 0xcc, 0xcc, 0xff, 0xff, 0x3f, 0x3f,
-	0x3f, 0x3f, 0xff, 0xff, 0xcc, 0xcc, 0x0c, 0x0c,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0xff,
-	0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0xc3, 0xc3, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x30, 0x30, 0x0f, 0x0f,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03,
-	0xc3, 0xc3, 0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00,
-	0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0x0f, 0x0f,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-	0x0f, 0x0f, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xfc, 0xfc, 0x0f, 0x0f, 0x03, 0x03,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0,
-	0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0,
-	0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
-	0xf0, 0xf0, 0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x3f, 0xf3, 0xf3,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-	0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xf0, 0xf0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
-	0xf3, 0xf3, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x3c, 0x3f, 0x3f, 0x03, 0x03, 0x03, 0x03,
-	0xc3, 0xc3, 0xff, 0xff, 0x3c, 0x3c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f,
-	0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0x0f, 0x0f,
-	0x3c, 0x3c, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xfc, 0xfc, 0x0f, 0x0f, 0x03, 0x03,
-	0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x0f, 0x0f, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0xc3, 0xc3, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x0f, 0x0f, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0xc3, 0xc3, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xfc, 0xfc, 0x0f, 0x0f, 0x03, 0x03,
-	0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x0c,
-	0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x03, 0x03, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xff, 0xff,
-	0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f,
-	0x3f, 0x3f, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xf0, 0xf0,
-	0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0x03,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xf0, 0xf0,
-	0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0x03,
-	0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xfc, 0xfc, 0x0f, 0x0f, 0x03, 0x03,
-	0x0f, 0x0f, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xc0, 0xc0,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0f, 0x0f,
-	0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x3c, 0xff, 0xff, 0xc3, 0xc3, 0x03, 0x03,
-	0x03, 0x03, 0x3f, 0x3f, 0x3c, 0x3c, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x03, 0x03, 0x03, 0x03,
-	0x0f, 0x0f, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0xff, 0xff,
-	0xff, 0xff, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x3f, 0x3f, 0xff, 0xff, 0xc0, 0xc0, 0x00, 0x00,
-	0xc0, 0xc0, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xfc, 0xfc,
-	0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00,
-	0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f,
-	0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xff, 0xff,
-	0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03,
-	0xc3, 0xc3, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
-	0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0x0f, 0x0f,
-	0x03, 0x03, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f,
-	0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f,
-	0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc3, 0xc3,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03,
-	0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xc3, 0xc3, 0xcf, 0xcf, 0x0c, 0x0c, 0x0c, 0x0c,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xcf, 0xcf,
-	0xcf, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xcf, 0xcf, 0xcf, 0xcf, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c,
-	0xff, 0xff, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0xff, 0xff,
-	0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03,
-	0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30,
-	0xf0, 0xf0, 0xc3, 0xc3, 0x03, 0x03, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0xff, 0xff,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc,
-	0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-	0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0xcc, 0xcc, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-	0x03, 0x03, 0xc3, 0xc3, 0xf0, 0xf0, 0x3c, 0x3c,
-	0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
-	0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff,
-	0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-	0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
-	0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff,
-	0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
-	0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f,
-	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f,
-	0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0,
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00,
-	0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x3c, 0x3c, 0x3c, 0x3c, 0xf0, 0x0c, 0xf0, 0x0c,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x0c, 0xf0, 0x0c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x00, 0xf0, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
-	0x00, 0x3c, 0x00, 0x3c, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xfc, 0xff, 0xfc,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xfc, 0xff, 0xfc,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x3c, 0x00, 0x3c, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x3f, 0x3c, 0x3f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x3f, 0xfc, 0x3f, 0xfc,
-	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
-	0x3c, 0xfc, 0x3c, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0xfc, 0x0f, 0xfc,
-	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xfc, 0xff, 0xfc,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xfc, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x00, 0x0f, 0x00, 0x3f, 0xc0, 0x3f, 0xc0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x3c, 0x00, 0x3c,
-	0x00, 0xf0, 0x00, 0xf0, 0x3f, 0xc0, 0x3f, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0x30, 0x3c, 0x30, 0x3c, 0x00, 0x3c, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x3c, 0xfc, 0x3c,
-	0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
-	0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xc0, 0xff, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xc0, 0xff, 0xc0,
-	0xf0, 0x30, 0xf0, 0x30, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf3, 0xfc, 0xf3, 0xfc, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xfc, 0x00, 0xfc, 0x03, 0xcf, 0x03, 0xcf,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
-	0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
-	0xf3, 0xf0, 0xf3, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0xf3, 0xf0, 0xf3, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
-	0xf3, 0xf0, 0xf3, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xfc, 0x3c, 0xfc, 0x3c,
-	0xff, 0x3c, 0xff, 0x3c, 0xff, 0xfc, 0xff, 0xfc,
-	0xf3, 0xfc, 0xf3, 0xfc, 0xf0, 0xfc, 0xf0, 0xfc,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xfc, 0x0f, 0xfc,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x3f, 0xfc,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
-	0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
-	0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x0c, 0xf0, 0x0c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0xf0, 0xfc, 0xf0, 0xfc, 0xc3, 0x0f, 0xc3, 0x0f,
-	0x00, 0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0,
-	0x03, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x0c, 0xf0, 0x0c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
-	0xf0, 0xfc, 0xf0, 0xfc, 0xc3, 0xcc, 0xc3, 0xcc,
-	0x0f, 0xff, 0x0f, 0xff, 0x00, 0x3c, 0x00, 0x3c,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x3c, 0x3c, 0x3c, 0x3c,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x0f, 0x0f, 0x0f, 0x0f, 0x3c, 0x3c, 0x3c, 0x3c,
-	0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
-	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
-	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
-	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
-	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
-	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
-	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
-	0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03,
-	0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
-	0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
-	0xcc, 0xcc, 0xcc, 0xcc, 0xf3, 0xf3, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xf3,
-	0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0xff, 0x3c, 0xff, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xfc, 0xff, 0xfc, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0xff, 0x3c, 0xff, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
-	0xff, 0x3c, 0xff, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x3c, 0x00, 0x3c,
-	0xff, 0x3c, 0xff, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0xff, 0x3c, 0xff, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x00, 0x0f, 0x00,
-	0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x00, 0x0f, 0x00,
-	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0xff, 0x3f, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0x3f, 0xff, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x00, 0x0f, 0x00,
-	0x0f, 0x3f, 0x0f, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0xff, 0x3f, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0x3f, 0xff, 0x3f, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0xff, 0xff, 0xff, 0xff, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c,
-	0x0f, 0x3c, 0x0f, 0x3c, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-	0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-	0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0x3c, 0x3f, 0x3c, 0xf3, 0xf0, 0xf3, 0xf0,
-	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
-	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xf0, 0xf3, 0xf0,
-	0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xf0, 0xff, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xff, 0xf0, 0xff, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xf0, 0xff, 0xf0,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00,
-	0xff, 0xfc, 0xff, 0xfc, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xfc, 0x3f, 0xfc, 0xf3, 0xc0, 0xf3, 0xc0,
-	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
-	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
-	0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x3c, 0x00, 0x3c, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
-	0xf3, 0xf0, 0xf3, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xfc, 0x3f, 0xfc, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x03, 0xfc,
-	0x0f, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x00, 0xf0, 0x00, 0xf0, 0x0f, 0xfc, 0x0f, 0xfc,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xfc, 0x3f, 0xfc, 0xf3, 0xcf, 0xf3, 0xcf,
-	0xf3, 0xcf, 0xf3, 0xcf, 0xf3, 0xcf, 0xf3, 0xcf,
-	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c,
-	0x3f, 0xfc, 0x3f, 0xfc, 0xf0, 0xff, 0xf0, 0xff,
-	0xf3, 0xcf, 0xf3, 0xcf, 0xff, 0x0f, 0xff, 0x0f,
-	0x3f, 0xfc, 0x3f, 0xfc, 0x3c, 0x00, 0x3c, 0x00,
-	0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x03, 0xf0,
-	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
-	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x0f, 0x00,
-	0x03, 0xf0, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
-	0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x00, 0xf0, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0x3c,
-	0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
-	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0x0f, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc,
-	0x03, 0xcf, 0x03, 0xcf, 0x03, 0xcf, 0x03, 0xcf,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
-	0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0,
-	0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0x3c, 0x3f, 0x3c, 0xf3, 0xf0, 0xf3, 0xf0,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
-	0xf3, 0xf0, 0xf3, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xff, 0x00, 0xff, 0x00, 0xf0, 0x00, 0xf0,
-	0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
-	0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
-	0xfc, 0xf0, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0,
-	0x03, 0xf0, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf3, 0xc0, 0xf3, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x3f, 0x00, 0x3f, 0x00, 0xc3, 0xc0, 0xc3, 0xc0,
-	0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
-	0xf0, 0xc0, 0xf0, 0xc0, 0xff, 0xc0, 0xff, 0xc0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
-	0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00
+static const struct font fonts[] = {
+	[OLED_FONT_SMALL] = {
+		6, 8, OLED_FONT_SMALL_GLYPHS, oled_font_small
+	},
+	[OLED_FONT_MEDIUM] = {
+		8, 8, OLED_FONT_MEDIUM_GLYPHS, oled_font_medium
+	},
+	[OLED_FONT_LARGE] = {
+		16, 24, OLED_FONT_LARGE_GLYPHS, oled_font_large
+	}
 };
 
 #define LINES 8
 #define COLUMNS 8
 
-static int offset = 0;
-static char screen[1024] = { 0 };
+#define WIDTH 128
+#define PAGES 8
+
+/*
+  Drawing only changes screen, oled_update() (or the writer thread,
+  see oled_start()) sends the difference between a frame and panel[]
+  (what the panel was last sent).  The columns that may have changed
+  in each page are kept with the frame so the difference doesn't have
+  to be found by comparing all 1024 bytes every time.
+*/
+
+struct span {
+	int first;		/* -1 if nothing has been drawn */
+	int last;
+};
+
+struct frame {
+	char data[WIDTH * PAGES];
+	struct span dirty[PAGES];
+};
+
+static struct frame screen;
+static char panel[WIDTH * PAGES] = { 0 };
+static bool panel_valid = false;
+
+/*
+  The writer thread.  oled_present() copies screen to pending and
+  returns, the writer takes whatever is pending when it gets to it, so
+  frames presented while it is busy are combined.  The mutex is only
+  held for the copies, never during I2C.
+*/
+
+static struct {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	pthread_t thread;
+	int handle;
+	bool running;
+	bool ready;
+	struct frame pending;
+	struct frame sending;
+} writer = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+	.running = false,
+	.ready = false,
+};
+
+/*
+  An update is sent as windows, rectangles of columns and pages (see
+  oled_windows()).  OVERHEAD is roughly what a window costs on top of
+  its data: the window commands, two control bytes and the address
+  byte of each segment.  Changed runs closer together than that are
+  sent as one window, re-sending the unchanged bytes between them is
+  cheaper.
+*/
+
+#define OVERHEAD 10
+
+/*
+  A run only starts more than OVERHEAD columns after the last one
+  ended, so at most one every OVERHEAD + 1 columns fits in a page.
+*/
+
+#define MAX_WINDOWS (PAGES * ((WIDTH + OVERHEAD) / (OVERHEAD + 1)))
+
+/* I2C_RDWR_IOCTL_MAX_MSGS, the most i2cSegments() can send at once. */
+#define MAX_SEGMENTS 42
+
+struct window {
+	int x0;			/* -1 if none */
+	int x1;
+	int y0;
+	int y1;
+};
+
+/*
+  Bus traffic, see oled_get_counts().
+*/
+
+static pthread_mutex_t counts_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct oled_counts counts;
 
 /*
   ------------------------------------------------------------------------------
@@ -3439,8 +155,19 @@ static int
 oled_buffer(int handle, char *buffer, unsigned buffer_length)
 {
 	int rc;
+	struct timespec start;
+	struct timespec end;
 
+	clock_gettime(CLOCK_MONOTONIC, &start);
 	rc = i2cWriteDevice(handle, buffer, buffer_length);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	pthread_mutex_lock(&counts_mutex);
+	++counts.transactions;
+	counts.bytes += buffer_length;
+	counts.seconds += (end.tv_sec - start.tv_sec) +
+		(end.tv_nsec - start.tv_nsec) / 1e9;
+	pthread_mutex_unlock(&counts_mutex);
 
 	if (rc) {
 		fprintf(stderr,
@@ -3453,6 +180,47 @@ oled_buffer(int handle, char *buffer, unsigned buffer_length)
 	return 0;
 }
 
+/*
+  ------------------------------------------------------------------------------
+  oled_segments
+
+  One combined transaction, a repeated start between segments instead
+  of a stop and start.
+*/
+
+static int
+oled_segments(int handle, pi_i2c_msg_t *segments, unsigned count)
+{
+	int rc;
+	struct timespec start;
+	struct timespec end;
+	unsigned i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	rc = i2cSegments(handle, segments, count);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	pthread_mutex_lock(&counts_mutex);
+	++counts.transactions;
+
+	for (i = 0; i < count; ++i)
+		counts.bytes += segments[i].len;
+
+	counts.seconds += (end.tv_sec - start.tv_sec) +
+		(end.tv_nsec - start.tv_nsec) / 1e9;
+	pthread_mutex_unlock(&counts_mutex);
+
+	if ((int)count != rc) {
+		fprintf(stderr,
+			"%s:%d - i2cSegments() failed: %s\n",
+			__FILE__, __LINE__, cmdErrStr(rc));
+
+		return -1;
+	}
+
+	return 0;
+}
+
 /*
   ------------------------------------------------------------------------------
   oled_write1
@@ -3488,38 +256,389 @@ oled_write2(int handle, char command1, char command2)
 
 /*
   ------------------------------------------------------------------------------
-  oled_position
+  oled_windows
+
+  Send windows of a frame, and remember that the panel has them.
+
+  In horizontal addressing mode the panel fills the window set by
+  0x21 (columns) and 0x22 (pages) row by row, so each window is a
+  command segment followed by a data segment.  All of them go in one
+  i2cSegments() call, unless there are more than it can take.
 */
 
 static int
-oled_position(int handle, unsigned x, unsigned y)
+oled_windows(int handle, const char *data,
+	     const struct window *windows, int count)
 {
-	offset = x + (128 * y);
+	char buffer[(WIDTH * PAGES) + (MAX_WINDOWS * 8)];
+	pi_i2c_msg_t segments[MAX_SEGMENTS];
+	unsigned used = 0;
+	int i = 0;
+	int n = 0;
+	int first = 0;
+	int rc = 0;
+
+	for (i = 0; i < count; ++i) {
+		const struct window *w = &windows[i];
+		unsigned length = w->x1 - w->x0 + 1;
+		char *commands = &buffer[used];
+		char *bytes;
+		int y;
+
+		commands[0] = 0x00;
+		commands[1] = 0x21;
+		commands[2] = w->x0;
+		commands[3] = w->x1;
+		commands[4] = 0x22;
+		commands[5] = w->y0;
+		commands[6] = w->y1;
+		used += 7;
+
+		bytes = &buffer[used];
+		bytes[0] = 0x40;
+		used += 1;
+
+		for (y = w->y0; y <= w->y1; ++y) {
+			memcpy(&buffer[used], &data[w->x0 + (WIDTH * y)],
+			       length);
+			used += length;
+		}
 
-	oled_write1(handle, 0xb0 | y);
-	oled_write1(handle, 0x00 | (x & 0xf));
-	oled_write1(handle, 0x10 | ((x >> 4) & 0xf));
+		segments[n].addr = OLED_ADDRESS;
+		segments[n].flags = PI_I2C_M_WR;
+		segments[n].len = 7;
+		segments[n].buf = (uint8_t *)commands;
+		++n;
+
+		segments[n].addr = OLED_ADDRESS;
+		segments[n].flags = PI_I2C_M_WR;
+		segments[n].len = &buffer[used] - bytes;
+		segments[n].buf = (uint8_t *)bytes;
+		++n;
+
+		if (MAX_SEGMENTS - 1 > n && count - 1 > i)
+			continue;
+
+		if (oled_segments(handle, segments, n)) {
+			rc = -1;
+		} else {
+			for (; first <= i; ++first) {
+				w = &windows[first];
+				length = w->x1 - w->x0 + 1;
+
+				for (y = w->y0; y <= w->y1; ++y)
+					memcpy(&panel[w->x0 + (WIDTH * y)],
+					       &data[w->x0 + (WIDTH * y)],
+					       length);
+			}
+		}
 
-	return 0;
+		first = i + 1;
+		used = 0;
+		n = 0;
+	}
+
+	return rc;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_span
+
+  Grow a dirty span to include columns first...last.
+*/
+
+static void
+oled_span(struct span *span, int first, int last)
+{
+	if (0 > span->first || first < span->first)
+		span->first = first;
+
+	if (last > span->last)
+		span->last = last;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_draw
+
+  Copy 'length' bytes to column x of page y in screen, clipped to the
+  page.
+*/
+
+static void
+oled_draw(unsigned x, unsigned y, const char *data, int length)
+{
+	if (PAGES <= y || WIDTH <= x || 0 >= length)
+		return;
+
+	if (WIDTH < x + length)
+		length = WIDTH - x;
+
+	memcpy(&screen.data[x + (WIDTH * y)], data, length);
+	oled_span(&screen.dirty[y], x, x + length - 1);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_invalidate
+
+  The panel contents are unknown, send everything next time.
+*/
+
+static void
+oled_invalidate(void)
+{
+	int i;
+
+	panel_valid = false;
+
+	for (i = 0; i < PAGES; ++i)
+		oled_span(&screen.dirty[i], 0, WIDTH - 1);
 }
 
 /*
   ------------------------------------------------------------------------------
-  oled_write_block
+  oled_send
+
+  Send the changed parts of a frame, and clear its dirty spans.
+
+  The changes in each page are found as runs of columns.  A page with
+  a single run can join the window of the page above when the bytes
+  that adds (the union is a rectangle) cost less than another window
+  would, so a field spanning pages (OLED_FONT_LARGE, say) or a column
+  of similar fields goes in one window.
 */
 
 static int
-oled_write_block(int handle, char *data, int length)
+oled_send(int handle, struct frame *frame)
 {
-	char buffer[129];
+	struct window open = { -1, -1, -1, -1 };
+	struct window windows[MAX_WINDOWS];
+	int runs[WIDTH / 2][2];
+	int count = 0;
+	int y;
+	int i;
+	int rc = 0;
+
+	for (y = 0; y < PAGES; ++y) {
+		char *new = &frame->data[WIDTH * y];
+		char *old = &panel[WIDTH * y];
+		struct span *dirty = &frame->dirty[y];
+		int nruns = 0;
+		int x;
+
+		if (0 <= dirty->first) {
+			for (x = dirty->first; x <= dirty->last; ++x) {
+				if (panel_valid && new[x] == old[x])
+					continue;
+
+				if (0 < nruns &&
+				    OVERHEAD >= x - runs[nruns - 1][1]) {
+					runs[nruns - 1][1] = x;
+				} else {
+					runs[nruns][0] = x;
+					runs[nruns][1] = x;
+					++nruns;
+				}
+			}
+
+			dirty->first = -1;
+			dirty->last = -1;
+		}
+
+		if (1 == nruns && 0 <= open.x0 && open.y1 == y - 1) {
+			int x0 = (runs[0][0] < open.x0) ? runs[0][0] : open.x0;
+			int x1 = (runs[0][1] > open.x1) ? runs[0][1] : open.x1;
+			int joined = (x1 - x0 + 1) * (y - open.y0 + 1);
+			int apart = (open.x1 - open.x0 + 1) *
+				(open.y1 - open.y0 + 1) +
+				(runs[0][1] - runs[0][0] + 1) + OVERHEAD;
+
+			if (joined <= apart) {
+				open.x0 = x0;
+				open.x1 = x1;
+				open.y1 = y;
+
+				continue;
+			}
+		}
 
-	buffer[0] = 0x40;
-	memcpy(&buffer[1], data, length);
-	(void)oled_buffer(handle, buffer, (length + 1));
-	memcpy(&screen[offset], data, length);
-	offset += length;
+		if (0 <= open.x0) {
+			windows[count++] = open;
+			open.x0 = -1;
+		}
 
-	return 0;
+		if (1 == nruns) {
+			open.x0 = runs[0][0];
+			open.x1 = runs[0][1];
+			open.y0 = y;
+			open.y1 = y;
+
+			continue;
+		}
+
+		for (i = 0; i < nruns; ++i) {
+			windows[count].x0 = runs[i][0];
+			windows[count].x1 = runs[i][1];
+			windows[count].y0 = y;
+			windows[count].y1 = y;
+			++count;
+		}
+	}
+
+	if (0 <= open.x0)
+		windows[count++] = open;
+
+	if (0 < count)
+		rc = oled_windows(handle, frame->data, windows, count);
+
+	/* If anything failed, the panel can't be trusted. */
+	if (rc) {
+		panel_valid = false;
+
+		for (y = 0; y < PAGES; ++y)
+			oled_span(&frame->dirty[y], 0, WIDTH - 1);
+	} else {
+		panel_valid = true;
+	}
+
+	return rc;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_writer
+*/
+
+static void *
+oled_writer(__attribute__((unused)) void *input)
+{
+	struct sched_param params;
+	int rc;
+	int y;
+
+	/* Only run when nothing else wants to. */
+	params.sched_priority = 0;
+	rc = pthread_setschedparam(pthread_self(), SCHED_IDLE, &params);
+
+	if (rc)
+		fprintf(stderr, "%s:%d - pthread_setschedparam() failed: %s\n",
+			__FILE__, __LINE__, strerror(rc));
+
+	pthread_mutex_lock(&writer.mutex);
+
+	for (;;) {
+		while (writer.running && !writer.ready)
+			pthread_cond_wait(&writer.cond, &writer.mutex);
+
+		if (!writer.running)
+			break;
+
+		/*
+		  Anything left dirty in 'sending' (a failed write) stays,
+		  the spans of the new frame are added to it.
+		*/
+
+		memcpy(writer.sending.data, writer.pending.data,
+		       sizeof(writer.sending.data));
+
+		for (y = 0; y < PAGES; ++y) {
+			struct span *span = &writer.pending.dirty[y];
+
+			if (0 <= span->first)
+				oled_span(&writer.sending.dirty[y],
+					  span->first, span->last);
+
+			span->first = -1;
+			span->last = -1;
+		}
+
+		writer.ready = false;
+		pthread_mutex_unlock(&writer.mutex);
+
+		(void)oled_send(writer.handle, &writer.sending);
+
+		pthread_mutex_lock(&writer.mutex);
+	}
+
+	pthread_mutex_unlock(&writer.mutex);
+
+	return NULL;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_column
+
+  Set the pixels in 'mask' of column x, from pixel row y down, to
+  'bits' (bit 0 at row y).  Only the bytes that change are marked.
+*/
+
+static void
+oled_column(unsigned x, unsigned y, uint32_t bits, uint32_t mask)
+{
+	uint64_t b;
+	uint64_t m;
+	unsigned page;
+
+	if (WIDTH <= x)
+		return;
+
+	b = (uint64_t)bits << (y & 7);
+	m = (uint64_t)mask << (y & 7);
+
+	for (page = y >> 3; 0 != m && PAGES > page; ++page) {
+		unsigned char *byte;
+		unsigned char new;
+
+		byte = (unsigned char *)&screen.data[x + (WIDTH * page)];
+		new = (*byte & ~(m & 0xff)) | (b & m & 0xff);
+
+		if (new != *byte) {
+			*byte = new;
+			oled_span(&screen.dirty[page], x, x);
+		}
+
+		b >>= 8;
+		m >>= 8;
+	}
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_glyph
+
+  Draw a glyph with its top left corner at pixel (x, y).  The whole
+  cell is drawn, so there is no need to clear under it first.
+  Characters the font doesn't have are blank.
+*/
+
+static void
+oled_glyph(unsigned x, unsigned y, const struct font *font, unsigned char c)
+{
+	const unsigned char *column = NULL;
+	unsigned bytes;
+	uint32_t mask;
+	unsigned i;
+	unsigned j;
+
+	bytes = (font->height + 7) / 8;
+	mask = (1UL << font->height) - 1;
+
+	if (c < font->glyphs)
+		column = &font->columns[c * font->width * bytes];
+
+	for (i = 0; i < font->width; ++i) {
+		uint32_t bits = 0;
+
+		if (NULL != column) {
+			for (j = 0; j < bytes; ++j)
+				bits |= (uint32_t)*column++ << (8 * j);
+		}
+
+		oled_column(x + i, y, bits, mask);
+	}
 }
 
 /*
@@ -3541,9 +660,11 @@ oled_initialize(int handle, bool flip, bool invert)
 		/* Initialize with the initialization sequence. */
 		0x00, 0xae, 0xa8, 0x3f, 0xd3, 0x00, 0x40, 0xa1,
 		0xc8, 0xda, 0x12, 0x81, 0xff, 0xa4, 0xa6, 0xd5,
-		0x80, 0x8d, 0x14, 0xaf, 0x20, 0x02
+		0x80, 0x8d, 0x14, 0xaf, 0x20, 0x00
 	};
 
+	oled_invalidate();
+
 	rc = oled_buffer(handle, buffer, sizeof(buffer));
 
 	if (rc)
@@ -3582,6 +703,17 @@ oled_finalize(int handle)
 	return oled_write1(handle, 0xae);
 }
 
+/*
+  ------------------------------------------------------------------------------
+  oled_display
+*/
+
+int
+oled_display(int handle, bool on)
+{
+	return oled_write1(handle, on ? 0xaf : 0xae);
+}
+
 /*
   ------------------------------------------------------------------------------
   oled_contrast
@@ -3593,33 +725,180 @@ oled_contrast(int handle, char contrast)
 	return oled_write2(handle, 0x81, contrast);
 }
 
+/*
+  ------------------------------------------------------------------------------
+  oled_get_counts
+*/
+
+void
+oled_get_counts(struct oled_counts *out, bool reset)
+{
+	pthread_mutex_lock(&counts_mutex);
+	*out = counts;
+
+	if (reset)
+		memset(&counts, 0, sizeof(counts));
+
+	pthread_mutex_unlock(&counts_mutex);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_update
+*/
+
+int
+oled_update(int handle)
+{
+	return oled_send(handle, &screen);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_start
+*/
+
+int
+oled_start(int handle)
+{
+	int rc;
+	int y;
+
+	if (writer.running)
+		return 0;
+
+	writer.handle = handle;
+	writer.running = true;
+	writer.ready = false;
+
+	for (y = 0; y < PAGES; ++y) {
+		writer.pending.dirty[y].first = -1;
+		writer.pending.dirty[y].last = -1;
+		writer.sending.dirty[y].first = -1;
+		writer.sending.dirty[y].last = -1;
+	}
+
+	rc = pthread_create(&writer.thread, NULL, oled_writer, NULL);
+
+	if (rc) {
+		fprintf(stderr, "%s:%d - pthread_create() failed: %s\n",
+			__FILE__, __LINE__, strerror(rc));
+		writer.running = false;
+
+		return -1;
+	}
+
+	rc = pthread_setname_np(writer.thread, "pimount.oled");
+
+	if (rc)
+		fprintf(stderr, "%s:%d - pthread_setname_np() failed\n",
+			__FILE__, __LINE__);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_present
+*/
+
+int
+oled_present(void)
+{
+	int y;
+
+	if (!writer.running)
+		return -1;
+
+	/* Nothing new, don't wake the thread. */
+	for (y = 0; y < PAGES; ++y)
+		if (0 <= screen.dirty[y].first)
+			break;
+
+	if (PAGES == y)
+		return 0;
+
+	pthread_mutex_lock(&writer.mutex);
+
+	memcpy(writer.pending.data, screen.data, sizeof(screen.data));
+
+	for (y = 0; y < PAGES; ++y) {
+		struct span *span = &screen.dirty[y];
+
+		if (0 <= span->first)
+			oled_span(&writer.pending.dirty[y],
+				  span->first, span->last);
+
+		span->first = -1;
+		span->last = -1;
+	}
+
+	writer.ready = true;
+	pthread_cond_signal(&writer.cond);
+	pthread_mutex_unlock(&writer.mutex);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_stop
+*/
+
+void
+oled_stop(void)
+{
+	int y;
+
+	if (!writer.running)
+		return;
+
+	pthread_mutex_lock(&writer.mutex);
+	writer.running = false;
+	pthread_cond_signal(&writer.cond);
+	pthread_mutex_unlock(&writer.mutex);
+
+	pthread_join(writer.thread, NULL);
+
+	/* Whatever the writer didn't get to is left for oled_update(). */
+	for (y = 0; y < PAGES; ++y) {
+		if (0 <= writer.sending.dirty[y].first)
+			oled_span(&screen.dirty[y],
+				  writer.sending.dirty[y].first,
+				  writer.sending.dirty[y].last);
+
+		if (0 <= writer.pending.dirty[y].first)
+			oled_span(&screen.dirty[y],
+				  writer.pending.dirty[y].first,
+				  writer.pending.dirty[y].last);
+	}
+}
+
 /*
   ------------------------------------------------------------------------------
   oled_pixel
 */
 
 int
-oled_pixel(int handle, unsigned x, unsigned y, bool on)
+oled_pixel(__attribute__((unused)) int handle,
+	   unsigned x, unsigned y, bool on)
 {
 	unsigned i;
 	char new;
-	char current;
 
-	i = x + ((y >> 3) * 128);
+	i = x + ((y >> 3) * WIDTH);
 
-	if (1023 < i)		/* Off Screen */
+	if (WIDTH <= x || 1023 < i)	/* Off Screen */
 		return -1;
 
-	current = screen[i];
-	new = current;
+	new = screen.data[i];
 
 	if (on)
 		new |= (1 << (y & 7));
 	else
 		new &= ~(1 << (y & 7));
 
-	oled_position(handle, x, (y >> 3));
-	oled_write_block(handle, &new, 1);
+	oled_draw(x, (y >> 3), &new, 1);
 
 	return 0;
 }
@@ -3632,10 +911,10 @@ oled_pixel(int handle, unsigned x, unsigned y, bool on)
 */
 
 int
-oled_fill(int handle, bool on,
+oled_fill(__attribute__((unused)) int handle, bool on,
 	  unsigned x0, unsigned y0, unsigned x1, unsigned y1)
 {
-	char buffer[128];
+	char buffer[WIDTH];
 	unsigned i;
 
 	/* Make sure everything fits, x1 > x0, y1 > y0, etc. */
@@ -3644,16 +923,67 @@ oled_fill(int handle, bool on,
 		return -1;
 	}
 
-	/* Simplest case, full screen! */
-
 	if (on)
 		memset(buffer, 0xff, sizeof(buffer));
 	else
 		memset(buffer, 0, sizeof(buffer));
 
-	for (i = y0; i <= y1; ++i) {
-		oled_position(handle, x0 * 8, i);
-		oled_write_block(handle, buffer, (x1 - x0 + 1) * 8);
+	for (i = y0; i <= y1; ++i)
+		oled_draw(x0 * 8, i, buffer, (x1 - x0 + 1) * 8);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_vline
+*/
+
+int
+oled_vline(unsigned x, unsigned y0, unsigned y1, bool on)
+{
+	uint32_t mask;
+
+	if (y0 > y1 || WIDTH <= x || (PAGES * 8) <= y1)
+		return -1;
+
+	/* At most 32 rows at a time. */
+	for (; y0 + 32 <= y1 + 1; y0 += 32)
+		oled_column(x, y0, on ? 0xffffffff : 0, 0xffffffff);
+
+	if (y0 <= y1) {
+		mask = (1UL << (y1 - y0 + 1)) - 1;
+		oled_column(x, y0, on ? mask : 0, mask);
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oled_scroll
+*/
+
+int
+oled_scroll(unsigned x0, unsigned x1, unsigned y0, unsigned y1)
+{
+	unsigned y;
+	unsigned x;
+
+	if (x0 > x1 || y0 > y1 || WIDTH <= x1 || PAGES <= y1)
+		return -1;
+
+	for (y = y0; y <= y1; ++y) {
+		char *row = &screen.data[WIDTH * y];
+
+		for (x = x0; x <= x1; ++x) {
+			char new = (x < x1) ? row[x + 1] : 0;
+
+			if (new != row[x]) {
+				row[x] = new;
+				oled_span(&screen.dirty[y], x, x);
+			}
+		}
 	}
 
 	return 0;
@@ -3672,78 +1002,79 @@ oled_clear(int handle)
 
 /*
   ------------------------------------------------------------------------------
-  oled_print
+  oled_font_size
 */
 
 int
-oled_print(int handle, unsigned x, unsigned y, enum oled_font font, char *string)
+oled_font_size(enum oled_font font, unsigned *width, unsigned *height)
 {
-	int length;
-	int i;
-	char *new;
+	if (OLED_FONT_SMALL > font || OLED_FONT_LARGE < font)
+		return -1;
 
-	length = strlen(string);
+	*width = fonts[font].width;
+	*height = fonts[font].height;
 
-	switch (font) {
-	case OLED_FONT_SMALL:
-		if (7 < y)
-			return -1;
+	return 0;
+}
 
-		if (length + x > 21)
-			length = 21 - x;
+/*
+  ------------------------------------------------------------------------------
+  oled_text
+*/
 
-		if (0 > length)
-			return -1;
+int
+oled_text(unsigned x, unsigned y, enum oled_font font, const char *string)
+{
+	const struct font *f;
 
-		oled_position(handle, x * 6, y);
+	if (OLED_FONT_SMALL > font || OLED_FONT_LARGE < font)
+		return -1;
 
-		for (i = 0; i < length; ++i) {
-			new = &oled_font_small[((char)string[i] * 6)];
-			oled_write_block(handle, new, 6);
-		}
+	f = &fonts[font];
 
-		break;
-	case OLED_FONT_MEDIUM:
-		if (7 < y)
-			return -1;
+	for (; '\0' != *string && WIDTH > x; ++string, x += f->width)
+		oled_glyph(x, y, f, (unsigned char)*string);
 
-		if (length + x > 16)
-			length = 16 - x;
+	return 0;
+}
 
-		if (length < 0)
-			return -1;
+/*
+  ------------------------------------------------------------------------------
+  oled_print
+*/
 
-		oled_position(handle, x * 8, y);
+int
+oled_print(__attribute__((unused)) int handle,
+	   unsigned x, unsigned y, enum oled_font font, char *string)
+{
+	char buffer[WIDTH / 6 + 1];
+	int length;
+	int columns;
 
-		for (i = 0; i < length; ++i) {
-			new = &oled_font_medium[((char)string[i] * 8)];
-			oled_write_block(handle, new, 8);
-		}
+	switch (font) {
+	case OLED_FONT_SMALL:
+	case OLED_FONT_MEDIUM:
+		if (7 < y)
+			return -1;
 
 		break;
 	case OLED_FONT_LARGE:
-		if (length + x > 8)
-			length = 8 - x;
-
-		if (length < 0)
-			return -1;
-
-		x *= 16;
-
-		for (i = 0; i < length; ++i) {
-			new = &oled_font_large[((char)string[i] * 64)];
-			oled_position(handle, x + i * 16, y);
-			oled_write_block(handle, new, 16);
-			oled_position(handle, x + i * 16, y + 1);
-			oled_write_block(handle, new + 16, 16);
-			oled_position(handle, x + i * 16, y + 2);
-			oled_write_block(handle, new + 32, 16);
-		}
-
 		break;
 	default:
 		return -1;
 	}
 
-	return 0;
+	columns = WIDTH / fonts[font].width;
+	length = strlen(string);
+
+	if (length + (int)x > columns)
+		length = columns - x;
+
+	if (0 > length)
+		return -1;
+
+	memcpy(buffer, string, length);
+	buffer[length] = '\0';
+
+	return oled_text(x * fonts[font].width, y * 8, font, buffer);
 }
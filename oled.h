@@ -11,6 +11,8 @@
 #ifndef _OLED_H_
 #define _OLED_H_
 
+#define OLED_ADDRESS 0x3c
+
 enum oled_font {
 	OLED_FONT_INVALID = -1,
 	OLED_FONT_SMALL,
@@ -42,6 +44,45 @@ int oled_finalize(int handle);
 
 int oled_contrast(int handle, char contrast);
 
+/* Turn the panel off (it keeps what it shows) or back on. */
+
+int oled_display(int handle, bool on);
+
+/*
+  The functions below only draw into a copy of the screen in memory,
+  nothing is sent until oled_update().  That sends just the bytes that
+  differ from what the panel already shows, each run of changed
+  columns in a page as one burst.
+*/
+
+int oled_update(int handle);
+
+/*
+  Or let a low priority thread send them.  oled_present() hands what
+  has been drawn so far to the thread and returns right away; if the
+  thread is still busy with an earlier frame, it sends the latest one
+  next.  A slow or hung I2C bus then only holds up the display.  Don't
+  mix oled_update() with the thread, stop it first.
+*/
+
+int oled_start(int handle);
+int oled_present(void);
+void oled_stop(void);
+
+/*
+  I2C traffic since the last reset.  Every i2cWriteDevice() or
+  i2cSegments() call is one transaction, 'bytes' doesn't include the
+  address bytes, and 'seconds' is the time spent in those calls.
+*/
+
+struct oled_counts {
+	unsigned long transactions;
+	unsigned long bytes;
+	double seconds;
+};
+
+void oled_get_counts(struct oled_counts *counts, bool reset);
+
 /*
   Coordinates are as expected, x is 0...127 and y is 0...63.
 */
@@ -60,6 +101,17 @@ int oled_fill(int handle, bool on,
 
 int oled_clear(int handle);
 
+/* Pixels y0...y1 of column x. */
+
+int oled_vline(unsigned x, unsigned y0, unsigned y1, bool on);
+
+/*
+  Move columns x0 + 1...x1 of pages y0...y1 left by one, and clear
+  column x1.  Only the bytes that change are sent.
+*/
+
+int oled_scroll(unsigned x0, unsigned x1, unsigned y0, unsigned y1);
+
 /*
   Coordinates are NOT as expected.
 
@@ -78,4 +130,17 @@ int oled_clear(int handle);
 int oled_print(int handle,
 	       unsigned x, unsigned y, enum oled_font font, char *string);
 
+/*
+  Text at any pixel, (x, y) is the top left corner of the first
+  character and the text is clipped at the edges of the screen.  The
+  whole of each character cell is drawn, so changing text doesn't need
+  an oled_fill() first.
+*/
+
+int oled_text(unsigned x, unsigned y, enum oled_font font, const char *string);
+
+/* The character cell, in pixels. */
+
+int oled_font_size(enum oled_font font, unsigned *width, unsigned *height);
+
 #endif	/* _OLED_H_ */
@@ -0,0 +1,590 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  oledsim.c
+
+  See oledsim.h.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "oledsim.h"
+
+/*
+  ==============================================================================
+  Private
+  ==============================================================================
+*/
+
+#define WIDTH 128
+#define HEIGHT 64
+#define PAGES 8
+
+enum mode {
+	MODE_HORIZONTAL,
+	MODE_VERTICAL,
+	MODE_PAGE
+};
+
+static struct {
+	pthread_mutex_t mutex;
+	unsigned char ram[PAGES][WIDTH];
+
+	/* Set by commands */
+	enum mode mode;
+	unsigned column;
+	unsigned page;
+	unsigned column_start;
+	unsigned column_end;
+	unsigned page_start;
+	unsigned page_end;
+	bool on;
+	bool inverse;
+	bool remap;		/* 0xa1, the default of oled_initialize() */
+	bool scan_reverse;	/* 0xc8, as above */
+
+	/* A command waiting for its arguments */
+	unsigned char command[7];
+	unsigned have;
+	unsigned need;
+
+	struct oledsim_counts counts;
+} panel = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.mode = MODE_PAGE,	/* after reset */
+	.column_end = WIDTH - 1,
+	.page_end = PAGES - 1,
+	.remap = true,
+	.scan_reverse = true,
+};
+
+/*
+  ------------------------------------------------------------------------------
+  arguments
+
+  How many bytes follow a command.
+*/
+
+static unsigned
+arguments(unsigned char command)
+{
+	switch (command) {
+	case 0x20: case 0x81: case 0x8d: case 0xa8: case 0xd3:
+	case 0xd5: case 0xd6: case 0xd9: case 0xda: case 0xdb:
+		return 1;
+	case 0x21: case 0x22: case 0xa3:
+		return 2;
+	case 0x29: case 0x2a:
+		return 5;
+	case 0x26: case 0x27:
+		return 6;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  execute
+*/
+
+static void
+execute(const unsigned char *c)
+{
+	if (0x00 == (c[0] & 0xf0)) {
+		/* Lower column nibble, page addressing */
+		panel.column = (panel.column & 0xf0) | (c[0] & 0x0f);
+	} else if (0x10 == (c[0] & 0xf0)) {
+		/* Upper column nibble, page addressing */
+		panel.column = (panel.column & 0x0f) | ((c[0] & 0x07) << 4);
+	} else if (0xb0 == (c[0] & 0xf8)) {
+		panel.page = c[0] & 0x07;
+	} else {
+		switch (c[0]) {
+		case 0x20:
+			panel.mode = (3 == (c[1] & 3)) ? MODE_PAGE : (c[1] & 3);
+			break;
+		case 0x21:
+			panel.column_start = c[1] & 0x7f;
+			panel.column_end = c[2] & 0x7f;
+			panel.column = panel.column_start;
+			break;
+		case 0x22:
+			panel.page_start = c[1] & 0x07;
+			panel.page_end = c[2] & 0x07;
+			panel.page = panel.page_start;
+			break;
+		case 0xa0:
+		case 0xa1:
+			panel.remap = (0xa1 == c[0]);
+			break;
+		case 0xa6:
+		case 0xa7:
+			panel.inverse = (0xa7 == c[0]);
+			break;
+		case 0xae:
+		case 0xaf:
+			panel.on = (0xaf == c[0]);
+			break;
+		case 0xc0:
+		case 0xc8:
+			panel.scan_reverse = (0xc8 == c[0]);
+			break;
+		default:
+			/* Contrast, timing, charge pump... don't change the image. */
+			break;
+		}
+	}
+}
+
+/*
+  ------------------------------------------------------------------------------
+  command
+*/
+
+static void
+command(unsigned char byte)
+{
+	if (0 == panel.need) {
+		panel.have = 0;
+		panel.need = 1 + arguments(byte);
+	}
+
+	panel.command[panel.have++] = byte;
+
+	if (panel.have == panel.need) {
+		execute(panel.command);
+		panel.need = 0;
+	}
+}
+
+/*
+  ------------------------------------------------------------------------------
+  data
+
+  Write at the pointer, then move it as the addressing mode says.
+*/
+
+static void
+data(unsigned char byte)
+{
+	panel.ram[panel.page][panel.column] = byte;
+
+	switch (panel.mode) {
+	case MODE_HORIZONTAL:
+		if (panel.column_end <= panel.column) {
+			panel.column = panel.column_start;
+			panel.page = (panel.page_end <= panel.page) ?
+				panel.page_start : panel.page + 1;
+		} else {
+			++panel.column;
+		}
+
+		break;
+	case MODE_VERTICAL:
+		if (panel.page_end <= panel.page) {
+			panel.page = panel.page_start;
+			panel.column = (panel.column_end <= panel.column) ?
+				panel.column_start : panel.column + 1;
+		} else {
+			++panel.page;
+		}
+
+		break;
+	case MODE_PAGE:
+		panel.column = (WIDTH - 1 <= panel.column) ?
+			0 : panel.column + 1;
+		break;
+	}
+}
+
+/*
+  ------------------------------------------------------------------------------
+  message
+
+  One write to the panel: a control byte, then either one byte and
+  another control byte (if Co, 0x80, is set) or the rest as commands
+  or data (0x40).
+*/
+
+static void
+message(const unsigned char *buffer, unsigned length)
+{
+	unsigned i = 0;
+
+	while (i < length) {
+		unsigned char control = buffer[i++];
+
+		if (0 == (control & 0x80)) {
+			for (; i < length; ++i) {
+				if (control & 0x40)
+					data(buffer[i]);
+				else
+					command(buffer[i]);
+			}
+
+			break;
+		}
+
+		if (i < length) {
+			if (control & 0x40)
+				data(buffer[i]);
+			else
+				command(buffer[i]);
+
+			++i;
+		}
+	}
+}
+
+/*
+  ------------------------------------------------------------------------------
+  count
+
+  A transaction of 'segments' writes, 'bytes' in all.  Each segment
+  costs an address byte, each byte 9 bits (with the acknowledge), and
+  the start, repeated starts and stop about a bit each.
+*/
+
+static void
+count(unsigned segments, unsigned bytes)
+{
+	double bits = (double)(bytes + segments) * 9.0 + segments + 1;
+
+	++panel.counts.transactions;
+	panel.counts.bytes += bytes;
+	panel.counts.seconds += bits / OLEDSIM_CLOCK;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  lit
+*/
+
+static bool
+lit(unsigned x, unsigned y)
+{
+	unsigned column;
+	unsigned row;
+	bool on;
+
+	if (!panel.on)
+		return false;
+
+	/* oled_initialize() remaps both, which is the right way up. */
+	column = panel.remap ? x : (WIDTH - 1 - x);
+	row = panel.scan_reverse ? y : (HEIGHT - 1 - y);
+
+	on = 0 != (panel.ram[row >> 3][column] & (1 << (row & 7)));
+
+	return panel.inverse ? !on : on;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  crc32
+*/
+
+static uint32_t
+crc32(uint32_t crc, const unsigned char *buffer, unsigned length)
+{
+	unsigned i;
+	int k;
+
+	crc = ~crc;
+
+	for (i = 0; i < length; ++i) {
+		crc ^= buffer[i];
+
+		for (k = 0; k < 8; ++k)
+			crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+	}
+
+	return ~crc;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  chunk
+*/
+
+static void
+chunk(FILE *file, const char *type, const unsigned char *buffer,
+      unsigned length)
+{
+	unsigned char header[8];
+	unsigned char trailer[4];
+	uint32_t crc;
+
+	header[0] = length >> 24;
+	header[1] = length >> 16;
+	header[2] = length >> 8;
+	header[3] = length;
+	memcpy(&header[4], type, 4);
+
+	crc = crc32(0, &header[4], 4);
+	crc = crc32(crc, buffer, length);
+
+	trailer[0] = crc >> 24;
+	trailer[1] = crc >> 16;
+	trailer[2] = crc >> 8;
+	trailer[3] = crc;
+
+	fwrite(header, 1, sizeof(header), file);
+	fwrite(buffer, 1, length, file);
+	fwrite(trailer, 1, sizeof(trailer), file);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  save_png
+
+  1 bit grey scale, lit pixels white.  The image data is small enough
+  for a single stored (uncompressed) deflate block, so no zlib.
+*/
+
+#define ROW ((WIDTH / 8) + 1)	/* a filter byte, then the pixels */
+
+static void
+save_png(FILE *file)
+{
+	static const unsigned char signature[] = {
+		0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'
+	};
+	unsigned char ihdr[13] = {
+		0, 0, 0, WIDTH, 0, 0, 0, HEIGHT,
+		1,			/* bit depth */
+		0,			/* grey scale */
+		0, 0, 0
+	};
+	unsigned char idat[2 + 5 + (ROW * HEIGHT) + 4];
+	unsigned char *raw = &idat[7];
+	uint32_t a = 1;
+	uint32_t b = 0;
+	unsigned length = ROW * HEIGHT;
+	unsigned x;
+	unsigned y;
+	unsigned i;
+
+	memset(raw, 0, length);
+
+	for (y = 0; y < HEIGHT; ++y)
+		for (x = 0; x < WIDTH; ++x)
+			if (lit(x, y))
+				raw[(y * ROW) + 1 + (x / 8)] |= 0x80 >> (x & 7);
+
+	for (i = 0; i < length; ++i) {
+		a = (a + raw[i]) % 65521;
+		b = (b + a) % 65521;
+	}
+
+	idat[0] = 0x78;		/* zlib, 32K window */
+	idat[1] = 0x01;
+	idat[2] = 0x01;		/* the final block, stored */
+	idat[3] = length & 0xff;
+	idat[4] = length >> 8;
+	idat[5] = ~length & 0xff;
+	idat[6] = (~length >> 8) & 0xff;
+	idat[7 + length] = (b >> 8) & 0xff;
+	idat[8 + length] = b & 0xff;
+	idat[9 + length] = (a >> 8) & 0xff;
+	idat[10 + length] = a & 0xff;
+
+	fwrite(signature, 1, sizeof(signature), file);
+	chunk(file, "IHDR", ihdr, sizeof(ihdr));
+	chunk(file, "IDAT", idat, sizeof(idat));
+	chunk(file, "IEND", NULL, 0);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  save_pbm
+
+  In PBM, 1 is black, so unlit pixels are set.
+*/
+
+static void
+save_pbm(FILE *file)
+{
+	unsigned char row[WIDTH / 8];
+	unsigned x;
+	unsigned y;
+
+	fprintf(file, "P4\n%d %d\n", WIDTH, HEIGHT);
+
+	for (y = 0; y < HEIGHT; ++y) {
+		memset(row, 0, sizeof(row));
+
+		for (x = 0; x < WIDTH; ++x)
+			if (!lit(x, y))
+				row[x / 8] |= 0x80 >> (x & 7);
+
+		fwrite(row, 1, sizeof(row), file);
+	}
+}
+
+/*
+  ==============================================================================
+  Public
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  The pigpio stand ins
+*/
+
+int
+gpioInitialise(void)
+{
+	return 0;
+}
+
+void
+gpioTerminate(void)
+{
+	return;
+}
+
+int
+i2cOpen(__attribute__((unused)) unsigned bus,
+	__attribute__((unused)) unsigned addr,
+	__attribute__((unused)) unsigned flags)
+{
+	return 0;
+}
+
+int
+i2cClose(__attribute__((unused)) unsigned handle)
+{
+	return 0;
+}
+
+int
+i2cWriteDevice(__attribute__((unused)) unsigned handle,
+	       char *buf, unsigned count_)
+{
+	pthread_mutex_lock(&panel.mutex);
+	message((unsigned char *)buf, count_);
+	count(1, count_);
+	pthread_mutex_unlock(&panel.mutex);
+
+	return 0;
+}
+
+int
+i2cSegments(__attribute__((unused)) unsigned handle,
+	    pi_i2c_msg_t *segs, unsigned numSegs)
+{
+	unsigned bytes = 0;
+	unsigned i;
+
+	pthread_mutex_lock(&panel.mutex);
+
+	for (i = 0; i < numSegs; ++i) {
+		message(segs[i].buf, segs[i].len);
+		bytes += segs[i].len;
+	}
+
+	count(numSegs, bytes);
+	pthread_mutex_unlock(&panel.mutex);
+
+	return numSegs;
+}
+
+char *
+cmdErrStr(__attribute__((unused)) int error)
+{
+	return "simulated";
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oledsim_get_counts
+*/
+
+void
+oledsim_get_counts(struct oledsim_counts *counts, bool reset)
+{
+	pthread_mutex_lock(&panel.mutex);
+	*counts = panel.counts;
+
+	if (reset)
+		memset(&panel.counts, 0, sizeof(panel.counts));
+
+	pthread_mutex_unlock(&panel.mutex);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oledsim_pixel
+*/
+
+bool
+oledsim_pixel(unsigned x, unsigned y)
+{
+	bool on;
+
+	if (WIDTH <= x || HEIGHT <= y)
+		return false;
+
+	pthread_mutex_lock(&panel.mutex);
+	on = lit(x, y);
+	pthread_mutex_unlock(&panel.mutex);
+
+	return on;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  oledsim_save
+*/
+
+int
+oledsim_save(const char *path)
+{
+	FILE *file;
+	size_t length;
+	int rc = 0;
+
+	file = fopen(path, "wb");
+
+	if (NULL == file) {
+		fprintf(stderr, "%s:%d - fopen(%s) failed: %s\n",
+			__FILE__, __LINE__, path, strerror(errno));
+
+		return -1;
+	}
+
+	length = strlen(path);
+
+	pthread_mutex_lock(&panel.mutex);
+
+	if (4 <= length && 0 == strcmp(&path[length - 4], ".png"))
+		save_png(file);
+	else
+		save_pbm(file);
+
+	pthread_mutex_unlock(&panel.mutex);
+
+	if (ferror(file)) {
+		fprintf(stderr, "%s:%d - writing %s failed\n",
+			__FILE__, __LINE__, path);
+		rc = -1;
+	}
+
+	if (fclose(file))
+		rc = -1;
+
+	return rc;
+}
@@ -0,0 +1,69 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  oledsim.h
+
+  A simulated SSD1306, for working on the display without one.
+
+  Build oled.c with -DOLED_SIMULATE and link with oledsim.o instead of
+  pigpio: these stand in for the pigpio calls the display code makes,
+  and feed what would have gone over I2C to a model of the panel.  The
+  model follows the commands (addressing modes, windows, display on
+  and off, inverse, remapping) and keeps the panel's memory, so what
+  it shows can be saved as an image.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _OLEDSIM_H_
+#define _OLEDSIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  The pigpio subset.
+*/
+
+typedef struct {
+	uint16_t addr;
+	uint16_t flags;
+	uint16_t len;
+	uint8_t *buf;
+} pi_i2c_msg_t;
+
+#define PI_INIT_FAILED -1
+#define PI_I2C_M_WR 0x0000
+
+int gpioInitialise(void);
+void gpioTerminate(void);
+int i2cOpen(unsigned bus, unsigned addr, unsigned flags);
+int i2cClose(unsigned handle);
+int i2cWriteDevice(unsigned handle, char *buf, unsigned count);
+int i2cSegments(unsigned handle, pi_i2c_msg_t *segs, unsigned numSegs);
+char *cmdErrStr(int error);
+
+/*
+  What the panel received since the last reset.  'seconds' is the bus
+  time at OLEDSIM_CLOCK, counting the address bytes, starts and stops.
+*/
+
+#define OLEDSIM_CLOCK 100000.0	/* Hz, the Raspberry Pi default */
+
+struct oledsim_counts {
+	unsigned long transactions;
+	unsigned long bytes;
+	double seconds;
+};
+
+void oledsim_get_counts(struct oledsim_counts *counts, bool reset);
+
+/* Is the pixel at (x, y) lit, as someone looking at the panel sees it? */
+
+bool oledsim_pixel(unsigned x, unsigned y);
+
+/* Save what the panel shows, as PNG if path ends in ".png" or PBM. */
+
+int oledsim_save(const char *path);
+
+#endif	/* _OLEDSIM_H_ */
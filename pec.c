@@ -0,0 +1,152 @@
+/*
+  ==============================================================================
+  pec.c
+
+  Periodic error correction, see pec.h.
+  ==============================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <math.h>
+#include <errno.h>
+
+#include "pec.h"
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Private Stuff
+  ==============================================================================
+  ==============================================================================
+*/
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool enabled;
+static double period;
+static long long origin;
+
+/* One extra entry, so interpolation never has to wrap. */
+static float table[PEC_TABLE_SIZE + 1];
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Public Stuff
+  ==============================================================================
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  pec_set
+*/
+
+int
+pec_set(const struct pec *pec)
+{
+	float new[PEC_TABLE_SIZE + 1];
+	int i;
+	int k;
+
+	if (pec->enable && (!isfinite(pec->period) || 1.0 > pec->period)) {
+		fprintf(stderr, "%s:%d - Invalid Worm Period: %f\n",
+			__FILE__, __LINE__, pec->period);
+
+		return -EINVAL;
+	}
+
+	/* Evaluate the harmonics outside the lock. */
+	for (i = 0; i < PEC_TABLE_SIZE; ++i) {
+		double phase;
+		double rate;
+
+		phase = (2.0 * M_PI * i) / PEC_TABLE_SIZE;
+		rate = 0.0;
+
+		for (k = 0; k < PEC_HARMONICS; ++k)
+			rate += pec->a[k] * cos((k + 1) * phase) +
+				pec->b[k] * sin((k + 1) * phase);
+
+		new[i] = rate;
+	}
+
+	new[PEC_TABLE_SIZE] = new[0];
+
+	pthread_mutex_lock(&mutex);
+	enabled = pec->enable;
+	period = pec->period;
+	origin = pec->origin;
+	memcpy(table, new, sizeof(table));
+	pthread_mutex_unlock(&mutex);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  pec_enabled
+*/
+
+bool
+pec_enabled(void)
+{
+	bool rc;
+
+	pthread_mutex_lock(&mutex);
+	rc = enabled;
+	pthread_mutex_unlock(&mutex);
+
+	return rc;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  pec_tracking
+*/
+
+bool
+pec_tracking(double rate)
+{
+	return PEC_TRACKING_LOW <= rate && PEC_TRACKING_HIGH >= rate;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  pec_rate
+*/
+
+double
+pec_rate(long long position)
+{
+	double phase;
+	double rate;
+	int i;
+
+	pthread_mutex_lock(&mutex);
+
+	if (!enabled) {
+		pthread_mutex_unlock(&mutex);
+
+		return 0.0;
+	}
+
+	phase = fmod((double)(position - origin), period);
+
+	if (0.0 > phase)
+		phase += period;
+
+	phase = (phase / period) * PEC_TABLE_SIZE;
+	i = (int)phase;
+
+	if (PEC_TABLE_SIZE <= i)
+		i = PEC_TABLE_SIZE - 1;
+
+	phase -= i;
+	rate = table[i] + phase * (table[i + 1] - table[i]);
+	pthread_mutex_unlock(&mutex);
+
+	return rate;
+}
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  pec.h
+
+  Periodic error correction.  The RA worm turns once every
+  'period' 1/8 steps of the RA motor (see stepper_get_position()), so
+  the worm phase follows from the RA step count -- whatever the axis
+  did in between.  The correction is a rate (in arc-seconds per
+  second) added to the RA rate while tracking, described by a few
+  harmonics of the worm period.  Recording (and fitting) is done by
+  the client, see indi/periodic.h.
+
+  The phase is only as good as the step count, which starts over when
+  pimount does.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _PEC_H_
+#define _PEC_H_
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PEC_HARMONICS 8
+#define PEC_TABLE_SIZE 256
+
+/*
+  At worm phase p (0...2 pi), the correction is
+
+     sum over k of a[k] cos((k + 1) p) + b[k] sin((k + 1) p)
+
+  in arc-seconds per second.
+*/
+
+struct pec {
+	int enable;
+	double period;		/* 1/8 steps per turn of the worm */
+	long long origin;	/* RA position (1/8 steps) at phase 0 */
+	float a[PEC_HARMONICS];
+	float b[PEC_HARMONICS];
+};
+
+/*
+  Replace the correction.  Returns -EINVAL if the period is not
+  sensible.
+*/
+
+int pec_set(const struct pec *pec);
+
+bool pec_enabled(void);
+
+/*
+  The correction at an RA position (1/8 steps), 0.0 if disabled.
+  Called by the RA stepper thread for every step, so it just
+  interpolates in a table built by pec_set().
+*/
+
+double pec_rate(long long position);
+
+/*
+  Is an RA rate tracking (sidereal, solar, lunar, King or refraction,
+  all within a few percent of 15 arc-seconds per second)?  The
+  correction is only added then, not to slews or very slow rates.
+*/
+
+#define PEC_TRACKING_LOW 12.0
+#define PEC_TRACKING_HIGH 18.0
+
+bool pec_tracking(double rate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _PEC_H_ */
@@ -20,7 +20,9 @@ struct pimount_state state = {
 	.mutex = PTHREAD_MUTEX_INITIALIZER,
 	.control = PIMOUNT_CONTROL_OFF,
 	.ra_rate = 0.0,
-	.dec_rate = 0.0
+	.dec_rate = 0.0,
+	.ra_guide = 0.0,
+	.dec_guide = 0.0
 };
 
 /*
@@ -5,6 +5,7 @@
 #ifndef __PIMOUNT__H
 #define __PIMOUNT__H
 
+#include <stdbool.h>
 #include <pthread.h>
 
 #define JOYSTICK "/dev/input/js0"
@@ -63,15 +64,45 @@ pimount_control_names(enum pimount_control control)
 #define MAX_RA_RATE 120.0
 #define MAX_DEC_RATE 120.0
 
+/*
+  Rates (in arc-seconds per second) are kept to RATE_RESOLUTION, and
+  anything slower than that is stopped.
+*/
+
+#define RATE_RESOLUTION 0.001
+
+/*
+  Remote rate changes smaller than GUIDE_LIMIT (arc-seconds per second)
+  are taken to be guiding.  Their sizes are added up in ra_guide and
+  dec_guide, until the housekeeping loop's once a second tick takes
+  them (see stats.c and loop.h).
+*/
+
+#define GUIDE_LIMIT 15.0
+
 struct pimount_state {
 	pthread_mutex_t mutex;
 	enum pimount_control control;
 	double ra_rate;
 	double dec_rate;
+	double ra_guide;
+	double dec_guide;
 };
 
 extern struct pimount_state state;
 
+/*
+  Control, as done by the game controller (implemented in main.c).
+  Moving (c_ra() and c_dec()) and tracking require local control.
+*/
+
+void c_stop(void);
+void c_remote(void);
+void c_local(void);
+void c_track(void);
+void c_ra(bool positive);
+void c_dec(bool positive);
+
 /*
   (Un)Locking
 
@@ -0,0 +1,397 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  power.c
+
+  See power.h.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <glob.h>
+#include <time.h>
+
+#include "pimount.h"
+#include "stepper.h"
+#include "timespec.h"
+#include "loop.h"
+#include "power.h"
+
+/*
+  ==============================================================================
+  Private
+  ==============================================================================
+*/
+
+#define POLICIES "/sys/devices/system/cpu/cpufreq/policy*"
+#define POWER_POLICIES 4	/* a Pi has one */
+#define LATENCY "/dev/cpu_dma_latency"
+
+#define POWER_SLACK 0.5
+
+struct policy {
+	int fd;			/* scaling_min_freq */
+	long original;		/* kHz */
+	long maximum;		/* cpuinfo_max_freq */
+};
+
+/* Each second an axis ran, relaxed or held. */
+
+struct jitter {
+	unsigned long seconds;
+	double total;		/* us */
+	long worst;
+};
+
+static struct {
+	int timer;
+	unsigned count;
+	struct policy policies[POWER_POLICIES];
+	int latency_fd;		/* open while held */
+	bool held;
+	bool running;
+	struct timespec stopped;
+	long baseline;		/* relaxed seconds still to measure */
+	struct jitter relaxed;
+	struct jitter holding;
+} global = {
+	.timer = -1,
+	.count = 0,
+	.latency_fd = -1,
+	.held = false,
+	.running = false,
+	.baseline = POWER_BASELINE
+};
+
+/*
+  ------------------------------------------------------------------------------
+  read_khz
+*/
+
+static long
+read_khz(const char *directory, const char *name)
+{
+	char path[256];
+	char buffer[32];
+	ssize_t bytes;
+	int fd;
+
+	snprintf(path, sizeof(path), "%s/%s", directory, name);
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+
+	if (-1 == fd)
+		return -1;
+
+	bytes = read(fd, buffer, sizeof(buffer) - 1);
+	close(fd);
+
+	if (0 >= bytes)
+		return -1;
+
+	buffer[bytes] = '\0';
+
+	return strtol(buffer, NULL, 10);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  set_floor
+*/
+
+static void
+set_floor(bool maximum)
+{
+	char buffer[32];
+	unsigned i;
+	int length;
+
+	for (i = 0; i < global.count; ++i) {
+		struct policy *policy = &global.policies[i];
+
+		length = snprintf(buffer, sizeof(buffer), "%ld\n",
+				  maximum ? policy->maximum :
+				  policy->original);
+
+		if (length != pwrite(policy->fd, buffer, length, 0))
+			fprintf(stderr, "%s:%d - scaling_min_freq: %s\n",
+				__FILE__, __LINE__, strerror(errno));
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  hold
+*/
+
+static void
+hold(void)
+{
+	int32_t latency = POWER_LATENCY;
+
+	set_floor(true);
+
+	/* The request lasts as long as the file is open. */
+	global.latency_fd = open(LATENCY, O_WRONLY | O_CLOEXEC);
+
+	if (-1 == global.latency_fd) {
+		fprintf(stderr, "%s:%d - open(%s) failed: %s\n",
+			__FILE__, __LINE__, LATENCY, strerror(errno));
+	} else if (sizeof(latency) !=
+		   write(global.latency_fd, &latency, sizeof(latency))) {
+		fprintf(stderr, "%s:%d - write(%s) failed: %s\n",
+			__FILE__, __LINE__, LATENCY, strerror(errno));
+	}
+
+	global.held = true;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  relax
+*/
+
+static void
+relax(void)
+{
+	if (-1 != global.latency_fd)
+		close(global.latency_fd);
+
+	global.latency_fd = -1;
+	set_floor(false);
+	global.held = false;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  log_jitter
+*/
+
+static void
+log_jitter(void)
+{
+	const struct jitter *relaxed = &global.relaxed;
+	const struct jitter *holding = &global.holding;
+	double relaxed_mean;
+	double holding_mean;
+
+	if (0 == relaxed->seconds || 0 == holding->seconds)
+		return;
+
+	relaxed_mean = relaxed->total / relaxed->seconds;
+	holding_mean = holding->total / holding->seconds;
+
+	printf("=> Step Jitter: relaxed %.0f us (worst %ld, %lu s), "
+	       "held %.0f us (worst %ld, %lu s), %.0f us less\n",
+	       relaxed_mean, relaxed->worst, relaxed->seconds,
+	       holding_mean, holding->worst, holding->seconds,
+	       relaxed_mean - holding_mean);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  axes_running
+*/
+
+static bool
+axes_running(void)
+{
+	bool ra = false;
+	bool dec = false;
+
+	/* Changes are made under state.mutex, so wait for them. */
+	lock(&state.mutex);
+
+	if (stepper_get_status(STEPPER_AXIS_RA, &ra, NULL, NULL))
+		ra = false;
+
+	if (stepper_get_status(STEPPER_AXIS_DEC, &dec, NULL, NULL))
+		dec = false;
+
+	unlock(&state.mutex);
+
+	return ra || dec;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  check
+
+  Once a second, and when power_notify() says an axis has started or
+  stopped.
+*/
+
+static double
+check(__attribute__((unused)) void *data, struct timespec now)
+{
+	if (axes_running()) {
+		global.running = true;
+
+		if (!global.held && 0 >= global.baseline)
+			hold();
+
+		return 1.0;
+	}
+
+	if (global.running) {
+		global.running = false;
+		global.stopped = now;
+		log_jitter();
+	}
+
+	if (global.held &&
+	    POWER_RELAX_AFTER <=
+	    timespec_to_double(timespec_sub(now, global.stopped)))
+		relax();
+
+	return 1.0;
+}
+
+/*
+  ==============================================================================
+  Public
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  power_initialize
+*/
+
+int
+power_initialize(void)
+{
+	glob_t found;
+	size_t i;
+	char path[256];
+
+	global.count = 0;
+
+	if (0 == glob(POLICIES, 0, NULL, &found)) {
+		for (i = 0; i < found.gl_pathc; ++i) {
+			struct policy *policy;
+
+			if (POWER_POLICIES <= global.count)
+				break;
+
+			policy = &global.policies[global.count];
+			policy->original = read_khz(found.gl_pathv[i],
+						    "scaling_min_freq");
+			policy->maximum = read_khz(found.gl_pathv[i],
+						   "cpuinfo_max_freq");
+
+			if (0 >= policy->original || 0 >= policy->maximum)
+				continue;
+
+			snprintf(path, sizeof(path), "%s/scaling_min_freq",
+				 found.gl_pathv[i]);
+			policy->fd = open(path, O_WRONLY | O_CLOEXEC);
+
+			if (-1 == policy->fd) {
+				fprintf(stderr, "%s:%d - open(%s) failed: %s\n",
+					__FILE__, __LINE__, path,
+					strerror(errno));
+
+				continue;
+			}
+
+			++global.count;
+		}
+
+		globfree(&found);
+	}
+
+	global.timer = loop_timer(check, NULL, 0.0, POWER_SLACK);
+
+	if (-1 == global.timer) {
+		fprintf(stderr, "%s:%d - loop_timer() failed\n",
+			__FILE__, __LINE__);
+
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  power_finalize
+*/
+
+void
+power_finalize(void)
+{
+	unsigned i;
+
+	if (global.running)
+		log_jitter();
+
+	if (global.held)
+		relax();
+
+	for (i = 0; i < global.count; ++i)
+		close(global.policies[i].fd);
+
+	global.count = 0;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  power_notify
+*/
+
+void
+power_notify(void)
+{
+	/* Before power_initialize(), the first check picks it up. */
+	if (-1 != global.timer)
+		loop_schedule(global.timer, 0.0);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  power_late
+*/
+
+void
+power_late(long ra_late, long dec_late)
+{
+	struct jitter *jitter;
+	long late;
+
+	if (!global.running || 0 > ra_late || 0 > dec_late)
+		return;
+
+	late = (ra_late > dec_late) ? ra_late : dec_late;
+	jitter = global.held ? &global.holding : &global.relaxed;
+	++jitter->seconds;
+	jitter->total += late;
+
+	if (late > jitter->worst)
+		jitter->worst = late;
+
+	/* Enough of a baseline, hold now. */
+	if (!global.held && 0 < global.baseline && 0 == --global.baseline)
+		power_notify();
+
+	return;
+}
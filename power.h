@@ -0,0 +1,40 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  power.h
+
+  Frequency scaling and deep idle states add to the time the step
+  threads take to wake up (see stepper_get_late()), but holding the CPU
+  at its maximum all night costs power.  So while an axis is running,
+  the cpufreq floor (scaling_min_freq) is raised to the maximum and a
+  /dev/cpu_dma_latency request is held; once parked for
+  POWER_RELAX_AFTER seconds, both are put back.
+
+  To show what that buys, the first POWER_BASELINE seconds an axis
+  runs are left relaxed, and each time the axes stop the worst step
+  lateness of each second, relaxed and held, is logged.
+
+  Runs from the housekeeping loop (see loop.h).
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _POWER_H_
+#define _POWER_H_
+
+#define POWER_RELAX_AFTER 30.0	/* seconds */
+#define POWER_BASELINE 60	/* seconds */
+#define POWER_LATENCY 0		/* micro seconds, for cpu_dma_latency */
+
+int power_initialize(void);
+void power_finalize(void);
+
+/* After starting or stopping an axis; any thread. */
+
+void power_notify(void);
+
+/* The worst step lateness (us, -1 if unknown) over the last second. */
+
+void power_late(long ra_late, long dec_late);
+
+#endif	/* _POWER_H_ */
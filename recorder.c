@@ -0,0 +1,316 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  recorder.c
+
+  See recorder.h.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "recorder.h"
+
+/*
+  ==============================================================================
+  Private
+  ==============================================================================
+*/
+
+/* The format is the file, don't change it by accident. */
+
+_Static_assert(64 == sizeof(struct recorder_header), "header size");
+_Static_assert(64 == sizeof(struct recorder_record), "record size");
+
+static struct {
+	struct recorder_header *header;
+	struct recorder_record *records;
+	size_t size;		/* of the mapping */
+	uint64_t written;
+} global = {
+	.header = NULL,
+	.records = NULL,
+	.size = 0,
+	.written = 0
+};
+
+/*
+  ------------------------------------------------------------------------------
+  recorder_check
+
+  Is 'header' one of ours, and does the file size match?  Returns the
+  capacity, or 0 if not.
+*/
+
+static uint64_t
+recorder_check(const struct recorder_header *header, off_t size)
+{
+	if (0 != memcmp(header->magic, RECORDER_MAGIC, sizeof(header->magic)) ||
+	    RECORDER_VERSION != header->version ||
+	    sizeof(struct recorder_record) != header->record_size ||
+	    0 == header->capacity)
+		return 0;
+
+	if ((uint64_t)size != sizeof(struct recorder_header) +
+	    (header->capacity * sizeof(struct recorder_record)))
+		return 0;
+
+	return header->capacity;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  recorder_compare
+*/
+
+static int
+recorder_compare(const void *a, const void *b)
+{
+	const struct recorder_record *ra = a;
+	const struct recorder_record *rb = b;
+
+	if (ra->sequence < rb->sequence)
+		return -1;
+
+	return (ra->sequence > rb->sequence) ? 1 : 0;
+}
+
+/*
+  ==============================================================================
+  Public
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  recorder_open
+*/
+
+int
+recorder_open(const char *path, uint64_t capacity)
+{
+	int fd;
+	int rc;
+	struct stat status;
+	struct recorder_header header;
+	bool existing = false;
+	uint64_t i;
+	void *map;
+
+	if (NULL != global.header)
+		recorder_close();
+
+	fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+	if (-1 == fd) {
+		fprintf(stderr, "%s:%d - open(%s) failed: %s\n",
+			__FILE__, __LINE__, path, strerror(errno));
+
+		return -1;
+	}
+
+	if (-1 == fstat(fd, &status)) {
+		fprintf(stderr, "%s:%d - fstat() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+		close(fd);
+
+		return -1;
+	}
+
+	if (0 < status.st_size) {
+		/* Don't overwrite something that isn't a recording. */
+		if (sizeof(header) != pread(fd, &header, sizeof(header), 0) ||
+		    0 == recorder_check(&header, status.st_size)) {
+			fprintf(stderr, "%s:%d - %s isn't a recording\n",
+				__FILE__, __LINE__, path);
+			close(fd);
+
+			return -1;
+		}
+
+		capacity = header.capacity;
+		existing = true;
+	} else {
+		if (0 == capacity)
+			capacity = RECORDER_CAPACITY;
+
+		/* All of it now, so writing a record never allocates. */
+		rc = posix_fallocate(fd, 0, sizeof(struct recorder_header) +
+				     (capacity *
+				      sizeof(struct recorder_record)));
+
+		if (rc) {
+			fprintf(stderr, "%s:%d - posix_fallocate() failed: %s\n",
+				__FILE__, __LINE__, strerror(rc));
+			close(fd);
+
+			return -1;
+		}
+	}
+
+	global.size = sizeof(struct recorder_header) +
+		(capacity * sizeof(struct recorder_record));
+	map = mmap(NULL, global.size, PROT_READ | PROT_WRITE, MAP_SHARED,
+		   fd, 0);
+	close(fd);
+
+	if (MAP_FAILED == map) {
+		fprintf(stderr, "%s:%d - mmap() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return -1;
+	}
+
+	global.header = map;
+	global.records = (struct recorder_record *)(global.header + 1);
+
+	if (existing) {
+		/* The header can lag the records, after a crash. */
+		global.written = 0;
+
+		for (i = 0; i < capacity; ++i)
+			if (global.records[i].sequence > global.written)
+				global.written = global.records[i].sequence;
+	} else {
+		memset(global.header, 0, sizeof(struct recorder_header));
+		memcpy(global.header->magic, RECORDER_MAGIC,
+		       sizeof(global.header->magic));
+		global.header->version = RECORDER_VERSION;
+		global.header->record_size = sizeof(struct recorder_record);
+		global.header->capacity = capacity;
+		global.written = 0;
+	}
+
+	global.header->written = global.written;
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  recorder_close
+*/
+
+void
+recorder_close(void)
+{
+	if (NULL == global.header)
+		return;
+
+	msync(global.header, global.size, MS_SYNC);
+	munmap(global.header, global.size);
+	global.header = NULL;
+	global.records = NULL;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  recorder_write
+*/
+
+void
+recorder_write(struct recorder_record *record)
+{
+	struct recorder_record *slot;
+
+	if (NULL == global.header)
+		return;
+
+	slot = &global.records[global.written % global.header->capacity];
+	record->sequence = ++global.written;
+
+	/* Invalid while it is being written. */
+	slot->sequence = 0;
+	atomic_thread_fence(memory_order_release);
+	memcpy((char *)slot + sizeof(slot->sequence),
+	       (char *)record + sizeof(record->sequence),
+	       sizeof(*record) - sizeof(record->sequence));
+	atomic_thread_fence(memory_order_release);
+	slot->sequence = record->sequence;
+	global.header->written = global.written;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  recorder_load
+*/
+
+int
+recorder_load(const char *path, struct recorder_record **records,
+	      size_t *count)
+{
+	int fd;
+	struct stat status;
+	struct recorder_header header;
+	const struct recorder_record *slots;
+	uint64_t capacity;
+	uint64_t i;
+	void *map;
+	size_t have = 0;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+
+	if (-1 == fd) {
+		fprintf(stderr, "%s:%d - open(%s) failed: %s\n",
+			__FILE__, __LINE__, path, strerror(errno));
+
+		return -1;
+	}
+
+	if (-1 == fstat(fd, &status) ||
+	    sizeof(header) != pread(fd, &header, sizeof(header), 0) ||
+	    0 == (capacity = recorder_check(&header, status.st_size))) {
+		fprintf(stderr, "%s:%d - %s isn't a recording\n",
+			__FILE__, __LINE__, path);
+		close(fd);
+
+		return -1;
+	}
+
+	map = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (MAP_FAILED == map) {
+		fprintf(stderr, "%s:%d - mmap() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return -1;
+	}
+
+	slots = (const struct recorder_record *)
+		((const struct recorder_header *)map + 1);
+	*records = malloc(capacity * sizeof(struct recorder_record));
+
+	if (NULL == *records) {
+		fprintf(stderr, "%s:%d - malloc() failed\n",
+			__FILE__, __LINE__);
+		munmap(map, status.st_size);
+
+		return -1;
+	}
+
+	for (i = 0; i < capacity; ++i)
+		if (0 != slots[i].sequence)
+			(*records)[have++] = slots[i];
+
+	munmap(map, status.st_size);
+	qsort(*records, have, sizeof(struct recorder_record),
+	      recorder_compare);
+	*count = have;
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  recorder.h
+
+  A record of the session, for looking at afterwards.
+
+  Once a second, stats' tick() (on the housekeeping loop, see loop.h)
+  writes a fixed size record (rates, positions, step timing, guiding,
+  temperature, load, fan) to a file mapped into memory.  The file is
+  allocated up front and holds the last 'capacity' records, the oldest
+  being overwritten.  Writing is a copy into the mapping, no system
+  calls, and as the kernel owns the pages a crash of pimount loses
+  nothing.
+
+  A record's sequence number is cleared before the record is written
+  and set last, so a record torn by a crash (or by a power failure,
+  before the kernel has written it back) is skipped when reading.
+
+  See export.c (pimount-export) for getting records out as CSV, or as a
+  file per column.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _RECORDER_H_
+#define _RECORDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define RECORDER_MAGIC "PIMREC1"	/* with the '\0', 8 bytes */
+#define RECORDER_VERSION 1
+
+#define RECORDER_CAPACITY (3 * 24 * 60 * 60)	/* three days at 1 Hz */
+
+/*
+  The file is a header, then 'capacity' records.  Both are in the byte
+  order of the machine that wrote them (so little endian, on a Pi).
+*/
+
+struct recorder_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t record_size;
+	uint64_t capacity;
+	uint64_t written;	/* records written, ever */
+	char reserved[32];
+};
+
+#define RECORDER_UNKNOWN_TEMP INT16_MIN
+#define RECORDER_UNKNOWN_LOAD UINT8_MAX
+#define RECORDER_UNKNOWN_LATE -1
+#define RECORDER_UNKNOWN_FAN UINT32_MAX
+
+struct recorder_record {
+	uint64_t sequence;	/* 1, 2, ..., 0 for none */
+	int64_t time;		/* nano seconds since the epoch */
+	int64_t ra_position;	/* 1/8 steps, see stepper_get_position() */
+	int64_t dec_position;
+	float ra_rate;		/* arc-seconds per second */
+	float dec_rate;
+	float ra_guide;		/* sum of the guiding changes, see pimount.h */
+	float dec_guide;
+	int32_t ra_late;	/* worst step, micro seconds late */
+	int32_t dec_late;
+	int16_t temp;		/* tenths of a degree C */
+	uint8_t load;		/* percent */
+	uint8_t control;	/* enum pimount_control */
+	uint32_t fan;		/* duty, 0...1,000,000 */
+};
+
+/*
+  Open (or create) the file, keeping the records already in it if the
+  format matches.  An existing file keeps its own capacity.
+*/
+
+int recorder_open(const char *path, uint64_t capacity);
+void recorder_close(void);
+
+/* Add a record, setting its sequence number.  Does nothing if closed. */
+
+void recorder_write(struct recorder_record *record);
+
+/*
+  Read all the (complete) records in a file, oldest first, into an
+  array to free().
+*/
+
+int recorder_load(const char *path,
+		  struct recorder_record **records, size_t *count);
+
+#endif	/* _RECORDER_H_ */
@@ -1,5 +1,14 @@
 /*
   server.c
+
+  Serve the control protocol (see server.h) to up to
+  SERVER_MAX_CLIENTS clients at once.  A single thread polls the
+  listening socket and all connections, so a slow client can't keep
+  the others waiting.  The web user interface (http.c) runs from the
+  same loop.
+
+  Clients can also subscribe to the position of the axes, which is
+  then pushed to them (see server.h).
 */
 
 #include <unistd.h>
@@ -9,15 +18,460 @@
 #include <signal.h>
 #include <limits.h>
 #include <pthread.h>
+#include <poll.h>
+#include <fcntl.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <errno.h>
 #include <sys/types.h>
-#include <time.h> 
+#include <time.h>
+#include <math.h>
 
+#include "pimount.h"
+#include "stepper.h"
+#include "pec.h"
+#include "timespec.h"
+#include "stats.h"
+#include "http.h"
 #include "server.h"
 
+/*
+  ==============================================================================
+  ==============================================================================
+  Private
+  ==============================================================================
+  ==============================================================================
+*/
+
+/*
+  Each connection collects bytes until a whole message is available;
+  a read can return part of a message, or several.
+*/
+
+struct connection {
+	int fd;
+	size_t have;
+	struct server_message message;
+	int period;		/* SERVER_SUBSCRIBE, 0 if not subscribed */
+	struct timespec next;	/* CLOCK_MONOTONIC */
+};
+
+static int listenfd = -1;
+static struct connection connections[SERVER_MAX_CLIENTS];
+
+/*
+  ------------------------------------------------------------------------------
+  server_cleanup
+*/
+
+static void
+server_cleanup(__attribute__((unused)) void *input)
+{
+	int i;
+
+	http_finalize();
+
+	for (i = 0; i < SERVER_MAX_CLIENTS; ++i) {
+		if (-1 != connections[i].fd) {
+			close(connections[i].fd);
+			connections[i].fd = -1;
+		}
+	}
+
+	if (-1 != listenfd) {
+		close(listenfd);
+		listenfd = -1;
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  server_send
+
+  Never block the server thread on a client that isn't reading, and
+  don't die (SIGPIPE) on a client that went away.
+*/
+
+static int
+server_send(struct connection *connection, struct server_message *message)
+{
+	ssize_t bytes;
+
+	bytes = send(connection->fd, message, sizeof(*message),
+		     MSG_DONTWAIT | MSG_NOSIGNAL);
+
+	if (sizeof(*message) != bytes) {
+		fprintf(stderr, "%s:%d - send() failed: %s\n",
+			__FILE__, __LINE__,
+			(-1 == bytes) ? strerror(errno) : "short write");
+
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  server_get_position
+*/
+
+static void
+server_get_position(struct server_position *position)
+{
+	enum stepper_axis axis;
+
+	clock_gettime(CLOCK_REALTIME, &position->stamp);
+	lock(&state.mutex);
+	position->control = state.control;
+	unlock(&state.mutex);
+	position->pec = pec_enabled();
+
+	for (axis = STEPPER_AXIS_RA; axis <= STEPPER_AXIS_DEC; ++axis) {
+		struct server_axis *sa;
+		bool running = false;
+
+		sa = &position->axes[axis];
+		memset(sa, 0, sizeof(*sa));
+		stepper_get_status(axis, &running, &sa->rate, NULL);
+		stepper_get_position(axis, &sa->position, &sa->scale);
+		sa->running = running;
+
+		if (!running)
+			sa->rate = 0.0;
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  server_set_control
+*/
+
+static int
+server_set_control(int control)
+{
+	enum pimount_control current;
+
+	lock(&state.mutex);
+	current = state.control;
+	unlock(&state.mutex);
+
+	switch (control) {
+	case PIMOUNT_CONTROL_REMOTE:
+		if (PIMOUNT_CONTROL_LOCAL == current)
+			return -EBUSY;
+
+		if (PIMOUNT_CONTROL_REMOTE != current)
+			c_remote();
+		break;
+	case PIMOUNT_CONTROL_OFF:
+		/* Only give up control if it's ours to give up. */
+		if (PIMOUNT_CONTROL_REMOTE == current)
+			c_stop();
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  server_set_rate
+*/
+
+static int
+server_set_rate(struct server_rate *rate)
+{
+	int rc;
+
+	if ((STEPPER_AXIS_RA != rate->axis && STEPPER_AXIS_DEC != rate->axis) ||
+	    isnan(rate->rate))
+		return -EINVAL;
+
+	if (((STEPPER_AXIS_RA == rate->axis) &&
+	     (MAX_RA_RATE < fabs(rate->rate))) ||
+	    ((STEPPER_AXIS_DEC == rate->axis) &&
+	     (MAX_DEC_RATE < fabs(rate->rate))))
+		return -ERANGE;
+
+	lock(&state.mutex);
+
+	if (PIMOUNT_CONTROL_REMOTE != state.control) {
+		unlock(&state.mutex);
+
+		return -EPERM;
+	}
+
+	rc = stepper_set_rate(rate->axis, rate->rate);
+
+	if (0 == rc) {
+		if (rate->rate != ((STEPPER_AXIS_RA == rate->axis) ?
+				   state.ra_rate : state.dec_rate))
+			stats_notify(STATS_CHANGE_RATE);
+
+		if (STEPPER_AXIS_RA == rate->axis) {
+			if (GUIDE_LIMIT > fabs(rate->rate - state.ra_rate))
+				state.ra_guide += fabs(rate->rate - state.ra_rate);
+
+			state.ra_rate = rate->rate;
+		} else {
+			if (GUIDE_LIMIT > fabs(rate->rate - state.dec_rate))
+				state.dec_guide +=
+					fabs(rate->rate - state.dec_rate);
+
+			state.dec_rate = rate->rate;
+		}
+	}
+
+	unlock(&state.mutex);
+
+	return rc ? -EINVAL : 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  server_handle
+*/
+
+static int
+server_handle(struct connection *connection)
+{
+	struct server_message *message;
+	time_t epoch;
+	struct tm *now;
+
+	message = &connection->message;
+	message->result = 0;
+
+	switch (message->command) {
+	case SERVER_GET_TIME:
+		epoch = time(NULL);
+		now = localtime(&epoch);
+		memcpy(&message->body.time, now, sizeof(struct tm));
+		break;
+	case SERVER_GET_STATUS:
+		message->body.status.temperature = get_temp();
+		message->body.status.load = get_load();
+		break;
+	case SERVER_SET_CONTROL:
+		message->result =
+			server_set_control(message->body.control.control);
+		break;
+	case SERVER_SET_RATE:
+		message->result = server_set_rate(&message->body.rate);
+		break;
+	case SERVER_STOP:
+		lock(&state.mutex);
+		state.ra_rate = 0.0;
+		state.dec_rate = 0.0;
+		stats_notify(STATS_CHANGE_RATE);
+		stepper_stop(STEPPER_AXIS_RA);
+		stepper_stop(STEPPER_AXIS_DEC);
+		unlock(&state.mutex);
+		break;
+	case SERVER_GET_POSITION:
+		server_get_position(&message->body.position);
+		break;
+	case SERVER_SUBSCRIBE:
+		if (0 > message->body.subscribe.period) {
+			message->result = -EINVAL;
+			break;
+		}
+
+		connection->period = message->body.subscribe.period;
+		clock_gettime(CLOCK_MONOTONIC, &connection->next);
+		connection->next = timespec_add(connection->next,
+						timespec_from_ms(connection->period));
+		server_get_position(&message->body.position);
+		break;
+	case SERVER_SET_PEC:
+		message->result = pec_set(&message->body.pec);
+		break;
+	default:
+		fprintf(stderr,
+			"%s:%d - Unknown Command: %d\n",
+			__FILE__, __LINE__, message->command);
+		message->result = -EINVAL;
+		break;
+	}
+
+	return server_send(connection, message);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  server_read
+
+  Returns -1 if the connection should be closed.
+*/
+
+static int
+server_read(struct connection *connection)
+{
+	ssize_t bytes;
+
+	bytes = read(connection->fd,
+		     (char *)&connection->message + connection->have,
+		     sizeof(connection->message) - connection->have);
+
+	/*
+	  If read returns 0, the client closed the connection.
+	*/
+
+	if (0 == bytes)
+		return -1;
+
+	if (-1 == bytes) {
+		if (EINTR == errno || EAGAIN == errno)
+			return 0;
+
+		fprintf(stderr, "%s:%d - read() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return -1;
+	}
+
+	connection->have += bytes;
+
+	if (sizeof(connection->message) > connection->have)
+		return 0;
+
+	connection->have = 0;
+
+	return server_handle(connection);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  server_push
+
+  Send SERVER_POSITION to subscribers that are due, and return how long
+  poll() can wait for the next one (-1 if there are no subscribers).
+*/
+
+static int
+server_push(void)
+{
+	struct timespec now;
+	struct server_message message;
+	ssize_t bytes;
+	int timeout = -1;
+	bool read = false;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	for (i = 0; i < SERVER_MAX_CLIENTS; ++i) {
+		struct connection *connection;
+		long wait;
+
+		connection = &connections[i];
+
+		if (-1 == connection->fd || 0 == connection->period)
+			continue;
+
+		if (!timespec_gt(connection->next, now)) {
+			if (!read) {
+				memset(&message, 0, sizeof(message));
+				message.command = SERVER_POSITION;
+				server_get_position(&message.body.position);
+				read = true;
+			}
+
+			/*
+			  A push that can't be sent at all (EAGAIN) is
+			  dropped -- the next one will be along shortly.
+			  Part of one would leave the stream misframed,
+			  so close the connection.
+			*/
+
+			bytes = send(connection->fd, &message, sizeof(message),
+				     MSG_DONTWAIT | MSG_NOSIGNAL);
+
+			if (sizeof(message) != bytes &&
+			    !(-1 == bytes &&
+			      (EAGAIN == errno || EWOULDBLOCK == errno))) {
+				fprintf(stderr, "%s:%d - send() failed: %s\n",
+					__FILE__, __LINE__,
+					(-1 == bytes) ?
+					strerror(errno) : "short write");
+				close(connection->fd);
+				connection->fd = -1;
+
+				continue;
+			}
+
+			/* Don't try to catch up after a stall. */
+			connection->next =
+				timespec_add(connection->next,
+					     timespec_from_ms(connection->period));
+
+			if (!timespec_gt(connection->next, now))
+				connection->next =
+					timespec_add(now,
+						     timespec_from_ms(connection->period));
+		}
+
+		wait = timespec_to_ms(timespec_sub(connection->next, now)) + 1;
+
+		if (-1 == timeout || wait < timeout)
+			timeout = wait;
+	}
+
+	return timeout;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  server_accept
+*/
+
+static void
+server_accept(void)
+{
+	int fd;
+	int i;
+
+	fd = accept(listenfd, (struct sockaddr*)NULL, NULL);
+
+	if (-1 == fd) {
+		fprintf(stderr, "%s:%d - accept() failed: %s\n",
+			__FILE__, __LINE__, strerror(errno));
+
+		return;
+	}
+
+	for (i = 0; i < SERVER_MAX_CLIENTS; ++i) {
+		if (-1 == connections[i].fd) {
+			connections[i].fd = fd;
+			connections[i].have = 0;
+			connections[i].period = 0;
+
+			return;
+		}
+	}
+
+	fprintf(stderr, "%s:%d - Too Many Clients!\n", __FILE__, __LINE__);
+	close(fd);
+
+	return;
+}
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Public
+  ==============================================================================
+  ==============================================================================
+*/
+
 /*
   ------------------------------------------------------------------------------
   server
@@ -27,19 +481,18 @@ void *
 server(void *input)
 {
 	struct server_input *parameters;
-	int listenfd = 0;
-	int connfd = 0;
-	struct sockaddr_in serv_addr; 
-	char sendBuff[1025];
-	struct server_message message;
-	time_t epoch;
-	struct tm *now;
+	struct sockaddr_in serv_addr;
 	pthread_t this;
 	struct sched_param params;
 	socklen_t addr_len;
+	int on = 1;
+	int i;
 
 	parameters = (struct server_input *)input;
 
+	for (i = 0; i < SERVER_MAX_CLIENTS; ++i)
+		connections[i].fd = -1;
+
 	listenfd = socket(AF_INET, SOCK_STREAM, 0);
 
 	if (-1 == listenfd) {
@@ -47,8 +500,13 @@ server(void *input)
 		pthread_exit(NULL);
 	}
 
-	memset(&serv_addr, '0', sizeof(serv_addr));
-	memset(sendBuff, '0', sizeof(sendBuff));
+	pthread_cleanup_push(server_cleanup, NULL);
+
+	if (-1 == setsockopt(listenfd,
+			     SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)))
+		fprintf(stderr, "setsockopt() failed: %s\n", strerror(errno));
+
+	memset(&serv_addr, 0, sizeof(serv_addr));
 
 	serv_addr.sin_family = AF_INET;
 	serv_addr.sin_addr.s_addr = INADDR_ANY; /* All interfaces... */
@@ -76,6 +534,9 @@ server(void *input)
 		pthread_exit(NULL);
 	}
 
+	if (http_initialize(parameters->http_port))
+		fprintf(stderr, "http_initialize() failed!\n");
+
 	/* Run at a High Priority -- Higher than the Server Thread */
 	this = pthread_self();
 	params.sched_priority = 50;
@@ -84,46 +545,67 @@ server(void *input)
 		fprintf(stderr, "pthread_setschedparam() failed!\n");
 
 	for (;;) {
-		int bytes_read;
+		struct pollfd fds[SERVER_MAX_CLIENTS + 1 + HTTP_MAX_CLIENTS + 1];
+		int map[SERVER_MAX_CLIENTS + 1];
+		int nfds = 0;
+		int nhttp;
+		int timeout;
+		int rc;
+
+		/* Before the fds, as a failed push closes its connection. */
+		timeout = server_push();
 
-		connfd = accept(listenfd, (struct sockaddr*)NULL, NULL);
+		fds[nfds].fd = listenfd;
+		fds[nfds].events = POLLIN;
+		map[nfds++] = -1;
 
-		if (-1 == connfd) {
-			fprintf(stderr, "listen() failed: %s\n", strerror(errno));
+		for (i = 0; i < SERVER_MAX_CLIENTS; ++i) {
+			if (-1 == connections[i].fd)
+				continue;
+
+			fds[nfds].fd = connections[i].fd;
+			fds[nfds].events = POLLIN;
+			map[nfds++] = i;
+		}
+
+		nhttp = http_fds(&fds[nfds], HTTP_MAX_CLIENTS + 1);
+
+		/* poll() is a cancellation point. */
+		if (-1 == timeout ||
+		    (-1 != http_timeout() && http_timeout() < timeout))
+			timeout = http_timeout();
+
+		rc = poll(fds, nfds + nhttp, timeout);
+
+		if (-1 == rc) {
+			if (EINTR == errno)
+				continue;
+
+			fprintf(stderr, "%s:%d - poll() failed: %s\n",
+				__FILE__, __LINE__, strerror(errno));
 			pthread_exit(NULL);
 		}
 
-		for (;;) {
-			pthread_testcancel();
-			bytes_read = read(connfd, &message, sizeof(message));
+		for (i = 1; i < nfds; ++i) {
+			struct connection *connection;
 
-			/*
-			 * If read returns 0, the client closed the
-			 * connection, so break and wait for another
-			 * connection.
-			 */
-
-			if (0 == bytes_read)
-				break;
-
-			switch (message.command) {
-			case SERVER_GET_TIME:
-				epoch = time(NULL);
-				now = localtime(&epoch);
-				memcpy(&message.body.time, now,
-				       sizeof(struct tm));
-				write(connfd, &message, sizeof(message));
-				break;
-			default:
-				fprintf(stderr,
-					"%s:%d - Unknown Command: %d\n",
-					__FILE__, __LINE__, message.command);
-				break;
+			if (0 == fds[i].revents)
+				continue;
+
+			connection = &connections[map[i]];
+
+			if (server_read(connection)) {
+				close(connection->fd);
+				connection->fd = -1;
 			}
 		}
 
-		close(connfd);
+		if (fds[0].revents & POLLIN)
+			server_accept();
+
+		http_process(&fds[nfds], nhttp);
 	}
 
+	pthread_cleanup_pop(1);
 	pthread_exit(NULL);
 }
@@ -17,15 +17,56 @@
 #include <arpa/inet.h>
 #include <errno.h>
 #include <sys/types.h>
-#include <time.h> 
+#include <time.h>
+
+#include "pec.h"
+
+/*
+  The port the server listens on unless told otherwise.  Clients (the
+  INDI driver, tests/client etc.) use the same default.
+*/
+
+#define SERVER_DEFAULT_PORT 7634
+
+/*
+  Number of clients that can be connected at the same time.
+*/
+
+#define SERVER_MAX_CLIENTS 8
 
 struct server_input {
 	unsigned short port;
+	unsigned short http_port;	/* 0 to disable, see http.h */
 };
 
+/*
+  SERVER_SET_CONTROL takes 'control' (an enum pimount_control).
+  Remote control can't be taken while the game controller has it
+  (-EBUSY).
+
+  SERVER_SET_RATE changes the rate of one axis, starting or stopping
+  it as needed.  Only allowed under remote control (-EPERM).
+
+  SERVER_STOP stops both axes, but leaves control alone.
+
+  SERVER_SUBSCRIBE asks for SERVER_POSITION messages (with sequence 0)
+  every 'period' ms on this connection, 0 to stop.  The reply is the
+  current position.
+
+  SERVER_SET_PEC replaces the periodic error correction (see pec.h).
+  It applies whoever has control, so it is allowed at any time.
+*/
+
 enum server_command {
 	SERVER_GET_TIME,
-	SERVER_GET_STATUS
+	SERVER_GET_STATUS,
+	SERVER_SET_CONTROL,
+	SERVER_SET_RATE,
+	SERVER_STOP,
+	SERVER_GET_POSITION,
+	SERVER_SUBSCRIBE,
+	SERVER_POSITION,
+	SERVER_SET_PEC
 };
 
 struct server_time {
@@ -34,15 +75,71 @@ struct server_time {
 
 struct server_status {
 	int temperature;
+	long load;
+};
+
+struct server_control {
+	int control;
+};
+
+/*
+  axis is an enum stepper_axis, rate is in arcseconds per second.
+*/
+
+struct server_rate {
+	int axis;
+	double rate;
+};
+
+struct server_subscribe {
+	int period;		/* in ms, 0 to unsubscribe */
+};
+
+/*
+  position counts 1/8 steps (see stepper_get_position()), scale
+  converts them to arcseconds.  stamp (CLOCK_REALTIME) is when the
+  positions were read.  pec is set while periodic error correction is
+  enabled.
+*/
+
+struct server_axis {
+	int running;
+	double rate;
+	long long position;
+	double scale;
+};
+
+struct server_position {
+	struct timespec stamp;
+	int control;
+	int pec;
+	struct server_axis axes[2];
 };
 
 union server_message_body {
 	struct server_time time;
 	struct server_status status;
+	struct server_control control;
+	struct server_rate rate;
+	struct server_subscribe subscribe;
+	struct server_position position;
+	struct pec pec;
 };
 
+/*
+  Every request gets exactly one reply, in order.  'sequence' is set
+  by the client and copied to the reply by the server, so a client can
+  have several requests in flight on one connection (pipelining).
+  Sequence 0 is reserved for messages the server sends on its own.
+
+  'result' is 0 in a reply if the request succeeded, and a negative
+  errno value if it did not.
+*/
+
 struct server_message {
 	enum server_command command;
+	unsigned int sequence;
+	int result;
 	union server_message_body body;
 };
 
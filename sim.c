@@ -0,0 +1,864 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  sim.c
+
+  pimount-sim: pimount without the hardware, for testing clients (the
+  INDI driver in particular) on any Linux machine.
+
+  It speaks the same control protocol (see server.h) on the same
+  port, and moves each axis the way the stepper threads do: the same
+  resolution and delays for a rate (see steps.h), the same handling of
+  a rate change (the next step is one new delay after the last one)
+  and the same periodic error correction (see pec.h).  Rate changes
+  are instant, as they are in stepper.c.
+
+  Time is virtual, running at 'speed' times real time.  Positions are
+  worked out from the step times on demand, so nothing has to run in
+  real time.  The stamps on positions are virtual too, so use a speed
+  of 1 (the default) with the INDI driver.
+
+  The report (every --report seconds, and on exit) covers
+
+    - moves: from the first rate away from tracking until tracking
+      again (for SIM_SETTLE seconds), which is how long a goto took.
+    - latency: from a rate change to the first step at the new rate,
+      which is how long a guide pulse takes to start moving the axis.
+    - error: how far the steps are from where the requested rates
+      (and PEC) would put the axis.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <signal.h>
+#include <poll.h>
+#include <math.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "pimount.h"
+#include "pec.h"
+#include "steps.h"
+#include "server.h"
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Private Stuff
+  ==============================================================================
+  ==============================================================================
+*/
+
+#define SIDEREAL 15.041067
+
+/* Away from tracking by more than this (as/s) is a move. */
+#define SIM_MOVE 8.0
+
+/* Back to tracking for this long (s) ends a move. */
+#define SIM_SETTLE 2.0
+
+struct sim_axis {
+	enum stepper_axis axis;
+	bool running;
+	double rate;		/* as requested */
+	struct steps steps;
+	long long position;	/* in 1/8 steps */
+	double ideal;		/* where the rates would put it, 1/8 steps */
+	double at;		/* the time position and ideal are for */
+	double last;		/* time of the last step */
+	double next;		/* time of the next step */
+	double extra;		/* fractions of a us added up, see stepper.c */
+
+	/* For the report. */
+	double changed;		/* when the rate changed */
+	bool waiting;		/* for the first step at the new rate */
+	long changes;
+	double latency_sum;
+	double latency_max;
+	long samples;
+	double error_sum2;
+	double error_max;
+};
+
+struct sim_connection {
+	int fd;
+	size_t have;
+	struct server_message message;
+	int period;		/* SERVER_SUBSCRIBE, 0 if not subscribed */
+	double next;		/* virtual time of the next push */
+};
+
+static double speed = 1.0;
+static struct timespec start_monotonic;
+static struct timespec start_realtime;
+static enum pimount_control control = PIMOUNT_CONTROL_OFF;
+static bool local;
+static struct sim_axis axes[2];
+static struct sim_connection connections[SERVER_MAX_CLIENTS];
+static volatile sig_atomic_t done;
+
+static bool moving;
+static double move_start;
+static double settle_start = -1.0;
+static long moves;
+static double move_sum;
+static double move_max;
+static double move_last;
+
+/*
+  ------------------------------------------------------------------------------
+  sim_now
+
+  Virtual seconds since the start.
+*/
+
+static double
+sim_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((now.tv_sec - start_monotonic.tv_sec) +
+		(now.tv_nsec - start_monotonic.tv_nsec) / 1e9) * speed;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_stamp
+
+  The (virtual) CLOCK_REALTIME at virtual time t.
+*/
+
+static struct timespec
+sim_stamp(double t)
+{
+	struct timespec stamp;
+	double whole;
+	double fraction;
+
+	fraction = modf(t, &whole);
+	stamp.tv_sec = start_realtime.tv_sec + (time_t)whole;
+	stamp.tv_nsec = start_realtime.tv_nsec + (long)(fraction * 1e9);
+
+	if (1000000000L <= stamp.tv_nsec) {
+		++stamp.tv_sec;
+		stamp.tv_nsec -= 1000000000L;
+	}
+
+	return stamp;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_rate
+
+  The rate the axis is really moving at: the requested rate, plus PEC
+  on RA while tracking -- the same conditions the stepper thread uses.
+*/
+
+static double
+sim_rate(struct sim_axis *sa)
+{
+	if (!sa->running)
+		return 0.0;
+
+	if (STEPPER_AXIS_RA == sa->axis && pec_tracking(sa->rate))
+		return sa->rate + pec_rate(sa->position);
+
+	return sa->rate;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_interval
+
+  Seconds from one step to the next.
+*/
+
+static double
+sim_interval(struct sim_axis *sa)
+{
+	struct steps steps;
+	double us;
+
+	steps = sa->steps;
+
+	if (STEPPER_AXIS_RA == sa->axis && pec_tracking(sa->rate)) {
+		struct steps corrected;
+
+		if (0 == steps_from_rate(sa->axis, sim_rate(sa), &corrected) &&
+		    corrected.resolution == steps.resolution &&
+		    corrected.direction == steps.direction)
+			steps = corrected;
+	}
+
+	us = steps.width + steps.delay;
+	sa->extra += steps.fraction;
+
+	if (1.0 <= sa->extra) {
+		sa->extra -= 1.0;
+		us += 1.0;
+	}
+
+	return us / 1e6;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_advance
+
+  Take the steps due up to t.
+*/
+
+static void
+sim_advance(struct sim_axis *sa, double t)
+{
+	double scale;
+	double error;
+
+	scale = steps_scale(sa->axis);
+
+	while (sa->running && sa->next <= t) {
+		sa->ideal += sim_rate(sa) * (sa->next - sa->at) / scale;
+		sa->at = sa->next;
+		sa->position += (8 >> sa->steps.resolution) *
+			((A4988_DIR_CW == sa->steps.direction) ? 1 : -1);
+		sa->last = sa->next;
+
+		if (sa->waiting) {
+			double latency;
+
+			latency = sa->next - sa->changed;
+			sa->latency_sum += latency;
+
+			if (latency > sa->latency_max)
+				sa->latency_max = latency;
+
+			++sa->changes;
+			sa->waiting = false;
+		}
+
+		sa->next += sim_interval(sa);
+	}
+
+	if (t > sa->at) {
+		sa->ideal += sim_rate(sa) * (t - sa->at) / scale;
+		sa->at = t;
+	}
+
+	error = (sa->position - sa->ideal) * scale;
+	sa->error_sum2 += error * error;
+	++sa->samples;
+
+	if (fabs(error) > sa->error_max)
+		sa->error_max = fabs(error);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_check_move
+
+  A move starts when either axis leaves tracking, and ends once both
+  have been back at tracking (or stopped) for SIM_SETTLE seconds.
+*/
+
+static void
+sim_check_move(double t)
+{
+	bool fast;
+
+	fast = (axes[STEPPER_AXIS_RA].running &&
+		SIM_MOVE < fabs(axes[STEPPER_AXIS_RA].rate - SIDEREAL)) ||
+		(axes[STEPPER_AXIS_DEC].running &&
+		 SIM_MOVE < fabs(axes[STEPPER_AXIS_DEC].rate));
+
+	if (fast) {
+		if (!moving) {
+			moving = true;
+			move_start = t;
+		}
+
+		settle_start = -1.0;
+
+		return;
+	}
+
+	if (!moving)
+		return;
+
+	if (0.0 > settle_start)
+		settle_start = t;
+
+	if (SIM_SETTLE > t - settle_start)
+		return;
+
+	moving = false;
+	move_last = settle_start - move_start;
+	move_sum += move_last;
+	++moves;
+
+	if (move_last > move_max)
+		move_max = move_last;
+
+	printf("%10.3f Move done in %.3f s\n", t, move_last);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_set_rate
+*/
+
+static int
+sim_set_rate(enum stepper_axis axis, double rate)
+{
+	struct sim_axis *sa;
+	double t;
+
+	sa = &axes[axis];
+	t = sim_now();
+	sim_advance(sa, t);
+
+	if (fabs(rate) < RATE_RESOLUTION) {
+		sa->running = false;
+		sa->rate = 0.0;
+		sa->waiting = false;
+		sim_check_move(t);
+
+		return 0;
+	}
+
+	if (steps_from_rate(axis, rate, &sa->steps))
+		return -EINVAL;
+
+	sa->rate = rate;
+	sa->changed = t;
+	sa->waiting = true;
+
+	/* Like the stepper thread: step now, or one delay after the last. */
+	if (!sa->running) {
+		sa->running = true;
+		sa->next = t;
+	} else {
+		sa->next = sa->last + sim_interval(sa);
+
+		if (sa->next < t)
+			sa->next = t;
+	}
+
+	sim_check_move(t);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_report
+*/
+
+static void
+sim_report(void)
+{
+	double t;
+	int i;
+
+	t = sim_now();
+	printf("%10.3f Report\n", t);
+	printf("\tMoves: %ld, mean %.3f s, max %.3f s, last %.3f s\n",
+	       moves, moves ? move_sum / moves : 0.0, move_max, move_last);
+
+	for (i = STEPPER_AXIS_RA; i <= STEPPER_AXIS_DEC; ++i) {
+		struct sim_axis *sa;
+
+		sa = &axes[i];
+		sim_advance(sa, t);
+		printf("\t%s: position %lld, rate %.3f as/s, "
+		       "latency mean %.1f ms max %.1f ms (%ld changes), "
+		       "error rms %.3f as max %.3f as\n",
+		       (STEPPER_AXIS_RA == i) ? "RA" : "DEC",
+		       sa->position, sim_rate(sa),
+		       sa->changes ? 1e3 * sa->latency_sum / sa->changes : 0.0,
+		       1e3 * sa->latency_max, sa->changes,
+		       sa->samples ? sqrt(sa->error_sum2 / sa->samples) : 0.0,
+		       sa->error_max);
+	}
+
+	fflush(stdout);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_get_position
+*/
+
+static void
+sim_get_position(struct server_position *position)
+{
+	double t;
+	int i;
+
+	t = sim_now();
+	position->stamp = sim_stamp(t);
+	position->control = control;
+	position->pec = pec_enabled();
+
+	for (i = STEPPER_AXIS_RA; i <= STEPPER_AXIS_DEC; ++i) {
+		struct sim_axis *sa;
+		struct server_axis *axis;
+
+		sa = &axes[i];
+		axis = &position->axes[i];
+		sim_advance(sa, t);
+		memset(axis, 0, sizeof(*axis));
+		axis->running = sa->running;
+		axis->rate = sa->running ? sa->rate : 0.0;
+		axis->position = sa->position;
+		axis->scale = steps_scale(i);
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_handle
+
+  The same checks and results as server_handle() in server.c.
+*/
+
+static int
+sim_handle(struct sim_connection *connection)
+{
+	struct server_message *message;
+	struct server_rate *rate;
+	time_t epoch;
+
+	message = &connection->message;
+	message->result = 0;
+
+	switch (message->command) {
+	case SERVER_GET_TIME:
+		epoch = sim_stamp(sim_now()).tv_sec;
+		localtime_r(&epoch, &message->body.time.time);
+		break;
+	case SERVER_GET_STATUS:
+		message->body.status.temperature = 40;
+		message->body.status.load = 0;
+		break;
+	case SERVER_SET_CONTROL:
+		if (PIMOUNT_CONTROL_REMOTE == message->body.control.control) {
+			if (local)
+				message->result = -EBUSY;
+			else if (PIMOUNT_CONTROL_REMOTE != control) {
+				sim_set_rate(STEPPER_AXIS_RA, 0.0);
+				sim_set_rate(STEPPER_AXIS_DEC, 0.0);
+				control = PIMOUNT_CONTROL_REMOTE;
+			}
+		} else if (PIMOUNT_CONTROL_OFF ==
+			   message->body.control.control) {
+			if (PIMOUNT_CONTROL_REMOTE == control) {
+				sim_set_rate(STEPPER_AXIS_RA, 0.0);
+				sim_set_rate(STEPPER_AXIS_DEC, 0.0);
+				control = PIMOUNT_CONTROL_OFF;
+			}
+		} else {
+			message->result = -EINVAL;
+		}
+		break;
+	case SERVER_SET_RATE:
+		rate = &message->body.rate;
+
+		if ((STEPPER_AXIS_RA != rate->axis &&
+		     STEPPER_AXIS_DEC != rate->axis) || isnan(rate->rate))
+			message->result = -EINVAL;
+		else if (((STEPPER_AXIS_RA == rate->axis) &&
+			  (MAX_RA_RATE < fabs(rate->rate))) ||
+			 ((STEPPER_AXIS_DEC == rate->axis) &&
+			  (MAX_DEC_RATE < fabs(rate->rate))))
+			message->result = -ERANGE;
+		else if (PIMOUNT_CONTROL_REMOTE != control)
+			message->result = -EPERM;
+		else
+			message->result = sim_set_rate(rate->axis, rate->rate);
+		break;
+	case SERVER_STOP:
+		sim_set_rate(STEPPER_AXIS_RA, 0.0);
+		sim_set_rate(STEPPER_AXIS_DEC, 0.0);
+		break;
+	case SERVER_GET_POSITION:
+		sim_get_position(&message->body.position);
+		break;
+	case SERVER_SUBSCRIBE:
+		if (0 > message->body.subscribe.period) {
+			message->result = -EINVAL;
+			break;
+		}
+
+		connection->period = message->body.subscribe.period;
+		connection->next = sim_now() + connection->period / 1e3;
+		sim_get_position(&message->body.position);
+		break;
+	case SERVER_SET_PEC:
+		sim_advance(&axes[STEPPER_AXIS_RA], sim_now());
+		message->result = pec_set(&message->body.pec);
+		break;
+	default:
+		fprintf(stderr, "%s:%d - Unknown Command: %d\n",
+			__FILE__, __LINE__, message->command);
+		message->result = -EINVAL;
+		break;
+	}
+
+	if (sizeof(*message) != send(connection->fd, message, sizeof(*message),
+				     MSG_DONTWAIT | MSG_NOSIGNAL))
+		return -1;
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_read
+
+  Returns -1 if the connection should be closed.
+*/
+
+static int
+sim_read(struct sim_connection *connection)
+{
+	ssize_t bytes;
+
+	bytes = read(connection->fd,
+		     (char *)&connection->message + connection->have,
+		     sizeof(connection->message) - connection->have);
+
+	if (0 == bytes)
+		return -1;
+
+	if (-1 == bytes)
+		return (EINTR == errno || EAGAIN == errno) ? 0 : -1;
+
+	connection->have += bytes;
+
+	if (sizeof(connection->message) > connection->have)
+		return 0;
+
+	connection->have = 0;
+
+	return sim_handle(connection);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sim_push
+
+  Send SERVER_POSITION to subscribers that are due, and return how
+  long poll() can wait (in real ms) for the next one, or -1.
+*/
+
+static int
+sim_push(void)
+{
+	struct server_message message;
+	ssize_t bytes;
+	bool read = false;
+	int timeout = -1;
+	double t;
+	int i;
+
+	t = sim_now();
+
+	for (i = 0; i < SERVER_MAX_CLIENTS; ++i) {
+		struct sim_connection *connection;
+		int wait;
+
+		connection = &connections[i];
+
+		if (-1 == connection->fd || 0 == connection->period)
+			continue;
+
+		if (connection->next <= t) {
+			if (!read) {
+				memset(&message, 0, sizeof(message));
+				message.command = SERVER_POSITION;
+				sim_get_position(&message.body.position);
+				read = true;
+			}
+
+			/* As server.c, part of a push misframes the rest. */
+			bytes = send(connection->fd, &message, sizeof(message),
+				     MSG_DONTWAIT | MSG_NOSIGNAL);
+
+			if (sizeof(message) != bytes &&
+			    !(-1 == bytes &&
+			      (EAGAIN == errno || EWOULDBLOCK == errno))) {
+				close(connection->fd);
+				connection->fd = -1;
+
+				continue;
+			}
+
+			/* Don't try to catch up after a stall. */
+			connection->next += connection->period / 1e3;
+
+			if (connection->next <= t)
+				connection->next = t + connection->period / 1e3;
+		}
+
+		wait = (int)((connection->next - t) * 1e3 / speed) + 1;
+
+		if (-1 == timeout || wait < timeout)
+			timeout = wait;
+	}
+
+	return timeout;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  handler
+*/
+
+static void
+handler(__attribute__((unused)) int signal)
+{
+	done = 1;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  usage
+*/
+
+static void
+usage(int exit_code)
+{
+	printf("Usage: pimount-sim\n"
+	       "\t--help|-h    Display this wonderful help text...\n"
+	       "\t--port|-p    Control port (default %d)\n"
+	       "\t--speed|-s   Virtual time per real second (default 1)\n"
+	       "\t--report|-r  Report every this many virtual seconds, "
+	       "0 for only on exit (default 60)\n"
+	       "\t--local|-l   Act as if the game controller has control\n",
+	       SERVER_DEFAULT_PORT);
+
+	exit(exit_code);
+}
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Public Stuff
+  ==============================================================================
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  main
+*/
+
+int
+main(int argc, char *argv[])
+{
+	int opt = 0;
+	int long_index = 0;
+	unsigned short port = SERVER_DEFAULT_PORT;
+	double report = 60.0;
+	double next_report;
+	struct sockaddr_in serv_addr;
+	int listenfd;
+	int on = 1;
+	int i;
+
+	static struct option long_options[] = {
+		{"help",   no_argument,       0,  'h' },
+		{"port",   required_argument, 0,  'p' },
+		{"speed",  required_argument, 0,  's' },
+		{"report", required_argument, 0,  'r' },
+		{"local",  no_argument,       0,  'l' },
+		{0, 0, 0, 0}
+	};
+
+	while ((opt = getopt_long(argc, argv, "hp:s:r:l",
+				  long_options, &long_index )) != -1) {
+		switch (opt) {
+		case 'h':
+			usage(EXIT_SUCCESS);
+			break;
+		case 'p':
+			port = (unsigned short)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			speed = strtod(optarg, NULL);
+			break;
+		case 'r':
+			report = strtod(optarg, NULL);
+			break;
+		case 'l':
+			local = true;
+			break;
+		default:
+			usage(EXIT_FAILURE);
+			break;
+		}
+	}
+
+	if (!(0.0 < speed))
+		usage(EXIT_FAILURE);
+
+	clock_gettime(CLOCK_MONOTONIC, &start_monotonic);
+	clock_gettime(CLOCK_REALTIME, &start_realtime);
+
+	for (i = STEPPER_AXIS_RA; i <= STEPPER_AXIS_DEC; ++i)
+		axes[i].axis = i;
+
+	for (i = 0; i < SERVER_MAX_CLIENTS; ++i)
+		connections[i].fd = -1;
+
+	signal(SIGINT, handler);
+	signal(SIGTERM, handler);
+
+	listenfd = socket(AF_INET, SOCK_STREAM, 0);
+
+	if (-1 == listenfd) {
+		fprintf(stderr, "socket() failed: %s\n", strerror(errno));
+
+		return EXIT_FAILURE;
+	}
+
+	if (-1 == setsockopt(listenfd,
+			     SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)))
+		fprintf(stderr, "setsockopt() failed: %s\n", strerror(errno));
+
+	memset(&serv_addr, 0, sizeof(serv_addr));
+	serv_addr.sin_family = AF_INET;
+	serv_addr.sin_addr.s_addr = INADDR_ANY;
+	serv_addr.sin_port = htons(port);
+
+	if (-1 == bind(listenfd,
+		       (struct sockaddr*)&serv_addr, sizeof(serv_addr)) ||
+	    -1 == listen(listenfd, 10)) {
+		fprintf(stderr, "bind()/listen() failed: %s\n",
+			strerror(errno));
+
+		return EXIT_FAILURE;
+	}
+
+	printf("Simulating on port %d at %gx\n", port, speed);
+	fflush(stdout);
+	next_report = report;
+
+	while (!done) {
+		struct pollfd fds[SERVER_MAX_CLIENTS + 1];
+		int map[SERVER_MAX_CLIENTS + 1];
+		int nfds = 0;
+		int timeout;
+		double t;
+
+		/*
+		  Wake up for pushes, moves settling and reports.  Push
+		  before the fds, as a failed push closes its connection.
+		*/
+		timeout = sim_push();
+
+		fds[nfds].fd = listenfd;
+		fds[nfds].events = POLLIN;
+		map[nfds++] = -1;
+
+		for (i = 0; i < SERVER_MAX_CLIENTS; ++i) {
+			if (-1 == connections[i].fd)
+				continue;
+
+			fds[nfds].fd = connections[i].fd;
+			fds[nfds].events = POLLIN;
+			map[nfds++] = i;
+		}
+
+		if (moving && (-1 == timeout || 100 < timeout))
+			timeout = 100;
+
+		if (0.0 < report) {
+			int wait;
+
+			wait = (int)((next_report - sim_now()) * 1e3 / speed) + 1;
+
+			if (-1 == timeout || wait < timeout)
+				timeout = (0 < wait) ? wait : 0;
+		}
+
+		if (-1 == poll(fds, nfds, timeout)) {
+			if (EINTR == errno)
+				continue;
+
+			fprintf(stderr, "%s:%d - poll() failed: %s\n",
+				__FILE__, __LINE__, strerror(errno));
+			break;
+		}
+
+		if (fds[0].revents & POLLIN) {
+			int fd;
+
+			fd = accept(listenfd, NULL, NULL);
+
+			for (i = 0; -1 != fd && i < SERVER_MAX_CLIENTS; ++i) {
+				if (-1 == connections[i].fd) {
+					connections[i].fd = fd;
+					connections[i].have = 0;
+					connections[i].period = 0;
+					fd = -1;
+				}
+			}
+
+			if (-1 != fd)
+				close(fd);
+		}
+
+		for (i = 1; i < nfds; ++i) {
+			struct sim_connection *connection;
+
+			if (0 == fds[i].revents)
+				continue;
+
+			connection = &connections[map[i]];
+
+			if (sim_read(connection)) {
+				close(connection->fd);
+				connection->fd = -1;
+			}
+		}
+
+		t = sim_now();
+		sim_check_move(t);
+
+		if (0.0 < report && next_report <= t) {
+			sim_report();
+			next_report = t + report;
+		}
+	}
+
+	sim_report();
+
+	for (i = 0; i < SERVER_MAX_CLIENTS; ++i)
+		if (-1 != connections[i].fd)
+			close(connections[i].fd);
+
+	close(listenfd);
+
+	return EXIT_SUCCESS;
+}
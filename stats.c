@@ -11,6 +11,7 @@
 #include <stdbool.h>
 #include <string.h>
 #include <errno.h>
+#include <math.h>
 #include <pthread.h>
 
 #include <pigpio.h>
@@ -18,6 +19,14 @@
 #include "pimount.h"
 #include "stats.h"
 #include "oled.h"
+#include "widget.h"
+#include "stepper.h"
+#include "timespec.h"
+#include "telemetry.h"
+#include "recorder.h"
+#include "fan.h"
+#include "loop.h"
+#include "power.h"
 
 /*
   ==============================================================================
@@ -32,72 +41,129 @@ char *cmdErrStr(int); /* For some reason, pigpio doesn't export this! */
 static int i2c_handle = -1;
 static bool oled_enabled = false;
 
-static pthread_t pstat_thread;
-
 struct stats {
 	pthread_mutex_t mutex;
-	bool available;
-	long load;
+	int refresh_timer;	/* -1 before stats_initialize() */
+	unsigned changes;	/* STATS_CHANGE_*, not yet shown */
 };
 
 static struct stats global = {
 	.mutex = PTHREAD_MUTEX_INITIALIZER,
-	.available = false,
+	.refresh_timer = -1,
+	.changes = 0,
+};
+
+/*
+  The display is redrawn when something on it changes, but no more
+  often than every REFRESH seconds.  With no control or rate changes
+  for DIM_AFTER seconds it is dimmed, and if parked as well for
+  BLANK_AFTER seconds it is turned off; nothing is sent until the next
+  change wakes it up.
+*/
+
+#define REFRESH 0.25
+#define DIM_AFTER 60.0
+#define BLANK_AFTER 300.0
+
+#define CONTRAST_BRIGHT ((char)0xff)	/* as set by oled_initialize() */
+#define CONTRAST_DIM 0x10
+
+enum display {
+	DISPLAY_BRIGHT,
+	DISPLAY_DIM,
+	DISPLAY_BLANK
 };
 
+static enum display display = DISPLAY_BRIGHT;
+static struct timespec active;	/* the last control or rate change */
+static struct timespec next_refresh;
+static bool pending = false;	/* drawn, but not sent yet */
+
+/* Late by up to this much, to share a wakeup with something else. */
+
+#define SLACK_SECOND 0.05
+#define SLACK_REFRESH 0.05
+
+/*
+  Histories, one sample a second, under the line each goes with:
+
+    PiMount    step timing (worst, 0...500 us late)
+    T/L        temperature (30...80 C) | load (0...100%)
+    R/A        RA guiding (0...30 arc-seconds per second of changes)
+    DEC        DEC guiding
+*/
+
+static struct widget late_history;
+static struct widget temp_history;
+static struct widget load_history;
+static struct widget ra_guide_history;
+static struct widget dec_guide_history;
+
 /*
   ------------------------------------------------------------------------------
-  update_oled
+  open_oled
 */
 
 static void
-update_oled(void)
+open_oled(void)
 {
-	static bool first_run = true;
 	int rc;
-	int temp;
-	long load;
-	struct pimount_state state_copy;
-	char buffer[80];
-	int flen;
 
-	if (!first_run && !oled_enabled)
-		return;
+	i2c_handle = i2cOpen(1, OLED_ADDRESS, 0);
 
-	if (first_run) {
-		first_run = false;
+	if (0 > i2c_handle) {
+		fprintf(stderr, "i2cOpen() failed: %s\n", cmdErrStr(i2c_handle));
 
-		i2c_handle = i2cOpen(1, 0x3c, 0);
+		return;
+	}
 
-		if (0 > i2c_handle) {
-			fprintf(stderr, "i2cOpen() failed: %s\n",
-				cmdErrStr(i2c_handle));
+	rc = oled_initialize(i2c_handle, false, false);
 
-			return;
-		} else {
-			oled_enabled = true;
-		}
+	if (rc) {
+		fprintf(stderr, "oled_initialize() failed: %d\n", rc);
 
-		rc = oled_initialize(i2c_handle, false, false);
+		return;
+	}
 
-		if (rc) {
-			fprintf(stderr, "oled_initialize() failed: %d\n", rc);
-			oled_enabled = false;
+	oled_enabled = true;
+
+	oled_clear(i2c_handle);
+	oled_print(i2c_handle, 0, 0, OLED_FONT_MEDIUM, "PiMount");
+	oled_print(i2c_handle, 0, 2, OLED_FONT_MEDIUM, "T/L");
+	oled_print(i2c_handle, 0, 4, OLED_FONT_MEDIUM, "R/A");
+	oled_print(i2c_handle, 0, 6, OLED_FONT_MEDIUM, "DEC");
+
+	widget_initialize(&late_history, WIDGET_BARS,
+			  0, 127, 1, 1, 0.0, 500.0);
+	widget_initialize(&temp_history, WIDGET_SPARKLINE,
+			  0, 61, 3, 3, 30.0, 80.0);
+	widget_initialize(&load_history, WIDGET_BARS,
+			  66, 127, 3, 3, 0.0, 100.0);
+	widget_initialize(&ra_guide_history, WIDGET_BARS,
+			  0, 127, 5, 5, 0.0, 30.0);
+	widget_initialize(&dec_guide_history, WIDGET_BARS,
+			  0, 127, 7, 7, 0.0, 30.0);
+
+	/* Without the writer, update the display from here. */
+	if (oled_start(i2c_handle))
+		fprintf(stderr, "oled_start() failed\n");
 
-			return;
-		}
+	return;
+}
 
-		oled_clear(i2c_handle);
-		oled_print(i2c_handle, 0, 0, OLED_FONT_MEDIUM, "PiMount");
-		oled_print(i2c_handle, 0, 2, OLED_FONT_MEDIUM, "T/L");
-		oled_print(i2c_handle, 0, 4, OLED_FONT_MEDIUM, "R/A");
-		oled_print(i2c_handle, 0, 6, OLED_FONT_MEDIUM, "DEC");
-	}
+/*
+  ------------------------------------------------------------------------------
+  draw_state
 
-	if (!oled_enabled)
-		return;
+  Control and the rates.
+*/
 
-	/* Update State */
+static void
+draw_state(void)
+{
+	struct pimount_state state_copy;
+	char buffer[80];
+	int flen;
 
 	lock(&state.mutex);
 	state_copy.control = state.control;
@@ -137,6 +203,117 @@ update_oled(void)
 	oled_print(i2c_handle, 15 - strlen(buffer), 6, OLED_FONT_MEDIUM,
 		   buffer);
 
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  take_second
+
+  What happened over the last second: the worst step timing (-1 if it
+  couldn't be had) and the guiding.
+*/
+
+struct second {
+	long ra_late;
+	long dec_late;
+	double ra_guide;
+	double dec_guide;
+};
+
+static void
+take_second(struct second *second)
+{
+	lock(&state.mutex);
+	second->ra_guide = state.ra_guide;
+	second->dec_guide = state.dec_guide;
+	state.ra_guide = 0.0;
+	state.dec_guide = 0.0;
+	unlock(&state.mutex);
+
+	if (stepper_get_late(STEPPER_AXIS_RA, &second->ra_late))
+		second->ra_late = -1;
+
+	if (stepper_get_late(STEPPER_AXIS_DEC, &second->dec_late))
+		second->dec_late = -1;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  record_second
+
+  Add the last second to the session recording, see recorder.h.
+*/
+
+static void
+record_second(const struct second *second)
+{
+	struct recorder_record record;
+	struct telemetry_sample sample;
+	struct timespec now;
+	long long position;
+	int duty;
+
+	memset(&record, 0, sizeof(record));
+
+	clock_gettime(CLOCK_REALTIME, &now);
+	record.time = (int64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+
+	lock(&state.mutex);
+	record.control = state.control;
+	record.ra_rate = state.ra_rate;
+	record.dec_rate = state.dec_rate;
+	unlock(&state.mutex);
+
+	if (0 == stepper_get_position(STEPPER_AXIS_RA, &position, NULL))
+		record.ra_position = position;
+
+	if (0 == stepper_get_position(STEPPER_AXIS_DEC, &position, NULL))
+		record.dec_position = position;
+
+	record.ra_guide = second->ra_guide;
+	record.dec_guide = second->dec_guide;
+	record.ra_late = (0 > second->ra_late) ?
+		RECORDER_UNKNOWN_LATE : second->ra_late;
+	record.dec_late = (0 > second->dec_late) ?
+		RECORDER_UNKNOWN_LATE : second->dec_late;
+
+	record.temp = RECORDER_UNKNOWN_TEMP;
+	record.load = RECORDER_UNKNOWN_LOAD;
+
+	if (telemetry_latest(&sample)) {
+		if (TELEMETRY_UNKNOWN != sample.temp)
+			record.temp = sample.temp / 100;
+
+		if (TELEMETRY_UNKNOWN != sample.load)
+			record.load = sample.load;
+	}
+
+	duty = fan_get_duty();
+	record.fan = (0 > duty) ? RECORDER_UNKNOWN_FAN : (uint32_t)duty;
+
+	recorder_write(&record);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  draw_second
+
+  Temperature, load and the histories, once a second.
+*/
+
+static void
+draw_second(const struct second *second)
+{
+	int temp;
+	long load;
+	char buffer[80];
+	int flen;
+
 	/* Update Temperature and Load */
 
 	load = get_load();
@@ -147,118 +324,184 @@ update_oled(void)
 	oled_fill(i2c_handle, false, 3, 2, 15, 2);
 	oled_print(i2c_handle, 15 - strlen(buffer), 2, OLED_FONT_MEDIUM,
 		   buffer);
+
+	/* Histories */
+
+	if (0 > second->ra_late || 0 > second->dec_late)
+		widget_add(&late_history, NAN);
+	else
+		widget_add(&late_history,
+			   (second->ra_late > second->dec_late) ?
+			   second->ra_late : second->dec_late);
+
+	widget_add(&temp_history, (-1 == temp) ? NAN : temp);
+	widget_add(&load_history, (-1 == load) ? NAN : load);
+	widget_add(&ra_guide_history, second->ra_guide);
+	widget_add(&dec_guide_history, second->dec_guide);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  parked
+
+  Both axes stopped, whoever has control (the INDI driver holds remote
+  control with the axes stopped all day).
+*/
+
+static bool
+parked(void)
+{
+	bool ra = false;
+	bool dec = false;
+
+	lock(&state.mutex);
+
+	if (stepper_get_status(STEPPER_AXIS_RA, &ra, NULL, NULL))
+		ra = false;
+
+	if (stepper_get_status(STEPPER_AXIS_DEC, &dec, NULL, NULL))
+		dec = false;
+
+	unlock(&state.mutex);
+
+	return !ra && !dec;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  idle
+
+  Dim, then blank, the display once nothing has changed for a while.
+  Returns true if the display is blank.
+*/
+
+static bool
+idle(struct timespec now)
+{
+	double quiet;
+
+	quiet = timespec_to_double(timespec_sub(now, active));
+
+	if (DISPLAY_BRIGHT == display && DIM_AFTER <= quiet) {
+		oled_contrast(i2c_handle, CONTRAST_DIM);
+		display = DISPLAY_DIM;
+	}
+
+	if (DISPLAY_DIM == display && BLANK_AFTER <= quiet && parked()) {
+		oled_display(i2c_handle, false);
+		display = DISPLAY_BLANK;
+	}
+
+	return DISPLAY_BLANK == display;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  wake
+*/
+
+static void
+wake(struct timespec now)
+{
+	active = now;
+
+	if (DISPLAY_BRIGHT == display)
+		return;
+
+	oled_contrast(i2c_handle, CONTRAST_BRIGHT);
+	oled_display(i2c_handle, true);
+	display = DISPLAY_BRIGHT;
+
 	return;
 }
 
 /*
   ------------------------------------------------------------------------------
-  pstat
+  refresh
+
+  Run by the loop when stats_notify() says something shown has changed,
+  and after each second.  Changes are drawn at once, but only sent
+  REFRESH seconds after the last send, so a burst of them is sent once.
 */
 
-static void *
-pstat(__attribute__((unused)) void *input)
+static double
+refresh(__attribute__((unused)) void *data, struct timespec now)
 {
-	int rc;
-	long last[3];
-	long this[3];
-	struct timespec last_stamp;
-	const struct timespec sleep = {
-		.tv_sec = 1,
-		.tv_nsec = 0
-	};
-	bool first_run = true;
-	char id[16];
-
-	rc = pthread_setcanceltype(PTHREAD_CANCEL_DEFERRED, NULL);
+	unsigned changes;
 
-	if (rc) {
-		fprintf(stderr, "%s:%d - pthread_setcanceltype() failed: %s\n",
-			__FILE__, __LINE__, strerror(rc));
+	lock(&global.mutex);
+	changes = global.changes;
+	global.changes = 0;
+	unlock(&global.mutex);
 
-		pthread_exit(NULL);
+	if (!oled_enabled)
+		return LOOP_NEVER;
+
+	if (changes) {
+		wake(now);
+		draw_state();
+		pending = true;
 	}
 
-	rc = pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+	if (!pending)
+		return LOOP_NEVER;
 
-	if (rc) {
-		fprintf(stderr, "%s:%d - pthread_setcancelstate() failed: %s\n",
-			__FILE__, __LINE__, strerror(rc));
+	/* Blank, keep drawing; the next wake sends it all. */
+	if (idle(now)) {
+		pending = false;
 
-		pthread_exit(NULL);
+		return LOOP_NEVER;
 	}
 
-	/*
-	  This is the main loop -- now that everything has been set up.
-	*/
-
-	for (;;) {
-		FILE *pstat;
-
-		/* Check for Cancellation */
-		pthread_testcancel();
-
-		pstat = fopen("/proc/stat", "r");
-
-		if (NULL == pstat) {
-			fprintf(stderr, "%s:%d - fopen() failed: %s\n",
-				__FILE__, __LINE__, strerror(errno));
-			nanosleep(&sleep, NULL);
-			continue;
-		}
-
-		rc = clock_gettime(CLOCK_MONOTONIC_COARSE, &last_stamp);
-
-		if (-1 == rc) {
-			fprintf(stderr, "%s:%d - clock_gettime() failed: %s\n",
-				__FILE__, __LINE__, strerror(errno));
-			nanosleep(&sleep, NULL);
-			continue;
-		}
-
-		rc = fscanf(pstat, "%s %ld %ld %ld",
-			    id, &this[0], &this[1], &this[2]);
-
-		if (4 != rc) {
-			if (ferror(pstat)) {
-				fprintf(stderr, "%s:%d - fscanf() failed: %s\n",
-					__FILE__, __LINE__, strerror(errno));
-			} else if (feof(pstat)) {
-				fprintf(stderr, "%s:%d - fscanf() hit EOF\n",
-					__FILE__, __LINE__);
-			} else {
-				fprintf(stderr, "%s:%d - fscanf() failed\n",
-					__FILE__, __LINE__);
-			}
-		} else {
-			if(first_run) {
-				first_run = false;
-			} else {
-				lock(&global.mutex);
-				global.load = (this[0] + this[1] + this[2]) -
-					(last[0] + last[1] + last[2]);
-				global.available = true;
-				unlock(&global.mutex);
-			}
-
-			last[0] = this[0];
-			last[1] = this[1];
-			last[2] = this[2];
-		}
-
-		fclose(pstat);
-
-		rc = nanosleep(&sleep, NULL);
-
-		if (rc) {
-			fprintf(stderr,	"%s:%d - nanosleep(%ld %ld) failed: %s\n",
-				__FILE__, __LINE__,
-				sleep.tv_sec, sleep.tv_nsec, strerror(errno));
-		}
-
-		update_oled();
+	if (timespec_lt(now, next_refresh))
+		return timespec_to_double(timespec_sub(next_refresh, now));
+
+	/* Send whatever changed. */
+	if (oled_present())
+		oled_update(i2c_handle);
+
+	pending = false;
+	next_refresh = timespec_add(now, timespec_from_double(REFRESH));
+
+	return LOOP_NEVER;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  tick
+
+  Once a second, sample telemetry, record the session and add to the
+  histories.  Dimmed and parked, the histories stop (nothing is sent
+  to the display) until the next change.
+*/
+
+static double
+tick(__attribute__((unused)) void *data, struct timespec now)
+{
+	struct second last_second;
+
+	telemetry_sample();
+	take_second(&last_second);
+	record_second(&last_second);
+	power_late(last_second.ra_late, last_second.dec_late);
+
+	if (!oled_enabled)
+		return 1.0;
+
+	if (DISPLAY_BRIGHT != display && parked()) {
+		/* Still count towards blanking. */
+		idle(now);
+
+		return 1.0;
 	}
 
-	pthread_exit(NULL);
+	draw_second(&last_second);
+	pending = true;
+	loop_schedule(global.refresh_timer, 0.0);
+
+	return 1.0;
 }
 
 /*
@@ -279,57 +522,58 @@ pstat(__attribute__((unused)) void *input)
 int
 get_temp(void)
 {
-	FILE *thermal;
-	int temp;
-	int rc;
+	struct telemetry_sample sample;
 
-	thermal = fopen("/sys/class/thermal/thermal_zone0/temp", "r");
+	if (!telemetry_latest(&sample) || TELEMETRY_UNKNOWN == sample.temp)
+		return -1;
 
-	if (NULL == thermal) {
-		fprintf(stderr, "%s:%d - fopen() failed: %s\n",
-			__FILE__, __LINE__, strerror(errno));
+	return sample.temp / 1000;
+}
 
-		return -1;
-	}
+/*
+  ------------------------------------------------------------------------------
+  get_load
 
-	rc = fscanf(thermal, "%d", &temp);
+  Returns the percentage of the last second the CPUs were busy.
+*/
 
-	if (EOF == rc) {
-		if (ferror(thermal))
-			fprintf(stderr, "%s:%d - fscanf() failed: %s\n",
-				__FILE__, __LINE__, strerror(errno));
-		else
-			fprintf(stderr, "%s:%d - fscanf() returned EOF\n",
-				__FILE__, __LINE__);
+long
+get_load(void)
+{
+	struct telemetry_sample sample;
 
+	if (!telemetry_latest(&sample) || TELEMETRY_UNKNOWN == sample.load)
 		return -1;
-	}
-
-	fclose(thermal);
 
-	return temp / 1000;
+	return sample.load;
 }
 
 /*
   ------------------------------------------------------------------------------
-  get_load
+  stats_notify
 */
 
-long
-get_load(void)
+void
+stats_notify(unsigned changes)
 {
-	long load;
+	/* A rate change may start or stop an axis. */
+	if (STATS_CHANGE_RATE & changes)
+		power_notify();
 
 	lock(&global.mutex);
 
-	if (global.available)
-		load = global.load;
-	else
-		load = -1;
+	/* Before stats_initialize(), the first draw picks it up. */
+	if (-1 != global.refresh_timer) {
+		global.changes |= changes;
+		unlock(&global.mutex);
+		loop_schedule(global.refresh_timer, 0.0);
+
+		return;
+	}
 
 	unlock(&global.mutex);
 
-	return load;
+	return;
 }
 
 /*
@@ -340,23 +584,39 @@ get_load(void)
 int
 stats_initialize(void)
 {
-	int rc;
+	int timer;
 
-	rc = pthread_create(&pstat_thread, NULL, pstat, NULL);
+	telemetry_initialize();
+	open_oled();
 
- 	if (rc) {
-		fprintf(stderr, "%s:%d - pthread_create() failed: %s\n",
-			__FILE__, __LINE__, strerror(rc));
+	clock_gettime(CLOCK_MONOTONIC, &active);
+	next_refresh = active;
+
+	if (oled_enabled) {
+		draw_state();
+		pending = true;
+	}
+
+	if (-1 == loop_timer(tick, NULL, 1.0, SLACK_SECOND)) {
+		fprintf(stderr, "%s:%d - loop_timer() failed\n",
+			__FILE__, __LINE__);
 
 		return -1;
 	}
 
-	rc = pthread_setname_np(pstat_thread, "pimount.pstat");
+	timer = loop_timer(refresh, NULL, 0.0, SLACK_REFRESH);
 
- 	if (rc)
-		fprintf(stderr, "%s:%d - pthread_setname_np() failed\n",
+	if (-1 == timer) {
+		fprintf(stderr, "%s:%d - loop_timer() failed\n",
 			__FILE__, __LINE__);
 
+		return -1;
+	}
+
+	lock(&global.mutex);
+	global.refresh_timer = timer;
+	unlock(&global.mutex);
+
 	return 0;
 }
 
@@ -368,17 +628,18 @@ stats_initialize(void)
 void
 stats_finalize(void)
 {
+	telemetry_finalize();
+
 	if (oled_enabled) {
 		oled_enabled = false;
+		oled_stop();
 		oled_clear(i2c_handle);
+		oled_update(i2c_handle);
 		oled_finalize(i2c_handle);
 	}
 
 	if (0 <= i2c_handle)
 		i2cClose(i2c_handle);
 
-	pthread_cancel(pstat_thread);
-	pthread_join(pstat_thread, NULL);
-
 	return;
 }
@@ -3,7 +3,8 @@
   ==============================================================================
   stats.h
 
-  Note that this starts a thread to periodically poll /proc/stats.
+  Telemetry, the session recording and the OLED display, run from the
+  housekeeping loop (see loop.h); call loop_initialize() first.
   ==============================================================================
   ==============================================================================
 */
@@ -17,4 +18,15 @@ void stats_finalize(void);
 int get_temp(void);
 long get_load(void);
 
+/*
+  Tell the display something it shows has changed.  The display is
+  only redrawn when told (or once a second, for the histories, load and
+  temperature), so call this after changing state.control or the rates.
+*/
+
+#define STATS_CHANGE_CONTROL 0x1
+#define STATS_CHANGE_RATE    0x2
+
+void stats_notify(unsigned changes);
+
 #endif	/* _STATS_H_ */
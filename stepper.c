@@ -24,8 +24,10 @@
 #include "fan.h"
 #include "pins.h"
 #include "a4988.h"
+#include "pec.h"
 #include "timespec.h"
 #include "stepper.h"
+#include "steps.h"
 
 /*
   ==============================================================================
@@ -37,12 +39,16 @@
 
 struct stepper_parameters {
 	pthread_mutex_t mutex;
+	pthread_cond_t wake;	/* Signalled when changed is set. */
+	enum stepper_axis axis;
 
 	enum stepper_state state;
 	enum stepper_direction direction;
 	double rate;
 	long int duration;	/* in milli seconds */
 	long int remaining;	/* in milli seconds */
+	bool changed;		/* Rate changed while running. */
+	long long position;	/* in 1/8 steps, see stepper.h */
 
 	/* A4988 Stuff */
 	struct {
@@ -54,16 +60,25 @@ struct stepper_parameters {
 	/* Timing */
 	long width;		/* in micro seconds */
 	long delay;		/* in micro seconds */
+	double fraction;	/* of a micro second, left out of delay */
+	long late;		/* worst step, see stepper_get_late() */
 };
 
 struct stepper {
 	pthread_mutex_t mutex;
 	bool initialized;
 
+	/*
+	  A thread is "started" from pthread_create() until it is
+	  joined, whether or not it is still running.
+	*/
+
 	pthread_t ra_thread;
+	bool ra_started;
 	struct stepper_parameters ra_parameters;
 
 	pthread_t dec_thread;
+	bool dec_started;
 	struct stepper_parameters dec_parameters;
 };
 
@@ -72,9 +87,6 @@ static struct stepper global = {
 	.initialized = false
 };
 
-/* How close is the same? */
-#define SAME_DOUBLE 0.1
-
 char *cmdErrStr(int);
 
 #undef STEPPER_TRACE
@@ -143,189 +155,125 @@ display_trace(void)
 
 /*
   ------------------------------------------------------------------------------
-  ra_update_from_rate
-
-  Set the A4988 values in the struction based on rate and direction.
-
-  A pulse width of 500 us is used in all cases, with the resolution
-  and delay between pulses varying to get to the requested rate (in
-  arc-seconds per second).  The minimum delay is 2000 us (see the
-  a4988 driver).
-
-  For the RA axis, maximum rate the original controller allows is 8x
-  the tracking rate, or (15 * 8) arc-seconds per second -- 120
-  arc-seconds per second.
-
-  Based on the measurements below, the formula for rate and delay is
-  as follows.
-
-       rate = ([resolution] * 1,440,000) / delay
-
-       Where resolution is 1/8, 1/4, 1/2, or 1 and delay is in us.
-       The rate is in arc-seconds per second.
-
-  Measurements were made using the setting rings.
-
-  Resolution would be 1/8 up to 60 as/s (arc seconds per second) with delays of
-
-       - 96000 us for 1.875 as/s
-       - 48000 us for 3.75 as/s
-       - 24000 us for 7.5 as/s
-       - 12000 us for 15 as/s
-       -  6000 us for 30 as/s
-       -  3000 us for 60 as/s
-
-  At 1/4,
-
-       - 12000 us for 30 as/s
-
-  At 1/2,
+  update_from_rate
 
-       - 24000 us for 30 as/s
-
-  At full,
-
-       - 48000 us for 30 as/s
-
-  UPDATE
-
-  The originall 1440000 is a bit fast based on tracking during
-  observation.  To make adjustments easier, define THE_RA_NUMBER and
-  adjust from there...
+  Set the A4988 values and timing in the structure based on rate and
+  axis, see steps.h.
 */
 
-#define THE_RA_NUMBER 1460000
-
 static int
-ra_update_from_rate(struct stepper_parameters *sp)
+update_from_rate(struct stepper_parameters *sp)
 {
-	/*
-	  Use 500 us for width, and set the direction.
-	*/
+	struct steps steps;
 
-	sp->width = 500;
+	if (steps_from_rate(sp->axis, sp->rate, &steps))
+		return EXIT_FAILURE;
 
-	if (0.0 < sp->rate)
-		sp->a4988.direction = A4988_DIR_CW;
-	else
-		sp->a4988.direction = A4988_DIR_CCW;
+	sp->a4988.resolution = steps.resolution;
+	sp->a4988.direction = steps.direction;
+	sp->width = steps.width;
+	sp->delay = steps.delay;
+	sp->fraction = steps.fraction;
 
-	/*
-	  Based on the above, use a resolution of 1/8 for rates from
-	  -30.0 to 30.0 as/s.
-	*/
+	return EXIT_SUCCESS;
+}
 
-	if (30.0 >= fabs(sp->rate)) {
-		sp->a4988.resolution = A4988_RES_EIGHTH;
-		sp->delay = (THE_RA_NUMBER / 8) / sp->rate;
+/*
+  ------------------------------------------------------------------------------
+  stepper_timing
 
-		return EXIT_SUCCESS;
-	}
+  Convert width and delay (in micro seconds) to the period and the
+  initial sleep used by the stepper thread.
 
-	/*
-	  Between 30.0 and 60.0 (or -60.0 and -30.0), use 1/4.
-	*/
+  Slow rates have delays of minutes, which don't fit in tv_nsec (a
+  32 bit long on the Pi), so split seconds and micro seconds first.
+*/
 
-	if (60.0 >= fabs(sp->rate)) {
-		sp->a4988.resolution = A4988_RES_QUARTER;
-		sp->delay = (THE_RA_NUMBER / 4) / sp->rate;
+static struct timespec
+timespec_from_us(long us)
+{
+	struct timespec ts;
 
-		return EXIT_SUCCESS;
-	}
+	ts.tv_sec = us / 1000000;
+	ts.tv_nsec = (us % 1000000) * 1000;
 
-	/*
-	  Between 60.0 and 120.0 (or -120.0 and -60.0), use 1.
-	*/
+	return timespec_normalise(ts);
+}
 
-	if (120.0 >= fabs(sp->rate)) {
-		sp->a4988.resolution = A4988_RES_FULL;
-		sp->delay = THE_RA_NUMBER / sp->rate;
+static int
+stepper_timing(struct stepper_parameters *sp,
+	       struct timespec *period, struct timespec *sleep)
+{
+	if (0 > sp->width || 0 > sp->delay) {
+		fprintf(stderr, "%s:%d - Invalid Timing: %ld %ld\n",
+			__FILE__, __LINE__, sp->width, sp->delay);
 
-		return EXIT_SUCCESS;
+		return -1;
 	}
 
-	fprintf(stderr,	"%s:%d - Requested rate is out of range: %.2f\n",
-		__FILE__, __LINE__, sp->rate);
+	*period = timespec_from_us(sp->width + sp->delay);
+	*sleep = timespec_from_us(sp->delay);
 
-	return EXIT_FAILURE;
+	return 0;
 }
 
 /*
   ------------------------------------------------------------------------------
-  dec_update_from_rate
-
-  Set the A4988 values in the struction based on rate and direction.
-
-  As above, use 500 us as the pulse width and adjust resolution and
-  delay to control the rate.
-
-  Note that 15 asec/sec is .25 degrees per minute
-
-  Using the setting circle does not allow for much precision, but it
-  seems like the end result is the same as in the RA case -- even
-  though the gearing looks quite different (there is a gear box on the
-  RA motor, but not on the DEC motor).
+  stepper_wait
 
-  UPDATE
-
-  Not even close to RA... Use THE_DEC_NUMBER below to set the value.
-  Need to use observational measurements to find the number.
+  Wait until 'deadline' (CLOCK_MONOTONIC), or until the rate changes.
+  Returns true if the rate changed, so a new rate takes effect right
+  away instead of after the current (possibly long) step.
 */
 
-#define THE_DEC_NUMBER 2840000
-
-static int
-dec_update_from_rate(struct stepper_parameters *sp)
+static void
+stepper_unlock(void *input)
 {
-	/*
-	  Use 500 us for width, and set the direction.
-	*/
+	pthread_mutex_unlock((pthread_mutex_t *)input);
 
-	sp->width = 500;
-
-	if (0.0 < sp->rate)
-		sp->a4988.direction = A4988_DIR_CW;
-	else
-		sp->a4988.direction = A4988_DIR_CCW;
+	return;
+}
 
-	/*
-	  Based on the above, use a resolution of 1/8 for rates from
-	  -30.0 to 30.0 as/s.
-	*/
+static bool
+stepper_wait(struct stepper_parameters *sp, struct timespec deadline)
+{
+	bool changed;
 
-	if (30.0 >= fabs(sp->rate)) {
-		sp->a4988.resolution = A4988_RES_EIGHTH;
-		sp->delay = (THE_DEC_NUMBER / 8) / sp->rate;
+	pthread_mutex_lock(&sp->mutex);
 
-		return EXIT_SUCCESS;
-	}
+	/* pthread_cond_timedwait() is a cancellation point. */
+	pthread_cleanup_push(stepper_unlock, &sp->mutex);
 
-	/*
-	  Between 30.0 and 60.0 (or -60.0 and -30.0), use 1/4.
-	*/
+	int rc = 0;
 
-	if (60.0 >= fabs(sp->rate)) {
-		sp->a4988.resolution = A4988_RES_QUARTER;
-		sp->delay = (THE_DEC_NUMBER / 4) / sp->rate;
+	while (!sp->changed && ETIMEDOUT != rc) {
+		rc = pthread_cond_timedwait(&sp->wake, &sp->mutex, &deadline);
 
-		return EXIT_SUCCESS;
+		if (rc && ETIMEDOUT != rc) {
+			fprintf(stderr,
+				"%s:%d - pthread_cond_timedwait() failed: %s\n",
+				__FILE__, __LINE__, strerror(rc));
+			break;
+		}
 	}
 
-	/*
-	  Between 60.0 and 120.0 (or -120.0 and -60.0), use 1.
-	*/
+	/* How late did the thread wake up for this step? */
+	if (ETIMEDOUT == rc) {
+		struct timespec now;
+		long late;
 
-	if (120.0 >= fabs(sp->rate)) {
-		sp->a4988.resolution = A4988_RES_FULL;
-		sp->delay = THE_DEC_NUMBER / sp->rate;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		late = (long)(timespec_to_double(timespec_sub(now, deadline)) *
+			      1e6);
 
-		return EXIT_SUCCESS;
+		if (late > sp->late)
+			sp->late = late;
 	}
 
-	fprintf(stderr,	"%s:%d - Requested rate is out of range: %.2f\n",
-		__FILE__, __LINE__, sp->rate);
+	changed = sp->changed;
+	pthread_cleanup_pop(1);
 
-	return EXIT_FAILURE;
+	return changed;
 }
 
 /*
@@ -361,6 +309,10 @@ stepper(void *input)
 	struct timespec sleep;
 	bool run_forever;
 	struct timespec stop;
+	enum a4988_res resolution;
+	enum a4988_dir direction;
+	long long increment;
+
 	sp = (struct stepper_parameters *)input;
 
 	rc = pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
@@ -384,52 +336,35 @@ stepper(void *input)
 		pthread_exit(NULL);
 	}
 
-	rc = a4988_enable(&sp->a4988.driver,
-			  sp->a4988.resolution, sp->a4988.direction);
+	pthread_mutex_lock(&sp->mutex);
+	resolution = sp->a4988.resolution;
+	direction = sp->a4988.direction;
+	sp->changed = false;
+	rc = stepper_timing(sp, &period, &sleep);
+	pthread_mutex_unlock(&sp->mutex);
+
+	if (rc)
+		pthread_exit(NULL);
+
+	rc = a4988_enable(&sp->a4988.driver, resolution, direction);
 
 	if (rc) {
 		fprintf(stderr, "%s:%d - rc=%d\n", __FILE__, __LINE__, rc);
 		pthread_exit(NULL);
 	}
 
+	/* Each step moves 8, 4, 2 or 1 1/8 steps. */
+	increment = (8 >> resolution) * ((A4988_DIR_CW == direction) ? 1 : -1);
+
 #ifdef STEPPER_TRACE
 	traces_i = 0;
 	memset(traces, 0, sizeof(traces));
 #endif	/* STEPPER_TRACE */
 
-	/*
-	  Initialize the Period and Sleep
-
-	  Make sure the conversion from milli seconds to nano seconds
-	  does not overflow!  Use the GCC (version >= 5) built-ins to
-	  do this.
-	*/
-
-	period.tv_sec = 0;
-
- 	if (__builtin_smull_overflow((sp->width + sp->delay), 1000,
-				     &period.tv_nsec)) {
-		fprintf(stderr, "%s:%d - OVERFLOW calculating period\n",
-			__FILE__, __LINE__);
-		pthread_exit(NULL);
-	}
-
-	period = timespec_normalise(period);
-
 #ifdef STEPPER_TRACE
 	copy_timespec(&trace_period, &period);
 #endif	/* STEPPER_TRACE */
 
-	sleep.tv_sec = 0;
-
- 	if (__builtin_smull_overflow(sp->delay, 1000, &sleep.tv_nsec)) {
-		fprintf(stderr, "%s:%d - OVERFLOW calculating sleep\n",
-			__FILE__, __LINE__);
-		pthread_exit(NULL);
-	}
-
-	sleep = timespec_normalise(sleep);
-
 	/* When will it be time to stop? */
 	if (0 == sp->duration)
 		run_forever = true;
@@ -468,17 +403,75 @@ stepper(void *input)
 
 	/*
 	  This is the main loop -- now that everything has been set up.
+
+	  m[] holds the times of the last two steps, and last the time of
+	  the last one.  delay is the delay in use, which differs from
+	  sp->delay when periodic error correction is active.  Declared
+	  here, after pthread_cleanup_push(), so setjmp() can't clobber
+	  them.
 	*/
 
+	int mi = 0;
+	struct timespec m[2];
+	struct timespec last;
+	bool stepped = false;
+	long delay;
+	double fraction;
+	double extra = 0.0;
+
+	pthread_mutex_lock(&sp->mutex);
+	delay = sp->delay;
+	fraction = sp->fraction;
+	pthread_mutex_unlock(&sp->mutex);
+
 	for (;;) {
-		static int mi = 0;
-		static struct timespec m[2];
 		struct timespec now;
 		struct timespec offset;
+		bool changed = false;
 
 		/* Check for Cancellation */
 		pthread_testcancel();
 
+		/*
+		  Pick up a new rate (see stepper_set_rate()).  The
+		  A4988 only has to be touched if the resolution or
+		  direction changed.
+		*/
+
+		pthread_mutex_lock(&sp->mutex);
+
+		if (sp->changed) {
+			sp->changed = false;
+			changed = true;
+
+			if (0 == stepper_timing(sp, &period, &sleep))
+				mi = 0;
+
+			delay = sp->delay;
+			fraction = sp->fraction;
+
+			if (resolution != sp->a4988.resolution ||
+			    direction != sp->a4988.direction) {
+				resolution = sp->a4988.resolution;
+				direction = sp->a4988.direction;
+				a4988_enable(&sp->a4988.driver,
+					     resolution, direction);
+				increment = (8 >> resolution) *
+					((A4988_DIR_CW == direction) ? 1 : -1);
+			}
+		}
+
+		pthread_mutex_unlock(&sp->mutex);
+
+		/*
+		  After a change, the next step is due one (new) sleep
+		  after the last one -- which may be now.
+		*/
+
+		if (changed && stepped &&
+		    stepper_wait(sp, timespec_add(last, sleep)))
+			continue;
+
 		if (!run_forever) {
 			clock_gettime(CLOCK_REALTIME, &now);
 			if (timespec_gt(now, stop))
@@ -504,8 +497,42 @@ stepper(void *input)
 		/* Step the Stepper */
 		a4988_step(&sp->a4988.driver, sp->width);
 
+		pthread_mutex_lock(&sp->mutex);
+		sp->position += increment;
+
+		/*
+		  Periodic error correction (see pec.h) while tracking.
+		  Adjust period and sleep by the change in delay, so the
+		  drift correction below keeps working, as long as the
+		  resolution and direction stay the same.
+		*/
+
+		if (STEPPER_AXIS_RA == sp->axis && pec_tracking(sp->rate)) {
+			struct steps corrected;
+
+			if (0 == steps_from_rate(STEPPER_AXIS_RA, sp->rate +
+						 pec_rate(sp->position),
+						 &corrected) &&
+			    resolution == corrected.resolution &&
+			    direction == corrected.direction) {
+				struct timespec change;
+
+				/* Signed, and maybe more than tv_nsec holds. */
+				change = timespec_from_us(corrected.delay -
+							  delay);
+				period = timespec_add(period, change);
+				sleep = timespec_add(sleep, change);
+				delay = corrected.delay;
+				fraction = corrected.fraction;
+			}
+		}
+
+		pthread_mutex_unlock(&sp->mutex);
+
 		/* offset and sleep are just relative. */
-		clock_gettime(CLOCK_MONOTONIC, &m[mi++]);
+		clock_gettime(CLOCK_MONOTONIC, &last);
+		m[mi++] = last;
+		stepped = true;
 
 #ifdef STEPPER_TRACE
 		traces[traces_i].mia = mi;
@@ -528,9 +555,7 @@ stepper(void *input)
 				sleep = timespec_add(sleep, offset);
 
 			if (0 > timespec_to_ms(sleep)) {
-				sleep.tv_sec = 0;
-				sleep.tv_nsec = sp->delay * 1000;
-				sleep = timespec_normalise(sleep);
+				sleep = timespec_from_us(delay);
 			}					
 
 #ifdef STEPPER_TRACE
@@ -541,12 +566,15 @@ stepper(void *input)
 			mi = 0;
 		}
 
-		rc = nanosleep(&sleep, NULL);
+		/* Add up the fractions of a micro second delay leaves out. */
+		extra += fraction;
 
-		if (rc) {
-			fprintf(stderr,	"%s:%d - nanosleep(%ld %ld) failed: %s\n",
-				__FILE__, __LINE__,
-				sleep.tv_sec, sleep.tv_nsec, strerror(errno));
+		if (1.0 <= extra) {
+			extra -= 1.0;
+			stepper_wait(sp, timespec_add(timespec_add(last, sleep),
+						      timespec_from_us(1)));
+		} else {
+			stepper_wait(sp, timespec_add(last, sleep));
 		}
 
 #ifdef STEPPER_TRACE
@@ -570,6 +598,7 @@ init_state(enum stepper_axis axis,
 	   struct stepper_parameters *sp, const char *description)
 {
 	int rc;
+	pthread_condattr_t attr;
 
 	rc = pthread_mutex_init(&sp->mutex, NULL);
 
@@ -580,7 +609,22 @@ init_state(enum stepper_axis axis,
 		return -1;
 	}
 
+	/* The stepper thread's deadlines are CLOCK_MONOTONIC. */
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	rc = pthread_cond_init(&sp->wake, &attr);
+	pthread_condattr_destroy(&attr);
+
+	if (0 != rc) {
+		fprintf(stderr,	"%s:%d - pthread_cond_init() failed: %s\n",
+			__FILE__, __LINE__, strerror(rc));
+		pthread_mutex_destroy(&sp->mutex);
+
+		return -1;
+	}
+
 	sp->state = STEPPER_STATE_OFF;
+	sp->axis = axis;
 
 	if (STEPPER_AXIS_RA == axis) {
 		sp->a4988.driver.direction = RA_PIN_DIRECTION;
@@ -735,6 +779,7 @@ stepper_start(enum stepper_axis axis, double rate, long duration)
 	const char *names[2] = { "pimount.ra", "pimount.dec" };
 	enum stepper_direction direction;
 	pthread_t *thread;
+	bool *started;
 
 	/* Verify that the Axis is Valid */
 
@@ -752,7 +797,7 @@ stepper_start(enum stepper_axis axis, double rate, long duration)
 
 	/* Make sure the rate is valid.	*/
 
-	if (fabs(rate - 0.0) < SAME_DOUBLE) {
+	if (fabs(rate - 0.0) < RATE_RESOLUTION) {
 		fprintf(stderr, "%s:%d - Invalid Rate %f (too close to zero)!\n",
 			__FILE__, __LINE__, rate);
 
@@ -784,6 +829,7 @@ stepper_start(enum stepper_axis axis, double rate, long duration)
 		}
 
 		thread = &global.ra_thread;
+		started = &global.ra_started;
 	} else {
 		sp = &global.dec_parameters;
 
@@ -796,6 +842,13 @@ stepper_start(enum stepper_axis axis, double rate, long duration)
 		}
 
 		thread = &global.dec_thread;
+		started = &global.dec_started;
+	}
+
+	/* A thread that ran out of time still has to be joined. */
+	if (*started) {
+		pthread_join(*thread, NULL);
+		*started = false;
 	}
 
 	rc = pthread_mutex_lock(&sp->mutex);
@@ -813,24 +866,13 @@ stepper_start(enum stepper_axis axis, double rate, long duration)
 	sp->direction = direction;
 	sp->duration = duration;
 
-	if (STEPPER_AXIS_RA == axis) {
-		if (ra_update_from_rate(sp)) {
-			fprintf(stderr,	"%s:%d - ra_update_from_rate() failed!\n",
-				__FILE__, __LINE__);
-			pthread_mutex_unlock(&sp->mutex);
-			unlock(&global.mutex);
-
-			return -1;
-		}
-	} else {
-		if (dec_update_from_rate(sp)) {
-			fprintf(stderr,	"%s:%d - dec_update_from_rate() failed!\n",
-				__FILE__, __LINE__);
-			pthread_mutex_unlock(&sp->mutex);
-			unlock(&global.mutex);
+	if (update_from_rate(sp)) {
+		fprintf(stderr,	"%s:%d - update_from_rate() failed!\n",
+			__FILE__, __LINE__);
+		pthread_mutex_unlock(&sp->mutex);
+		unlock(&global.mutex);
 
-			return -1;
-		}
+		return -1;
 	}
 
 	sp->state = STEPPER_STATE_ON;
@@ -847,6 +889,8 @@ stepper_start(enum stepper_axis axis, double rate, long duration)
 		return -1;
 	}
 
+	*started = true;
+
 	rc = pthread_setname_np(*thread, names[axis]);
 
 	if (rc) {
@@ -854,6 +898,7 @@ stepper_start(enum stepper_axis axis, double rate, long duration)
 			__FILE__, __LINE__, strerror(rc));
 		pthread_cancel(*thread);
 		pthread_join(*thread, NULL);
+		*started = false;
 		pthread_mutex_unlock(&sp->mutex);
 		unlock(&global.mutex);
 
@@ -891,6 +936,7 @@ stepper_stop(enum stepper_axis axis)
 {
 	int rc = 0;
 	pthread_t *thread;
+	bool *started;
 
 	/*
 	  Get the Globals Lock
@@ -900,10 +946,24 @@ stepper_stop(enum stepper_axis axis)
 
 	if (STEPPER_AXIS_RA == axis) {
 		thread = &global.ra_thread;
+		started = &global.ra_started;
 	} else {
 		thread = &global.dec_thread;
+		started = &global.dec_started;
 	}
 
+	/*
+	  Cancelling a thread that was never created (or was already
+	  joined) is undefined, and crashes with glibc.
+	*/
+
+	if (!*started) {
+		unlock(&global.mutex);
+
+		return 0;
+	}
+
+	*started = false;
 	rc = pthread_cancel(*thread);
 
 	if (rc) {
@@ -962,13 +1022,152 @@ stepper_get_status(enum stepper_axis axis,
 			*running = false;
 	}
 
+	pthread_mutex_lock(&sp->mutex);
+
 	if (NULL != rate)
 		*rate = sp->rate;
 
 	if (NULL != remaining)
 		*remaining = sp->remaining;
 
+	pthread_mutex_unlock(&sp->mutex);
+
 	unlock(&global.mutex);
 
 	return 0;
 }
+
+/*
+  ------------------------------------------------------------------------------
+  stepper_get_late
+*/
+
+int
+stepper_get_late(enum stepper_axis axis, long *late)
+{
+	struct stepper_parameters *sp;
+
+	if ((STEPPER_AXIS_RA != axis) && (STEPPER_AXIS_DEC != axis)) {
+		fprintf(stderr, "%s:%d - Invalid Axis: %s\n",
+			__FILE__, __LINE__, stepper_axis_names(axis));
+
+		return -1;
+	}
+
+	if (STEPPER_AXIS_RA == axis)
+		sp = &global.ra_parameters;
+	else
+		sp = &global.dec_parameters;
+
+	pthread_mutex_lock(&sp->mutex);
+	*late = sp->late;
+	sp->late = 0;
+	pthread_mutex_unlock(&sp->mutex);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  stepper_set_rate
+
+  Change the rate without stopping the stepper; the thread picks up
+  the new timing before its next step.  If the axis isn't running,
+  start it (with no time limit).  A rate of 0.0 stops the axis.
+*/
+
+int
+stepper_set_rate(enum stepper_axis axis, double rate)
+{
+	struct stepper_parameters *sp;
+	struct stepper_parameters new;
+	int rc;
+
+	if ((STEPPER_AXIS_RA != axis) && (STEPPER_AXIS_DEC != axis)) {
+		fprintf(stderr, "%s:%d - Invalid Axis: %s\n",
+			__FILE__, __LINE__, stepper_axis_names(axis));
+
+		return -1;
+	}
+
+	if (fabs(rate - 0.0) < RATE_RESOLUTION)
+		return stepper_stop(axis);
+
+	lock(&global.mutex);
+
+	if (STEPPER_AXIS_RA == axis)
+		sp = &global.ra_parameters;
+	else
+		sp = &global.dec_parameters;
+
+	if (STEPPER_STATE_ON != sp->state) {
+		unlock(&global.mutex);
+
+		return stepper_start(axis, rate, 0);
+	}
+
+	/* Work out the new timing before touching the running thread. */
+	memset(&new, 0, sizeof(new));
+	new.axis = axis;
+	new.rate = rate;
+	rc = update_from_rate(&new);
+
+	if (rc) {
+		fprintf(stderr,	"%s:%d - Invalid Rate %f!\n",
+			__FILE__, __LINE__, rate);
+		unlock(&global.mutex);
+
+		return -1;
+	}
+
+	pthread_mutex_lock(&sp->mutex);
+	sp->rate = rate;
+	sp->direction = (rate > 0.0) ?
+		STEPPER_DIRECTION_POSITIVE : STEPPER_DIRECTION_NEGATIVE;
+	sp->width = new.width;
+	sp->delay = new.delay;
+	sp->fraction = new.fraction;
+	sp->a4988.resolution = new.a4988.resolution;
+	sp->a4988.direction = new.a4988.direction;
+	sp->changed = true;
+	pthread_cond_signal(&sp->wake);
+	pthread_mutex_unlock(&sp->mutex);
+
+	unlock(&global.mutex);
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  stepper_get_position
+*/
+
+int
+stepper_get_position(enum stepper_axis axis,
+		     long long *position, double *scale)
+{
+	struct stepper_parameters *sp;
+
+	if ((STEPPER_AXIS_RA != axis) && (STEPPER_AXIS_DEC != axis)) {
+		fprintf(stderr, "Invalid Axis!\n");
+
+		return -1;
+	}
+
+	if (STEPPER_AXIS_RA == axis)
+		sp = &global.ra_parameters;
+	else
+		sp = &global.dec_parameters;
+
+	if (NULL != position) {
+		pthread_mutex_lock(&sp->mutex);
+		*position = sp->position;
+		pthread_mutex_unlock(&sp->mutex);
+	}
+
+	if (NULL != scale)
+		*scale = steps_scale(axis);
+
+	return 0;
+}
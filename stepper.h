@@ -10,6 +10,7 @@
 #define __STEPPER__
 
 #include <math.h>
+#include <stdbool.h>
 
 enum stepper_state {
 	STEPPER_STATE_INVALID = -1,
@@ -100,7 +101,30 @@ int stepper_start(enum stepper_axis axis, double rate, long duration);
 
 int stepper_stop(enum stepper_axis axis);
 
+/*
+  Change the rate of a running axis without stopping it (start it if
+  it isn't running, stop it if rate is 0.0).
+*/
+
+int stepper_set_rate(enum stepper_axis axis, double rate);
+
 int stepper_get_status(enum stepper_axis axis,
 		       bool *running, double *rate, long int *remaining);
 
+/*
+  The number of 1/8 steps taken since the program started, positive
+  being West (RA) or North (DEC) as above.  scale is the number of
+  arcseconds per 1/8 step.
+*/
+
+int stepper_get_position(enum stepper_axis axis,
+			 long long *position, double *scale);
+
+/*
+  The latest a step has been (in micro seconds after it was due) since
+  the last call.
+*/
+
+int stepper_get_late(enum stepper_axis axis, long *late);
+
 #endif	/* __STEPPER__ */
@@ -0,0 +1,269 @@
+/*
+  ==============================================================================
+  steps.c
+
+  Rates to steps, see steps.h.
+  ==============================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "steps.h"
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Private Stuff
+  ==============================================================================
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  set_delay
+
+  Very slow rates need long delays, and fine rates need more than
+  whole micro seconds.  Keep the fraction, which the stepper thread
+  adds up, so the average rate comes out right.
+*/
+
+static void
+set_delay(struct steps *steps, double delay)
+{
+	steps->delay = (long)delay;
+	steps->fraction = delay - steps->delay;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  ra_steps
+
+  Set the A4988 values and timing based on rate (and direction).
+
+  A pulse width of 500 us is used in all cases, with the resolution
+  and delay between pulses varying to get to the requested rate (in
+  arc-seconds per second).  The minimum delay is 2000 us (see the
+  a4988 driver).
+
+  For the RA axis, maximum rate the original controller allows is 8x
+  the tracking rate, or (15 * 8) arc-seconds per second -- 120
+  arc-seconds per second.
+
+  Based on the measurements below, the formula for rate and delay is
+  as follows.
+
+       rate = ([resolution] * 1,440,000) / delay
+
+       Where resolution is 1/8, 1/4, 1/2, or 1 and delay is in us.
+       The rate is in arc-seconds per second.
+
+  Measurements were made using the setting rings.
+
+  Resolution would be 1/8 up to 60 as/s (arc seconds per second) with delays of
+
+       - 96000 us for 1.875 as/s
+       - 48000 us for 3.75 as/s
+       - 24000 us for 7.5 as/s
+       - 12000 us for 15 as/s
+       -  6000 us for 30 as/s
+       -  3000 us for 60 as/s
+
+  At 1/4,
+
+       - 12000 us for 30 as/s
+
+  At 1/2,
+
+       - 24000 us for 30 as/s
+
+  At full,
+
+       - 48000 us for 30 as/s
+
+  UPDATE
+
+  The originall 1440000 is a bit fast based on tracking during
+  observation.  To make adjustments easier, define THE_RA_NUMBER and
+  adjust from there...
+*/
+
+#define THE_RA_NUMBER 1460000
+
+static int
+ra_steps(double rate, struct steps *steps)
+{
+	/*
+	  Use 500 us for width, and set the direction.
+	*/
+
+	steps->width = 500;
+
+	if (0.0 < rate)
+		steps->direction = A4988_DIR_CW;
+	else
+		steps->direction = A4988_DIR_CCW;
+
+	/*
+	  Based on the above, use a resolution of 1/8 for rates from
+	  -30.0 to 30.0 as/s.
+	*/
+
+	if (30.0 >= fabs(rate)) {
+		steps->resolution = A4988_RES_EIGHTH;
+		set_delay(steps, (THE_RA_NUMBER / 8.0) / fabs(rate));
+
+		return EXIT_SUCCESS;
+	}
+
+	/*
+	  Between 30.0 and 60.0 (or -60.0 and -30.0), use 1/4.
+	*/
+
+	if (60.0 >= fabs(rate)) {
+		steps->resolution = A4988_RES_QUARTER;
+		set_delay(steps, (THE_RA_NUMBER / 4.0) / fabs(rate));
+
+		return EXIT_SUCCESS;
+	}
+
+	/*
+	  Between 60.0 and 120.0 (or -120.0 and -60.0), use 1.
+	*/
+
+	if (120.0 >= fabs(rate)) {
+		steps->resolution = A4988_RES_FULL;
+		set_delay(steps, THE_RA_NUMBER / fabs(rate));
+
+		return EXIT_SUCCESS;
+	}
+
+	fprintf(stderr,	"%s:%d - Requested rate is out of range: %.2f\n",
+		__FILE__, __LINE__, rate);
+
+	return EXIT_FAILURE;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  dec_steps
+
+  Set the A4988 values and timing based on rate (and direction).
+
+  As above, use 500 us as the pulse width and adjust resolution and
+  delay to control the rate.
+
+  Note that 15 asec/sec is .25 degrees per minute
+
+  Using the setting circle does not allow for much precision, but it
+  seems like the end result is the same as in the RA case -- even
+  though the gearing looks quite different (there is a gear box on the
+  RA motor, but not on the DEC motor).
+
+  UPDATE
+
+  Not even close to RA... Use THE_DEC_NUMBER below to set the value.
+  Need to use observational measurements to find the number.
+*/
+
+#define THE_DEC_NUMBER 2840000
+
+static int
+dec_steps(double rate, struct steps *steps)
+{
+	/*
+	  Use 500 us for width, and set the direction.
+	*/
+
+	steps->width = 500;
+
+	if (0.0 < rate)
+		steps->direction = A4988_DIR_CW;
+	else
+		steps->direction = A4988_DIR_CCW;
+
+	/*
+	  Based on the above, use a resolution of 1/8 for rates from
+	  -30.0 to 30.0 as/s.
+	*/
+
+	if (30.0 >= fabs(rate)) {
+		steps->resolution = A4988_RES_EIGHTH;
+		set_delay(steps, (THE_DEC_NUMBER / 8.0) / fabs(rate));
+
+		return EXIT_SUCCESS;
+	}
+
+	/*
+	  Between 30.0 and 60.0 (or -60.0 and -30.0), use 1/4.
+	*/
+
+	if (60.0 >= fabs(rate)) {
+		steps->resolution = A4988_RES_QUARTER;
+		set_delay(steps, (THE_DEC_NUMBER / 4.0) / fabs(rate));
+
+		return EXIT_SUCCESS;
+	}
+
+	/*
+	  Between 60.0 and 120.0 (or -120.0 and -60.0), use 1.
+	*/
+
+	if (120.0 >= fabs(rate)) {
+		steps->resolution = A4988_RES_FULL;
+		set_delay(steps, THE_DEC_NUMBER / fabs(rate));
+
+		return EXIT_SUCCESS;
+	}
+
+	fprintf(stderr,	"%s:%d - Requested rate is out of range: %.2f\n",
+		__FILE__, __LINE__, rate);
+
+	return EXIT_FAILURE;
+}
+
+/*
+  ==============================================================================
+  ==============================================================================
+  Public Stuff
+  ==============================================================================
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  steps_from_rate
+*/
+
+int
+steps_from_rate(enum stepper_axis axis, double rate, struct steps *steps)
+{
+	if (STEPPER_AXIS_RA == axis)
+		return ra_steps(rate, steps);
+
+	if (STEPPER_AXIS_DEC == axis)
+		return dec_steps(rate, steps);
+
+	fprintf(stderr, "%s:%d - Invalid Axis: %d\n", __FILE__, __LINE__, axis);
+
+	return EXIT_FAILURE;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  steps_scale
+
+  At full resolution, THE_*_NUMBER us per step is 1 as/s.
+*/
+
+double
+steps_scale(enum stepper_axis axis)
+{
+	if (STEPPER_AXIS_RA == axis)
+		return (double)THE_RA_NUMBER / 8.0e6;
+
+	return (double)THE_DEC_NUMBER / 8.0e6;
+}
@@ -0,0 +1,37 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  steps.h
+
+  How a rate (in arc-seconds per second) turns into steps: the A4988
+  resolution and direction, the pulse width, and the delay between
+  pulses.  Used by the stepper threads (stepper.c) and by the
+  simulator (sim.c), so this has nothing to do with the hardware
+  itself.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _STEPS_H_
+#define _STEPS_H_
+
+#include "a4988.h"
+#include "stepper.h"
+
+struct steps {
+	enum a4988_res resolution;
+	enum a4988_dir direction;
+	long width;		/* in micro seconds */
+	long delay;		/* in micro seconds */
+	double fraction;	/* of a micro second, left out of delay */
+};
+
+int steps_from_rate(enum stepper_axis axis, double rate, struct steps *steps);
+
+/*
+  Arc-seconds per 1/8 step (see stepper_get_position()).
+*/
+
+double steps_scale(enum stepper_axis axis);
+
+#endif	/* _STEPS_H_ */
@@ -0,0 +1,673 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  telemetry.c
+
+  See telemetry.h.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+
+#include "telemetry.h"
+#include "timespec.h"
+
+/*
+  ==============================================================================
+  Private
+  ==============================================================================
+*/
+
+enum source {
+	SOURCE_TEMP,
+	SOURCE_STAT,
+	SOURCE_MEMINFO,
+	SOURCE_THROTTLED,
+	SOURCE_FREQUENCY,
+	SOURCE_INTERRUPTS,
+	SOURCE_SOFTIRQS,
+	SOURCES
+};
+
+static const struct {
+	const char *path;
+	bool required;		/* complain if it can't be opened */
+} sources[SOURCES] = {
+	[SOURCE_TEMP] = { "/sys/class/thermal/thermal_zone0/temp", true },
+	[SOURCE_STAT] = { "/proc/stat", true },
+	[SOURCE_MEMINFO] = { "/proc/meminfo", false },
+	[SOURCE_THROTTLED] = {
+		"/sys/devices/platform/soc/soc:firmware/get_throttled", false
+	},
+	[SOURCE_FREQUENCY] = {
+		"/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq", false
+	},
+	[SOURCE_INTERRUPTS] = { "/proc/interrupts", false },
+	[SOURCE_SOFTIRQS] = { "/proc/softirqs", false }
+};
+
+static int fds[SOURCES] = { -1, -1, -1, -1, -1, -1, -1 };
+
+/*
+  Big enough for all of /proc/interrupts on a Pi.  Anything past the
+  end is left out, the same each time.
+*/
+
+static char buffer[16384];
+
+/*
+  The "cpu" lines of /proc/stat are user, nice, system, idle, iowait,
+  irq, softirq and steal (older kernels have fewer).  The last ones
+  read, for the differences.
+*/
+
+enum field {
+	FIELD_USER,
+	FIELD_NICE,
+	FIELD_SYSTEM,
+	FIELD_IDLE,
+	FIELD_IOWAIT,
+	FIELD_IRQ,
+	FIELD_SOFTIRQ,
+	FIELD_STEAL,
+	FIELDS
+};
+
+struct times {
+	bool valid;
+	unsigned long long fields[FIELDS];
+};
+
+static struct times last_all;
+static struct times last_cpu[TELEMETRY_CPUS];
+
+/* Interrupt counts, per core. */
+
+static struct timespec last_when;
+static bool have_counts = false;
+static unsigned long long last_interrupts[TELEMETRY_CPUS];
+static unsigned long long last_softirqs[TELEMETRY_CPUS];
+
+/*
+  The history.  Each slot has a sequence number, odd while the slot is
+  being written; a reader copies the sample and tries again if the
+  sequence changed meanwhile.  'count' is the number of samples ever
+  added, so the latest is in slot (count - 1) % SLOTS.  There is one
+  slot more than the history, the one being written next.
+*/
+
+#define SLOTS (TELEMETRY_HISTORY + 1)
+
+struct slot {
+	atomic_uint sequence;
+	struct telemetry_sample sample;
+};
+
+static struct slot ring[SLOTS];
+static atomic_ulong count;
+
+/*
+  ------------------------------------------------------------------------------
+  telemetry_read
+
+  As much of a file as fits, from the start, as a string.
+*/
+
+static int
+telemetry_read(enum source source)
+{
+	size_t have = 0;
+	ssize_t length;
+
+	if (0 > fds[source])
+		return -1;
+
+	/* The proc files can come a page at a time. */
+	while (have < sizeof(buffer) - 1) {
+		length = pread(fds[source], buffer + have,
+			       sizeof(buffer) - 1 - have, have);
+
+		if (-1 == length && EINTR == errno)
+			continue;
+
+		if (0 >= length)
+			break;
+
+		have += length;
+	}
+
+	if (0 == have)
+		return -1;
+
+	buffer[have] = '\0';
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  parse_number
+
+  An unsigned number in base 10 or 16, after any blanks.  Moves
+  'string' past it, or returns -1 if there isn't one.
+*/
+
+static int
+parse_number(const char **string, unsigned base, unsigned long long *value)
+{
+	const char *p = *string;
+	unsigned long long number = 0;
+	bool digits = false;
+
+	while (' ' == *p || '\t' == *p)
+		++p;
+
+	for (;; ++p) {
+		unsigned digit;
+
+		if ('0' <= *p && '9' >= *p)
+			digit = *p - '0';
+		else if (16 == base && 'a' <= *p && 'f' >= *p)
+			digit = *p - 'a' + 10;
+		else if (16 == base && 'A' <= *p && 'F' >= *p)
+			digit = *p - 'A' + 10;
+		else
+			break;
+
+		number = (number * base) + digit;
+		digits = true;
+	}
+
+	if (!digits)
+		return -1;
+
+	*string = p;
+	*value = number;
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  parse_field
+
+  The number after "key" at the start of a line, as in /proc/meminfo.
+*/
+
+static long
+parse_field(const char *key)
+{
+	const char *line = buffer;
+	size_t length = strlen(key);
+	unsigned long long value;
+
+	while (NULL != line) {
+		if (0 == strncmp(line, key, length)) {
+			line += length;
+
+			if (parse_number(&line, 10, &value))
+				return TELEMETRY_UNKNOWN;
+
+			return (long)value;
+		}
+
+		line = strchr(line, '\n');
+
+		if (NULL != line)
+			++line;
+	}
+
+	return TELEMETRY_UNKNOWN;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sample_value
+
+  A file holding just a number.
+*/
+
+static long
+sample_value(enum source source, unsigned base)
+{
+	const char *p = buffer;
+	unsigned long long value;
+
+	if (telemetry_read(source))
+		return TELEMETRY_UNKNOWN;
+
+	if (16 == base && '0' == p[0] && ('x' == p[1] || 'X' == p[1]))
+		p += 2;
+
+	if (parse_number(&p, base, &value))
+		return TELEMETRY_UNKNOWN;
+
+	return (long)value;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  percent
+
+  Of 'total', rounded.
+*/
+
+static long
+percent(unsigned long long part, unsigned long long total)
+{
+	if (0 == total)
+		return TELEMETRY_UNKNOWN;
+
+	return (long)((part * 100 + total / 2) / total);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  parse_times
+
+  The numbers of a "cpu" line, and the differences from 'last' (which
+  is updated).  Returns -1 if there are no differences yet.
+*/
+
+static int
+parse_times(const char **p, struct times *last,
+	    unsigned long long delta[FIELDS], unsigned long long *total)
+{
+	struct times this = { .valid = true, .fields = { 0 } };
+	int rc = -1;
+	int i;
+
+	for (i = 0; i < FIELDS; ++i)
+		if (parse_number(p, 10, &this.fields[i]))
+			break;
+
+	if (FIELD_IOWAIT > i)
+		return -1;
+
+	*total = 0;
+
+	for (i = 0; i < FIELDS; ++i) {
+		/* The counters can go backwards, after a core sleeps. */
+		if (this.fields[i] < last->fields[i])
+			delta[i] = 0;
+		else
+			delta[i] = this.fields[i] - last->fields[i];
+
+		*total += delta[i];
+	}
+
+	if (last->valid && 0 < *total)
+		rc = 0;
+
+	*last = this;
+
+	return rc;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sample_cpus
+
+  The "cpu" (all) and "cpuN" lines at the top of /proc/stat.
+*/
+
+static void
+sample_cpus(struct telemetry_sample *sample)
+{
+	const char *p = buffer;
+	unsigned long long delta[FIELDS];
+	unsigned long long total;
+	unsigned long long cpu;
+	int i;
+
+	sample->load = TELEMETRY_UNKNOWN;
+	sample->cpus = 0;
+
+	for (i = 0; i < TELEMETRY_CPUS; ++i) {
+		struct telemetry_cpu *core = &sample->cpu[i];
+
+		core->busy = TELEMETRY_UNKNOWN;
+		core->user = TELEMETRY_UNKNOWN;
+		core->system = TELEMETRY_UNKNOWN;
+		core->iowait = TELEMETRY_UNKNOWN;
+		core->irq = TELEMETRY_UNKNOWN;
+		core->softirq = TELEMETRY_UNKNOWN;
+	}
+
+	if (telemetry_read(SOURCE_STAT))
+		return;
+
+	while (0 == strncmp(p, "cpu", 3)) {
+		struct telemetry_cpu *core = NULL;
+		struct times *last = &last_all;
+
+		p += 3;
+
+		if (' ' != *p) {
+			if (parse_number(&p, 10, &cpu))
+				break;
+
+			if (TELEMETRY_CPUS > cpu) {
+				core = &sample->cpu[cpu];
+				last = &last_cpu[cpu];
+
+				if (sample->cpus <= cpu)
+					sample->cpus = cpu + 1;
+			} else {
+				last = NULL;
+			}
+		}
+
+		if (NULL != last && 0 == parse_times(&p, last, delta, &total)) {
+			unsigned long long idle =
+				delta[FIELD_IDLE] + delta[FIELD_IOWAIT];
+
+			if (NULL == core) {
+				sample->load = percent(total - idle, total);
+			} else {
+				core->busy = percent(total - idle, total);
+				core->user = percent(delta[FIELD_USER] +
+						     delta[FIELD_NICE], total);
+				core->system = percent(delta[FIELD_SYSTEM],
+						       total);
+				core->iowait = percent(delta[FIELD_IOWAIT],
+						       total);
+				core->irq = percent(delta[FIELD_IRQ], total);
+				core->softirq = percent(delta[FIELD_SOFTIRQ],
+							total);
+			}
+		}
+
+		p = strchr(p, '\n');
+
+		if (NULL == p)
+			break;
+
+		++p;
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  parse_columns
+
+  Add up the columns (one per core) of /proc/interrupts or
+  /proc/softirqs.  The first line names the cores, each line after that
+  is "name:" and a count for each.  Returns -1 if it can't be read.
+*/
+
+static int
+parse_columns(enum source source, unsigned long long sums[TELEMETRY_CPUS])
+{
+	const char *p;
+	unsigned columns = 0;
+	unsigned i;
+
+	memset(sums, 0, sizeof(sums[0]) * TELEMETRY_CPUS);
+
+	if (telemetry_read(source))
+		return -1;
+
+	/* The header, "CPU0 CPU1 ..." */
+	for (p = buffer; '\n' != *p && '\0' != *p; ++p)
+		if ('C' == p[0] && 'P' == p[1] && 'U' == p[2])
+			++columns;
+
+	while ('\n' == *p) {
+		unsigned long long value;
+
+		++p;
+		p = strchr(p, ':');
+
+		if (NULL == p)
+			break;
+
+		++p;
+
+		/* Some lines (ERR, MIS) have just one count. */
+		for (i = 0; i < columns; ++i) {
+			if (parse_number(&p, 10, &value))
+				break;
+
+			if (TELEMETRY_CPUS > i)
+				sums[i] += value;
+		}
+
+		p = strchr(p, '\n');
+
+		if (NULL == p)
+			break;
+	}
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  sample_counts
+
+  Interrupts and soft interrupts per second, for each core.
+*/
+
+static void
+sample_counts(struct telemetry_sample *sample)
+{
+	unsigned long long interrupts[TELEMETRY_CPUS];
+	unsigned long long softirqs[TELEMETRY_CPUS];
+	bool valid;
+	double seconds;
+	int i;
+
+	valid = (0 == parse_columns(SOURCE_INTERRUPTS, interrupts));
+	valid = (0 == parse_columns(SOURCE_SOFTIRQS, softirqs)) && valid;
+	seconds = timespec_to_double(timespec_sub(sample->when, last_when));
+
+	for (i = 0; i < TELEMETRY_CPUS; ++i) {
+		struct telemetry_cpu *core = &sample->cpu[i];
+
+		if (valid && have_counts && 0.0 < seconds &&
+		    interrupts[i] >= last_interrupts[i] &&
+		    softirqs[i] >= last_softirqs[i]) {
+			core->interrupts = (long)((interrupts[i] -
+						   last_interrupts[i]) /
+						  seconds + 0.5);
+			core->softirqs = (long)((softirqs[i] -
+						 last_softirqs[i]) /
+						seconds + 0.5);
+		} else {
+			core->interrupts = TELEMETRY_UNKNOWN;
+			core->softirqs = TELEMETRY_UNKNOWN;
+		}
+
+		last_interrupts[i] = interrupts[i];
+		last_softirqs[i] = softirqs[i];
+	}
+
+	have_counts = valid;
+	last_when = sample->when;
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  telemetry_read_slot
+*/
+
+static void
+telemetry_read_slot(unsigned long index, struct telemetry_sample *sample)
+{
+	struct slot *slot = &ring[index % SLOTS];
+	unsigned before;
+	unsigned after;
+
+	for (;;) {
+		before = atomic_load_explicit(&slot->sequence,
+					      memory_order_acquire);
+
+		if (before & 1)
+			continue;
+
+		memcpy(sample, &slot->sample, sizeof(*sample));
+		atomic_thread_fence(memory_order_acquire);
+		after = atomic_load_explicit(&slot->sequence,
+					     memory_order_relaxed);
+
+		if (before == after)
+			return;
+	}
+}
+
+/*
+  ==============================================================================
+  Public
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  telemetry_initialize
+*/
+
+int
+telemetry_initialize(void)
+{
+	int i;
+
+	for (i = 0; i < SOURCES; ++i) {
+		if (0 <= fds[i])
+			continue;
+
+		fds[i] = open(sources[i].path, O_RDONLY | O_CLOEXEC);
+
+		if (0 > fds[i] && sources[i].required)
+			fprintf(stderr, "%s:%d - open(%s) failed: %s\n",
+				__FILE__, __LINE__, sources[i].path,
+				strerror(errno));
+	}
+
+	/* So there is something to read straight away. */
+	telemetry_sample();
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  telemetry_finalize
+*/
+
+void
+telemetry_finalize(void)
+{
+	int i;
+
+	for (i = 0; i < SOURCES; ++i) {
+		if (0 <= fds[i])
+			close(fds[i]);
+
+		fds[i] = -1;
+	}
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  telemetry_sample
+*/
+
+void
+telemetry_sample(void)
+{
+	struct telemetry_sample sample;
+	unsigned long index;
+	struct slot *slot;
+	unsigned sequence;
+
+	clock_gettime(CLOCK_MONOTONIC, &sample.when);
+	sample.temp = sample_value(SOURCE_TEMP, 10);
+	sample_cpus(&sample);
+	sample_counts(&sample);
+	sample.throttled = sample_value(SOURCE_THROTTLED, 16);
+	sample.frequency = sample_value(SOURCE_FREQUENCY, 10);
+
+	if (telemetry_read(SOURCE_MEMINFO)) {
+		sample.mem_total = TELEMETRY_UNKNOWN;
+		sample.mem_available = TELEMETRY_UNKNOWN;
+	} else {
+		sample.mem_total = parse_field("MemTotal:");
+		sample.mem_available = parse_field("MemAvailable:");
+	}
+
+	index = atomic_load_explicit(&count, memory_order_relaxed);
+	slot = &ring[index % SLOTS];
+	sequence = atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+
+	atomic_store_explicit(&slot->sequence, sequence + 1,
+			      memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	memcpy(&slot->sample, &sample, sizeof(sample));
+	atomic_store_explicit(&slot->sequence, sequence + 2,
+			      memory_order_release);
+	atomic_store_explicit(&count, index + 1, memory_order_release);
+
+	return;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  telemetry_latest
+*/
+
+bool
+telemetry_latest(struct telemetry_sample *sample)
+{
+	unsigned long index;
+
+	index = atomic_load_explicit(&count, memory_order_acquire);
+
+	if (0 == index)
+		return false;
+
+	telemetry_read_slot(index - 1, sample);
+
+	return true;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  telemetry_history
+*/
+
+unsigned
+telemetry_history(struct telemetry_sample *samples, unsigned count_)
+{
+	unsigned long index;
+	unsigned long first;
+	unsigned i;
+
+	index = atomic_load_explicit(&count, memory_order_acquire);
+
+	if (count_ > TELEMETRY_HISTORY)
+		count_ = TELEMETRY_HISTORY;
+
+	if (count_ > index)
+		count_ = index;
+
+	first = index - count_;
+
+	for (i = 0; i < count_; ++i)
+		telemetry_read_slot(first + i, &samples[i]);
+
+	return count_;
+}
@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  telemetry.h
+
+  Temperature, CPU load (in all and for each core), memory, throttling
+  and clock frequency.
+
+  telemetry_sample() reads them all, from files kept open since
+  telemetry_initialize(), and adds a sample to a history of the last
+  TELEMETRY_HISTORY.  Only one thread samples (the housekeeping loop's,
+  see loop.h, once a second from stats.c); any thread can read the
+  samples, without locks or I/O.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+#include <stdbool.h>
+#include <limits.h>
+#include <time.h>
+
+#define TELEMETRY_HISTORY 256
+
+/* Anything that couldn't be read. */
+
+#define TELEMETRY_UNKNOWN LONG_MIN
+
+/*
+  Each core, over the time since the last sample.  The percentages are
+  of that core's time: 'busy' is all but idle and iowait, and 'irq' and
+  'softirq' are the time spent handling interrupts.  'interrupts' and
+  'softirqs' are how many were handled, per second.
+*/
+
+#define TELEMETRY_CPUS 4	/* as many as a Pi has, any more are left out */
+
+struct telemetry_cpu {
+	long busy;
+	long user;		/* including nice */
+	long system;
+	long iowait;
+	long irq;
+	long softirq;
+	long interrupts;
+	long softirqs;
+};
+
+struct telemetry_sample {
+	struct timespec when;	/* CLOCK_MONOTONIC */
+	long temp;		/* millidegrees C */
+	long load;		/* percent busy, all CPUs, since the last */
+	long mem_total;		/* kB */
+	long mem_available;	/* kB */
+	long throttled;		/* firmware flags, see TELEMETRY_THROTTLED_* */
+	long frequency;		/* kHz, CPU 0 */
+	unsigned cpus;
+	struct telemetry_cpu cpu[TELEMETRY_CPUS];
+};
+
+/* From the Raspberry Pi firmware's get_throttled. */
+
+#define TELEMETRY_THROTTLED_UNDERVOLT     0x00001
+#define TELEMETRY_THROTTLED_CAPPED        0x00002
+#define TELEMETRY_THROTTLED_THROTTLED     0x00004
+#define TELEMETRY_THROTTLED_SOFT_LIMIT    0x00008
+#define TELEMETRY_THROTTLED_WAS_UNDERVOLT 0x10000
+#define TELEMETRY_THROTTLED_WAS_CAPPED    0x20000
+#define TELEMETRY_THROTTLED_WAS_THROTTLED 0x40000
+
+int telemetry_initialize(void);
+void telemetry_finalize(void);
+
+void telemetry_sample(void);
+
+/* The latest sample, false if there isn't one yet. */
+
+bool telemetry_latest(struct telemetry_sample *sample);
+
+/*
+  Up to 'count' of the latest samples, oldest first.  Returns how many
+  there were.
+*/
+
+unsigned telemetry_history(struct telemetry_sample *samples, unsigned count);
+
+#endif	/* _TELEMETRY_H_ */
@@ -1,21 +1,56 @@
 /*
-  control.c
+  client.c
 
-  Excersize the "control" interface of pimount.
+  Excersize the "control" interface of pimount using the client
+  library (../client.h).
 */
 
-#include <sys/socket.h>
-#include <sys/types.h>
-#include <netinet/in.h>
-#include <netdb.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <errno.h>
-#include <arpa/inet.h>
 
 #include "../server.h"
+#include "../client.h"
+
+static int outstanding;
+
+/*
+  ------------------------------------------------------------------------------
+  done
+*/
+
+static void
+done(__attribute__((unused)) struct client *client,
+     struct server_message *reply, int result,
+     __attribute__((unused)) void *data)
+{
+	--outstanding;
+
+	if (NULL == reply) {
+		fprintf(stderr, "Request Failed: %s\n", strerror(-result));
+
+		return;
+	}
+
+	switch (reply->command) {
+	case SERVER_GET_TIME:
+		printf("[%u] %s", reply->sequence,
+		       asctime(&reply->body.time.time));
+		break;
+	case SERVER_GET_STATUS:
+		printf("[%u] temperature = %d load = %ld\n", reply->sequence,
+		       reply->body.status.temperature,
+		       reply->body.status.load);
+		break;
+	default:
+		printf("[%u] result = %d\n", reply->sequence, result);
+		break;
+	}
+
+	return;
+}
 
 /*
   ------------------------------------------------------------------------------
@@ -25,67 +60,71 @@
 int
 main(int argc, char *argv[])
 {
-	int sockfd = 0;
-	int n = 0;
-	struct sockaddr_in serv_addr;
+	struct client *client;
 	struct server_message message;
+	unsigned short port = 0;
+	int rc;
 
-	if (argc != 3) {
-		fprintf(stderr, "Usage: %s <ip of server> <port>\n", argv[0]);
+	if (2 > argc || 3 < argc) {
+		fprintf(stderr, "Usage: %s <server> [port]\n", argv[0]);
 
 		return 1;
 	}
 
-	if ((sockfd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
-		fprintf(stderr, "socket() failed: %s\n", strerror(errno));
+	if (3 == argc)
+		port = atoi(argv[2]);
+
+	client = client_create(argv[1], port, 2, NULL);
+
+	if (NULL == client) {
+		fprintf(stderr, "client_create() failed: %s\n",
+			strerror(errno));
 
 		return 1;
 	}
 
-	memset(&serv_addr, '0', sizeof(serv_addr));
-	serv_addr.sin_family = AF_INET;
-	serv_addr.sin_port = htons(atoi(argv[2]));
+	/*
+	  Get the Time (SERVER_GET_TIME), Synchronously
+	*/
 
-	if (inet_pton(AF_INET, argv[1], &serv_addr.sin_addr) != 1) {
-		fprintf(stderr, "inet_pton() failed\n");
+	memset(&message, 0, sizeof(message));
+	message.command = SERVER_GET_TIME;
+	rc = client_call(client, &message, 2000);
+
+	if (rc) {
+		fprintf(stderr, "client_call() failed: %s\n", strerror(-rc));
+		client_destroy(client);
 
 		return 1;
 	}
 
+	printf("%s", asctime(&message.body.time.time));
+
 	/*
-	  Get the Time (SERVER_GET_TIME)
+	  Pipeline a Few Requests, Asynchronously
 	*/
 
-	if (connect(sockfd,
-		    (struct sockaddr *)&serv_addr, sizeof(serv_addr)) < 0) {
-		fprintf(stderr, "connect() failed: %s\n", strerror(errno));
+	memset(&message, 0, sizeof(message));
+	message.command = SERVER_GET_STATUS;
 
-		return 1;
-	}
+	if (0 == client_request(client, &message, done, NULL))
+		++outstanding;
 
 	message.command = SERVER_GET_TIME;
 
-	if (-1 == send(sockfd, &message, sizeof(message), 0)) {
-		fprintf(stderr, "send() failed: %s\n", strerror(errno));
-	} else {
-		n = read(sockfd, &message, sizeof(message));
+	if (0 == client_request(client, &message, done, NULL))
+		++outstanding;
 
-		if (0 != n)
-			printf("%s", asctime(&message.body.time.time));
-	}
+	message.command = SERVER_GET_STATUS;
 
-	/*
-	  Get the Status (SERVER_GET_STATUS)
-	*/
+	if (0 == client_request(client, &message, done, NULL))
+		++outstanding;
 
-#if 0
-	message.command = SERVER_GET_STATUS;
-	send(sockfd, &message, sizeof(message), 0);
-	n = read(sockfd, &message, sizeof(message));
+	while (0 < outstanding)
+		if (client_service(client, 1000))
+			break;
 
-	if (0 != n)
-		printf("temperature = %d\n", message.body.status.temperature);
-#endif
+	client_destroy(client);
 
 	return 0;
 }
@@ -0,0 +1,282 @@
+/*
+  ==============================================================================
+  oled.c
+
+  Measure the I2C traffic of typical OLED updates.
+
+  Built as oled-sim, with -DOLED_SIMULATE, it needs no display: the bus
+  time is modelled (see oledsim.h), and --save writes what the panel
+  shows after each benchmark.
+  ==============================================================================
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <signal.h>
+#include <stdbool.h>
+
+#include "../oled.h"
+
+#ifdef OLED_SIMULATE
+#include "../oledsim.h"
+#else
+#include <pigpio.h>
+
+char *cmdErrStr(int); /* For some reason, pigpio doesn't export this! */
+#endif
+
+static int i2c_handle = -1;
+static const char *save;
+
+/*
+  ------------------------------------------------------------------------------
+  usage
+*/
+
+static void
+usage(int exit_code)
+{
+	printf("oled \n"
+	       "--help|-h, Display this wonderful help screen...\n"
+	       "--frames|-f <frames>, Frames per benchmark (default 100).\n");
+#ifdef OLED_SIMULATE
+	printf("--save|-s <prefix>, Save the panel after each benchmark,\n"
+	       "  as <prefix><benchmark>.png.\n");
+#endif
+
+	exit(exit_code);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  handler
+*/
+
+static void
+handler(__attribute__((unused)) int signal)
+{
+	printf("--> OLED Test Terminated...\n");
+
+	if (0 <= i2c_handle) {
+		oled_finalize(i2c_handle);
+		i2cClose(i2c_handle);
+	}
+
+	gpioTerminate();
+
+	exit(EXIT_FAILURE);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  field
+
+  Right justify a value after a label, as stats.c does.
+*/
+
+static void
+field(unsigned y, const char *value)
+{
+	oled_fill(i2c_handle, false, 3, y, 15, y);
+	oled_print(i2c_handle, 15 - strlen(value), y, OLED_FONT_MEDIUM,
+		   (char *)value);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  labels
+*/
+
+static void
+labels(void)
+{
+	oled_clear(i2c_handle);
+	oled_print(i2c_handle, 0, 0, OLED_FONT_MEDIUM, "PiMount");
+	oled_print(i2c_handle, 0, 2, OLED_FONT_MEDIUM, "T/L");
+	oled_print(i2c_handle, 0, 4, OLED_FONT_MEDIUM, "R/A");
+	oled_print(i2c_handle, 0, 6, OLED_FONT_MEDIUM, "DEC");
+}
+
+/*
+  ------------------------------------------------------------------------------
+  report
+*/
+
+static void
+report(const char *name, int frames)
+{
+	struct oled_counts counts;
+#ifdef OLED_SIMULATE
+	struct oledsim_counts bus;
+	char path[256];
+
+	oledsim_get_counts(&bus, true);
+#endif
+
+	oled_get_counts(&counts, true);
+	printf("%-8s %8.1f %10.1f %10.3f", name,
+	       (double)counts.transactions / frames,
+	       (double)counts.bytes / frames,
+	       counts.seconds * 1000.0 / frames);
+#ifdef OLED_SIMULATE
+	printf(" %10.3f", bus.seconds * 1000.0 / frames);
+
+	if (NULL != save) {
+		snprintf(path, sizeof(path), "%s%s.png", save, name);
+		oledsim_save(path);
+	}
+#endif
+	printf("\n");
+}
+
+/*
+  ------------------------------------------------------------------------------
+  main
+*/
+
+int
+main(int argc, char *argv[])
+{
+	int rc;
+	int opt = 0;
+	int long_index = 0;
+	int frames = 100;
+	int i;
+	char buffer[16];
+	struct oled_counts counts;
+
+	static struct option long_options[] = {
+		{"help",       no_argument,       0,  'h' },
+		{"frames",     required_argument, 0,  'f' },
+		{"save",       required_argument, 0,  's' },
+		{0, 0, 0, 0}
+	};
+
+	while ((opt = getopt_long(argc, argv, "hf:s:",
+				  long_options, &long_index )) != -1) {
+		switch (opt) {
+		case 'h':
+			usage(EXIT_SUCCESS);
+			break;
+		case 'f':
+			frames = atoi(optarg);
+			break;
+		case 's':
+			save = optarg;
+			break;
+		default:
+			fprintf(stderr, "Invalid Option\n");
+			usage(EXIT_FAILURE);
+			break;
+		}
+	}
+
+	if (0 >= frames)
+		usage(EXIT_FAILURE);
+
+	/*
+	  Initialize pigpio
+	*/
+
+	rc = gpioInitialise();
+
+	if (PI_INIT_FAILED == rc) {
+		fprintf(stderr, "gpioinitialise() failed: %s\n", cmdErrStr(rc));
+
+		return EXIT_FAILURE;
+	}
+
+	i2c_handle = i2cOpen(1, OLED_ADDRESS, 0);
+
+	if (0 > i2c_handle) {
+		fprintf(stderr, "i2cOpen() failed: %s\n", cmdErrStr(i2c_handle));
+		gpioTerminate();
+
+		return EXIT_FAILURE;
+	}
+
+	rc = oled_initialize(i2c_handle, false, false);
+
+	if (rc) {
+		fprintf(stderr,
+			"%s:%d - oled_initialize() failed\n", __FILE__, __LINE__);
+		gpioTerminate();
+
+		return EXIT_FAILURE;
+	}
+
+	signal(SIGHUP, handler);
+	signal(SIGINT, handler);
+	signal(SIGTERM, handler);
+
+	oled_get_counts(&counts, true);
+
+	printf("%-8s %8s %10s %10s", "Frame", "Xfers", "Bytes", "ms");
+#ifdef OLED_SIMULATE
+	printf(" %10s", "Bus ms");
+#endif
+	printf("\n");
+
+	/* Everything, every time. */
+
+	for (i = 0; i < frames; ++i) {
+		labels();
+		oled_update(i2c_handle);
+		oled_clear(i2c_handle);
+		oled_update(i2c_handle);
+	}
+
+	report("Full", frames * 2);
+
+	/* The four fields of stats.c, all changing. */
+
+	labels();
+	oled_update(i2c_handle);
+	oled_get_counts(&counts, true);
+
+	for (i = 0; i < frames; ++i) {
+		snprintf(buffer, sizeof(buffer), "%s", (i & 1) ? "Local" : "Remote");
+		oled_fill(i2c_handle, false, 7, 0, 15, 0);
+		oled_print(i2c_handle, 15 - strlen(buffer), 0, OLED_FONT_MEDIUM,
+			   buffer);
+		snprintf(buffer, sizeof(buffer), "%dC/%d%%", 40 + i % 10, i % 100);
+		field(2, buffer);
+		snprintf(buffer, sizeof(buffer), "%.2f", 15.04 + i / 100.0);
+		field(4, buffer);
+		snprintf(buffer, sizeof(buffer), "%.2f", -i / 100.0);
+		field(6, buffer);
+		oled_update(i2c_handle);
+	}
+
+	report("Status", frames);
+
+	/* One rate changing in the last digit. */
+
+	for (i = 0; i < frames; ++i) {
+		snprintf(buffer, sizeof(buffer), "%.2f", 15.00 + (i % 10) / 100.0);
+		field(4, buffer);
+		oled_update(i2c_handle);
+	}
+
+	report("Digit", frames);
+
+	/* Redrawn, but nothing changed. */
+
+	for (i = 0; i < frames; ++i) {
+		field(4, buffer);
+		oled_update(i2c_handle);
+	}
+
+	report("Same", frames);
+
+	oled_clear(i2c_handle);
+	oled_update(i2c_handle);
+	oled_finalize(i2c_handle);
+	i2cClose(i2c_handle);
+	gpioTerminate();
+
+	return EXIT_SUCCESS;
+}
@@ -16,16 +16,19 @@
 #include <limits.h>
 #include <errno.h>
 #include <stdbool.h>
+#include <pthread.h>
 
 #include <pigpio.h>
 
 #include "../oled.h"
 #include "../stats.h"
+#include "../loop.h"
 #include "../pimount.h"
 
 char *cmdErrStr(int); /* For some reason, pigpio doesn't export this! */
 
 static int i2c_handle = -1;
+static pthread_t loop_thread;
 
 /*
   ------------------------------------------------------------------------------
@@ -61,6 +64,20 @@ handler(__attribute__((unused)) int signal)
 	exit(EXIT_FAILURE);
 }
 
+/*
+  ------------------------------------------------------------------------------
+  housekeeping
+
+  Runs the stats callbacks (see loop.h) beside the test's own drawing.
+*/
+
+static void *
+housekeeping(__attribute__((unused)) void *input)
+{
+	loop_run();
+	pthread_exit(NULL);
+}
+
 /*
   ------------------------------------------------------------------------------
   main
@@ -107,7 +124,7 @@ main(int argc, char *argv[])
 	  Set Up I2C Connection
 	*/
 
-	i2c_handle = i2cOpen(1, 0x3c, 0);
+	i2c_handle = i2cOpen(1, OLED_ADDRESS, 0);
 
 	if (0 > i2c_handle) {
 		fprintf(stderr, "i2cOpen() failed: %s\n", cmdErrStr(i2c_handle));
@@ -130,7 +147,13 @@ main(int argc, char *argv[])
 		return EXIT_FAILURE;
 	}
 
-	rc = stats_initialize();
+	rc = loop_initialize(NULL);
+
+	if (0 == rc)
+		rc = stats_initialize();
+
+	if (0 == rc)
+		rc = pthread_create(&loop_thread, NULL, housekeeping, NULL);
 
 	if (rc) {
 		fprintf(stderr,
@@ -161,6 +184,7 @@ main(int argc, char *argv[])
 	oled_print(i2c_handle, 0, 2, OLED_FONT_MEDIUM, "T/LA");
 	oled_print(i2c_handle, 0, 4, OLED_FONT_MEDIUM, "R/A");
 	oled_print(i2c_handle, 0, 6, OLED_FONT_MEDIUM, "DEC");
+	oled_update(i2c_handle);
 	sleep(10);
 
 	for (;;) {
@@ -209,6 +233,7 @@ main(int argc, char *argv[])
 		oled_fill(i2c_handle, false, 3, 6, 15, 6);
 		oled_print(i2c_handle, 15 - strlen(buffer), 6, OLED_FONT_MEDIUM,
 			   buffer);
+		oled_update(i2c_handle);
 
 		/* Update Temperature and Load */
 
@@ -225,6 +250,7 @@ main(int argc, char *argv[])
 		oled_fill(i2c_handle, false, 3, 2, 15, 2);
 		oled_print(i2c_handle, 15 - strlen(buffer), 2, OLED_FONT_MEDIUM,
 			   buffer);
+		oled_update(i2c_handle);
 
 		/* Sleep for a Bit */
 
@@ -237,7 +263,10 @@ main(int argc, char *argv[])
 	  Clean Up
 	*/
 
+	loop_stop();
+	pthread_join(loop_thread, NULL);
 	stats_finalize();
+	loop_finalize();
 
 	oled_finalize(i2c_handle);
 
@@ -0,0 +1,174 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  widget.c
+
+  See widget.h.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "oled.h"
+#include "widget.h"
+
+/*
+  ==============================================================================
+  Private
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  widget_sample
+
+  'age' samples before the latest, NAN if there isn't one.
+*/
+
+static double
+widget_sample(const struct widget *widget, unsigned age)
+{
+	if (age >= widget->count)
+		return NAN;
+
+	return widget->samples[(widget->next + WIDGET_SAMPLES - 1 - age) %
+			       WIDGET_SAMPLES];
+}
+
+/*
+  ------------------------------------------------------------------------------
+  widget_row
+
+  The pixel row for a value, -1 for NAN.
+*/
+
+static int
+widget_row(const struct widget *widget, double value)
+{
+	int top = widget->y0 * 8;
+	int bottom = (widget->y1 * 8) + 7;
+
+	if (isnan(value))
+		return -1;
+
+	if (value < widget->min)
+		value = widget->min;
+	else if (value > widget->max)
+		value = widget->max;
+
+	return bottom - (int)lround((value - widget->min) /
+				    (widget->max - widget->min) *
+				    (bottom - top));
+}
+
+/*
+  ------------------------------------------------------------------------------
+  widget_column
+
+  Draw a sample in column x, 'previous' being the sample before it.
+*/
+
+static void
+widget_column(const struct widget *widget, unsigned x,
+	      double previous, double value)
+{
+	int bottom = (widget->y1 * 8) + 7;
+	int row;
+	int last;
+
+	oled_vline(x, widget->y0 * 8, bottom, false);
+
+	row = widget_row(widget, value);
+
+	if (0 > row)
+		return;
+
+	if (WIDGET_BARS == widget->style) {
+		oled_vline(x, row, bottom, true);
+
+		return;
+	}
+
+	/* Join the line to the previous sample, if there is one. */
+	last = widget_row(widget, previous);
+
+	if (0 > last)
+		last = row;
+
+	if (last < row)
+		oled_vline(x, last, row, true);
+	else
+		oled_vline(x, row, last, true);
+}
+
+/*
+  ==============================================================================
+  Public
+  ==============================================================================
+*/
+
+/*
+  ------------------------------------------------------------------------------
+  widget_initialize
+*/
+
+int
+widget_initialize(struct widget *widget, enum widget_style style,
+		  unsigned x0, unsigned x1, unsigned y0, unsigned y1,
+		  double min, double max)
+{
+	if (x0 > x1 || 127 < x1 || y0 > y1 || 7 < y1 || min >= max) {
+		fprintf(stderr, "%s:%d - Bad Widget\n", __FILE__, __LINE__);
+
+		return -1;
+	}
+
+	widget->style = style;
+	widget->x0 = x0;
+	widget->x1 = x1;
+	widget->y0 = y0;
+	widget->y1 = y1;
+	widget->min = min;
+	widget->max = max;
+	widget->next = 0;
+	widget->count = 0;
+
+	return 0;
+}
+
+/*
+  ------------------------------------------------------------------------------
+  widget_add
+*/
+
+void
+widget_add(struct widget *widget, double value)
+{
+	widget->samples[widget->next] = value;
+	widget->next = (widget->next + 1) % WIDGET_SAMPLES;
+
+	if (WIDGET_SAMPLES > widget->count)
+		++widget->count;
+
+	oled_scroll(widget->x0, widget->x1, widget->y0, widget->y1);
+	widget_column(widget, widget->x1, widget_sample(widget, 1), value);
+}
+
+/*
+  ------------------------------------------------------------------------------
+  widget_draw
+*/
+
+void
+widget_draw(const struct widget *widget)
+{
+	unsigned age;
+
+	for (age = 0; age <= widget->x1 - widget->x0; ++age)
+		widget_column(widget, widget->x1 - age,
+			      widget_sample(widget, age + 1),
+			      widget_sample(widget, age));
+}
@@ -0,0 +1,50 @@
+/*
+  ==============================================================================
+  ==============================================================================
+  widget.h
+
+  Rolling histories on the OLED.  Each widget keeps its last
+  WIDGET_SAMPLES samples in a ring, and covers columns x0...x1 of pages
+  y0...y1.  Adding a sample scrolls the widget left by one column and
+  draws the new sample in the last column, so the next oled_update()
+  (or oled_present()) only sends the bytes that changed.
+  ==============================================================================
+  ==============================================================================
+*/
+
+#ifndef _WIDGET_H_
+#define _WIDGET_H_
+
+#define WIDGET_SAMPLES 128
+
+enum widget_style {
+	WIDGET_SPARKLINE,	/* a line joining the samples */
+	WIDGET_BARS		/* a bar from the bottom to each sample */
+};
+
+struct widget {
+	enum widget_style style;
+	unsigned x0;		/* columns */
+	unsigned x1;
+	unsigned y0;		/* pages */
+	unsigned y1;
+	double min;		/* samples outside min...max are clipped */
+	double max;
+	float samples[WIDGET_SAMPLES];
+	unsigned next;		/* where the next sample goes */
+	unsigned count;
+};
+
+int widget_initialize(struct widget *widget, enum widget_style style,
+		      unsigned x0, unsigned x1, unsigned y0, unsigned y1,
+		      double min, double max);
+
+/* NAN leaves a gap. */
+
+void widget_add(struct widget *widget, double value);
+
+/* Draw all the samples, after the screen has been cleared for example. */
+
+void widget_draw(const struct widget *widget);
+
+#endif	/* _WIDGET_H_ */